@@ -0,0 +1,370 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <stack>
+#include <string>
+#include <vector>
+#include "stack.h"
+#include "queue.h"
+#include "chunked_stack.h"
+#include "chunked_queue.h"
+#include "contiguous_stack.h"
+#include "deque.h"
+#include "cache_aligned_allocator.h"
+#include "forward_container.h"
+#include "concurrent_queue.h"
+#include "concurrent_stack.h"
+#include "spsc_queue.h"
+
+// Element of Bytes bytes; only the first word is compared and streamed
+template<size_t Bytes>
+struct Payload {
+    static_assert(Bytes >= sizeof(int) && Bytes % sizeof(int) == 0, "Payload size must be a multiple of int");
+
+    int words[Bytes / sizeof(int)] = {};
+
+    Payload() = default;
+    Payload(int value) { words[0] = value; }
+
+    friend std::ostream& operator<<(std::ostream& os, const Payload& p) { return os << p.words[0]; }
+    friend std::istream& operator>>(std::istream& is, Payload& p) { return is >> p.words[0]; }
+};
+
+using Small = Payload<4>;
+using Medium = Payload<64>;
+using Large = Payload<256>;
+
+// Uniform push/pop over this library's containers and the std baselines
+template<typename C, typename T>
+void bench_push(C& c, const T& value) { c.push(value); }
+
+template<typename T>
+void bench_push(std::deque<T>& c, const T& value) { c.push_back(value); }
+
+template<typename C>
+auto bench_pop(C& c) { return c.pop(); }
+
+template<typename T>
+T bench_pop(std::stack<T>& c) {
+    T value = std::move(c.top());
+    c.pop();
+    return value;
+}
+
+template<typename T>
+T bench_pop(std::queue<T>& c) {
+    T value = std::move(c.front());
+    c.pop();
+    return value;
+}
+
+template<typename T>
+T bench_pop(std::deque<T>& c) {
+    T value = std::move(c.front());
+    c.pop_front();
+    return value;
+}
+
+template<typename C>
+C filled(size_t count) {
+    C c;
+    for (size_t i = 0; i < count; ++i) bench_push(c, static_cast<int>(i));
+    return c;
+}
+
+// Push/pop throughput: fill to state.range(0) elements, then drain
+template<typename C, typename T>
+void BM_Push_Pop(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    C c;
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) bench_push(c, T(static_cast<int>(i)));
+        for (size_t i = 0; i < count; ++i) benchmark::DoNotOptimize(bench_pop(c));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count * 2));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * count * 2 * sizeof(T)));
+}
+
+#define FWD_BENCH_PUSH_POP(...) \
+    BENCHMARK_TEMPLATE(BM_Push_Pop, __VA_ARGS__)->RangeMultiplier(16)->Range(1 << 8, 1 << 16)
+
+#define FWD_BENCH_PUSH_POP_SIZES(C) \
+    FWD_BENCH_PUSH_POP(C<Small>, Small); \
+    FWD_BENCH_PUSH_POP(C<Medium>, Medium); \
+    FWD_BENCH_PUSH_POP(C<Large>, Large)
+
+template<typename T> using ChunkedStack = Stack<T, Chunked<64>>;
+template<typename T> using ChunkedQueue = Queue<T, Chunked<64>>;
+template<typename T> using ContiguousStack = Stack<T, ContiguousStorage<>>;
+template<typename T> using StdStack = std::stack<T>;
+template<typename T> using StdQueue = std::queue<T>;
+template<typename T> using StdDeque = std::deque<T>;
+
+FWD_BENCH_PUSH_POP_SIZES(Stack);
+FWD_BENCH_PUSH_POP_SIZES(ChunkedStack);
+FWD_BENCH_PUSH_POP_SIZES(ContiguousStack);
+FWD_BENCH_PUSH_POP_SIZES(StdStack);
+FWD_BENCH_PUSH_POP_SIZES(Queue);
+FWD_BENCH_PUSH_POP_SIZES(ChunkedQueue);
+FWD_BENCH_PUSH_POP_SIZES(Deque);
+FWD_BENCH_PUSH_POP_SIZES(StdQueue);
+FWD_BENCH_PUSH_POP_SIZES(StdDeque);
+
+// Iteration through the concrete iterator
+template<typename C>
+void BM_Iterate_Concrete(benchmark::State& state) {
+    const C c = filled<C>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        long long sum = 0;
+        for (auto it = c.begin(); it != c.end(); ++it) sum += *it;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * c.size()));
+}
+
+// Iteration through the type-erased fwd_container<T> iterator
+template<typename C>
+void BM_Iterate_Erased(benchmark::State& state) {
+    const C c = filled<C>(static_cast<size_t>(state.range(0)));
+    const fwd_container<int>& base = c;
+    for (auto _ : state) {
+        long long sum = 0;
+        for (auto it = base.begin(); it != base.end(); ++it) sum += *it;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * c.size()));
+}
+
+#define FWD_BENCH_ITERATE(C) \
+    BENCHMARK_TEMPLATE(BM_Iterate_Concrete, C)->Range(1 << 10, 1 << 18); \
+    BENCHMARK_TEMPLATE(BM_Iterate_Erased, C)->Range(1 << 10, 1 << 18)
+
+FWD_BENCH_ITERATE(Stack<int>);
+FWD_BENCH_ITERATE(Queue<int>);
+FWD_BENCH_ITERATE(ChunkedStack<int>);
+FWD_BENCH_ITERATE(ChunkedQueue<int>);
+FWD_BENCH_ITERATE(ContiguousStack<int>);
+FWD_BENCH_ITERATE(Deque<int>);
+BENCHMARK_TEMPLATE(BM_Iterate_Concrete, StdDeque<int>)->Range(1 << 10, 1 << 18);
+
+// Node layout: 1M-element traversals with nodes packed by malloc vs one cache line per node
+template<typename C>
+void BM_Traverse_1M(benchmark::State& state) {
+    const C c = filled<C>(1 << 20);
+    for (auto _ : state) {
+        long long sum = 0;
+        for (const auto& value : c) sum += value.words[0];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * c.size()));
+}
+
+template<typename C>
+void BM_Copy_1M(benchmark::State& state) {
+    const C source = filled<C>(1 << 20);
+    for (auto _ : state) {
+        C copy(source);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * source.size()));
+}
+
+// Same traversals over nodes scattered across the heap in random order: a shuffled run
+// of node-sized blocks is freed first so malloc hands them back in that order
+template<typename C>
+C scattered(size_t count) {
+    std::vector<void*> blocks(count);
+    for (void*& block : blocks) block = ::operator new(sizeof(Node<forward_container_value_t<C>>));
+    std::shuffle(blocks.begin(), blocks.end(), std::mt19937(42));
+    for (void* block : blocks) ::operator delete(block);
+    return filled<C>(count);
+}
+
+template<typename C>
+void BM_Traverse_Scattered_1M(benchmark::State& state) {
+    const C c = scattered<C>(1 << 20);
+    for (auto _ : state) {
+        long long sum = 0;
+        for (const auto& value : c) sum += value.words[0];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * c.size()));
+}
+
+template<typename C>
+void BM_Copy_Scattered_1M(benchmark::State& state) {
+    const C source = scattered<C>(1 << 20);
+    for (auto _ : state) {
+        C copy(source);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * source.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_Traverse_Scattered_1M, Stack<Payload<48>>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Copy_Scattered_1M, Stack<Payload<48>>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Traverse_Scattered_1M, Queue<Payload<48>>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Copy_Scattered_1M, Queue<Payload<48>>)->Unit(benchmark::kMillisecond);
+
+template<typename T> using AlignedStack = Stack<T, CacheAlignedAllocator<T>>;
+template<typename T> using AlignedQueue = Queue<T, CacheAlignedAllocator<T>>;
+
+#define FWD_BENCH_LAYOUT(C) \
+    BENCHMARK_TEMPLATE(BM_Traverse_1M, C)->Unit(benchmark::kMillisecond); \
+    BENCHMARK_TEMPLATE(BM_Copy_1M, C)->Unit(benchmark::kMillisecond)
+
+FWD_BENCH_LAYOUT(Stack<Payload<56>>);
+FWD_BENCH_LAYOUT(AlignedStack<Payload<56>>);
+FWD_BENCH_LAYOUT(Stack<Payload<48>>);
+FWD_BENCH_LAYOUT(AlignedStack<Payload<48>>);
+FWD_BENCH_LAYOUT(Queue<Payload<48>>);
+FWD_BENCH_LAYOUT(AlignedQueue<Payload<48>>);
+FWD_BENCH_LAYOUT(Stack<Large>);
+FWD_BENCH_LAYOUT(AlignedStack<Large>);
+
+// Copy construction, copy assignment and clear of large containers
+template<typename C>
+void BM_Copy(benchmark::State& state) {
+    const C source = filled<C>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        C copy(source);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * source.size()));
+}
+
+template<typename C>
+void BM_Assign(benchmark::State& state) {
+    const C source = filled<C>(static_cast<size_t>(state.range(0)));
+    C target = filled<C>(static_cast<size_t>(state.range(0)) / 2);
+    for (auto _ : state) {
+        target = source;
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * source.size()));
+}
+
+template<typename C>
+void BM_Clear(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        C c = filled<C>(count);
+        state.ResumeTiming();
+        c.clear();
+        benchmark::DoNotOptimize(c);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+#define FWD_BENCH_COPY(C) \
+    BENCHMARK_TEMPLATE(BM_Copy, C)->Arg(1 << 18); \
+    BENCHMARK_TEMPLATE(BM_Assign, C)->Arg(1 << 18); \
+    BENCHMARK_TEMPLATE(BM_Clear, C)->Arg(1 << 18)
+
+FWD_BENCH_COPY(Stack<int>);
+FWD_BENCH_COPY(Queue<int>);
+FWD_BENCH_COPY(ChunkedStack<int>);
+FWD_BENCH_COPY(ChunkedQueue<int>);
+FWD_BENCH_COPY(ContiguousStack<int>);
+FWD_BENCH_COPY(Deque<int>);
+FWD_BENCH_COPY(StdDeque<int>);
+
+// Stream output and input with print/read
+template<typename C>
+void BM_Print(benchmark::State& state) {
+    const C c = filled<C>(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::ostringstream os;
+        os << c;
+        benchmark::DoNotOptimize(os.str().size());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * c.size()));
+}
+
+template<typename C>
+void BM_Read(benchmark::State& state) {
+    std::ostringstream os;
+    os << filled<C>(static_cast<size_t>(state.range(0)));
+    const std::string text = os.str();
+    C c;
+    for (auto _ : state) {
+        c.clear();
+        std::istringstream is(text);
+        is >> c;
+        benchmark::DoNotOptimize(c);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * c.size()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+}
+
+#define FWD_BENCH_STREAM(C) \
+    BENCHMARK_TEMPLATE(BM_Print, C)->Arg(1 << 16); \
+    BENCHMARK_TEMPLATE(BM_Read, C)->Arg(1 << 16)
+
+FWD_BENCH_STREAM(Stack<int>);
+FWD_BENCH_STREAM(Queue<int>);
+FWD_BENCH_STREAM(ChunkedQueue<int>);
+FWD_BENCH_STREAM(ContiguousStack<int>);
+FWD_BENCH_STREAM(Deque<int>);
+
+// Contention: every thread pushes and pops the same shared container
+template<typename C>
+void BM_Contended_Push_Pop(benchmark::State& state) {
+    static C shared;
+    int value = 0;
+    for (auto _ : state) {
+        shared.push(value++);
+        benchmark::DoNotOptimize(shared.try_pop());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 2));
+}
+
+// Baseline for the lock-free containers: a std::queue behind one mutex
+template<typename T>
+class LockedQueue {
+public:
+    void push(const T& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        items.push(value);
+    }
+
+    std::optional<T> try_pop() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (items.empty()) return std::nullopt;
+        T value = std::move(items.front());
+        items.pop();
+        return value;
+    }
+
+private:
+    std::mutex mutex;
+    std::queue<T> items;
+};
+
+BENCHMARK_TEMPLATE(BM_Contended_Push_Pop, ConcurrentQueue<int>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Contended_Push_Pop, ConcurrentStack<int>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Contended_Push_Pop, LockedQueue<int>)->ThreadRange(1, 8)->UseRealTime();
+
+// One producer thread and one consumer thread handing elements over a bounded ring
+template<typename C>
+void BM_Producer_Consumer(benchmark::State& state) {
+    static C shared;
+    if (state.thread_index() == 0) {
+        int value = 0;
+        for (auto _ : state) shared.push(value++);
+    } else {
+        for (auto _ : state) benchmark::DoNotOptimize(shared.pop());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK_TEMPLATE(BM_Producer_Consumer, SpscQueue<int, 1024>)->Threads(2)->UseRealTime();
+
+BENCHMARK_MAIN();
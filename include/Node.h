@@ -1,13 +1,22 @@
 #pragma once
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
 /**
  * @brief Node structure for Stack implementation using singly linked list
  * @tparam T Type of data stored in the node
+ * 
+ * The link comes first so that it shares the first cache line of the node with the
+ * start of the data whatever the size of T; traversals then touch one line per node
+ * before moving on. Allocate through CacheAlignedAllocator to also start every node on
+ * its own cache line.
  */
 template<typename T>
 struct Node {
-    T data;           ///< Data stored in the node
     Node<T>* next;    ///< Pointer to the next node in the stack
+    T data;           ///< Data stored in the node
     
     /**
      * @brief Constructs a new Node with copy semantics
@@ -22,6 +31,116 @@ struct Node {
      * @param next_node Pointer to the next node (default: nullptr)
      */
     Node(T&& value, Node<T>* next_node = nullptr);
+
+    /**
+     * @brief Constructs a new Node whose data is built in place from arbitrary arguments
+     * @param next_node Pointer to the next node
+     * @param args Arguments forwarded to the T constructor
+     */
+    template<typename... Args>
+    Node(std::in_place_t, Node<T>* next_node, Args&&... args);
 };
 
-#include "Node.ipp"
\ No newline at end of file
+/**
+ * @brief Hints the CPU to start loading a node that will be visited soon
+ * @tparam NodeType Node type
+ * @param node Node to prefetch (may be nullptr; prefetching never faults)
+ * 
+ * Traversal loops call it with the successor of the node they are working on, so the
+ * cache miss on the next node overlaps the work on the current one.
+ */
+template<typename NodeType>
+void prefetch_node(const NodeType* node) noexcept;
+
+/**
+ * @brief Allocates storage for a node through an allocator and constructs it there
+ * @tparam NodeAlloc Allocator whose value_type is a Node<T>
+ * @param alloc Allocator providing the storage
+ * @param args Arguments forwarded to the Node constructor
+ * @return Pointer to the constructed node
+ * @throws Whatever the allocator or the Node constructor throws; storage is released first
+ */
+template<typename NodeAlloc, typename... Args>
+typename std::allocator_traits<NodeAlloc>::value_type* create_node(NodeAlloc& alloc, Args&&... args);
+
+/**
+ * @brief Destroys a node and returns its storage to the allocator it came from
+ * @tparam NodeAlloc Allocator whose value_type is a Node<T>
+ * @param alloc Allocator that provided the storage
+ * @param node Node to destroy (must not be nullptr)
+ */
+template<typename NodeAlloc>
+void destroy_node(NodeAlloc& alloc, typename std::allocator_traits<NodeAlloc>::value_type* node) noexcept;
+
+/**
+ * @brief Destroys every node of a nullptr-terminated chain
+ * @tparam NodeAlloc Allocator whose value_type is a Node<T>
+ * @param alloc Allocator that provided the storage
+ * @param head First node of the chain (may be nullptr)
+ */
+template<typename NodeAlloc>
+void destroy_chain(NodeAlloc& alloc, typename std::allocator_traits<NodeAlloc>::value_type* head) noexcept;
+
+/**
+ * @brief Detects allocators that can prepare for a run of single-object allocations
+ * @tparam NodeAlloc Allocator type
+ */
+template<typename NodeAlloc, typename = void>
+struct allocator_has_reserve : std::false_type {};
+
+template<typename NodeAlloc>
+struct allocator_has_reserve<NodeAlloc, std::void_t<decltype(std::declval<NodeAlloc&>().reserve(size_t()))>>
+    : std::true_type {};
+
+/**
+ * @brief Tells the allocator that count nodes are about to be allocated one by one
+ * @tparam NodeAlloc Allocator whose value_type is a Node<T>
+ * @param alloc Allocator that will provide the storage
+ * @param count Number of nodes that will be created
+ * @throws Whatever the allocator's reserve() throws; a no-op for allocators without one
+ */
+template<typename NodeAlloc>
+void reserve_nodes(NodeAlloc& alloc, size_t count);
+
+/**
+ * @brief Copies a chain of count nodes into freshly allocated nodes
+ * @tparam NodeAlloc Allocator whose value_type is a Node<T>
+ * @param alloc Allocator providing the storage (reserved for count nodes up front)
+ * @param source First node to copy
+ * @param count Number of nodes to copy (source must have at least that many)
+ * @param last Receives the last node of the copy (nullptr if count is 0)
+ * @return First node of the copy, terminated by nullptr
+ * @throws Whatever the allocator or the copy constructor of T throws; nothing is leaked
+ */
+template<typename NodeAlloc>
+typename std::allocator_traits<NodeAlloc>::value_type* copy_chain(
+    NodeAlloc& alloc,
+    const typename std::allocator_traits<NodeAlloc>::value_type* source,
+    size_t count,
+    typename std::allocator_traits<NodeAlloc>::value_type*& last);
+
+/**
+ * @brief Detects allocators that can drop everything they handed out in one call
+ * @tparam NodeAlloc Allocator type
+ */
+template<typename NodeAlloc, typename = void>
+struct allocator_has_release_exclusive : std::false_type {};
+
+template<typename NodeAlloc>
+struct allocator_has_release_exclusive<NodeAlloc, std::void_t<decltype(std::declval<NodeAlloc&>().release_exclusive())>>
+    : std::true_type {};
+
+/**
+ * @brief Frees every node of an allocator at once, without visiting them
+ * @tparam NodeAlloc Allocator whose value_type is the node type
+ * @param alloc Allocator that provided every live node
+ * @return True if the storage was released, false if the allocator cannot do it
+ *         (no release_exclusive(), or its storage is shared) and nothing happened
+ * 
+ * Only valid when destroying the nodes would be a no-op, i.e. the node type is
+ * trivially destructible and the allocator does not customize destroy().
+ */
+template<typename NodeAlloc>
+bool release_all_nodes(NodeAlloc& alloc) noexcept;
+
+#include "Node.ipp"
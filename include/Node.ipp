@@ -3,8 +3,106 @@
 // Node constructors
 template<typename T>
 Node<T>::Node(const T& value, Node<T>* next_node) 
-    : data(value), next(next_node) {}
+    : next(next_node), data(value) {}
 
 template<typename T>
 Node<T>::Node(T&& value, Node<T>* next_node) 
-    : data(std::move(value)), next(next_node) {}
+    : next(next_node), data(std::move(value)) {}
+
+template<typename T>
+template<typename... Args>
+Node<T>::Node(std::in_place_t, Node<T>* next_node, Args&&... args)
+    : next(next_node), data(std::forward<Args>(args)...) {}
+
+// Traversal
+template<typename NodeType>
+void prefetch_node(const NodeType* node) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(node);
+#else
+    (void)node;
+#endif
+}
+
+// Allocator-aware node lifetime
+template<typename NodeAlloc, typename... Args>
+typename std::allocator_traits<NodeAlloc>::value_type* create_node(NodeAlloc& alloc, Args&&... args) {
+    using traits = std::allocator_traits<NodeAlloc>;
+
+    auto node = traits::allocate(alloc, 1);
+    try {
+        traits::construct(alloc, node, std::forward<Args>(args)...);
+    }
+    catch (...) {
+        traits::deallocate(alloc, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template<typename NodeAlloc>
+void destroy_node(NodeAlloc& alloc, typename std::allocator_traits<NodeAlloc>::value_type* node) noexcept {
+    using traits = std::allocator_traits<NodeAlloc>;
+
+    traits::destroy(alloc, node);
+    traits::deallocate(alloc, node, 1);
+}
+
+template<typename NodeAlloc>
+void destroy_chain(NodeAlloc& alloc, typename std::allocator_traits<NodeAlloc>::value_type* head) noexcept {
+    while (head != nullptr) {
+        auto next = head->next;
+        prefetch_node(next);
+        destroy_node(alloc, head);
+        head = next;
+    }
+}
+
+template<typename NodeAlloc>
+void reserve_nodes(NodeAlloc& alloc, size_t count) {
+    if constexpr (allocator_has_reserve<NodeAlloc>::value) {
+        if (count > 0) alloc.reserve(count);
+    }
+}
+
+template<typename NodeAlloc>
+typename std::allocator_traits<NodeAlloc>::value_type* copy_chain(
+    NodeAlloc& alloc,
+    const typename std::allocator_traits<NodeAlloc>::value_type* source,
+    size_t count,
+    typename std::allocator_traits<NodeAlloc>::value_type*& last) {
+    using node_type = typename std::allocator_traits<NodeAlloc>::value_type;
+
+    node_type* head = nullptr;
+    last = nullptr;
+    if (count == 0) return nullptr;
+
+    reserve_nodes(alloc, count);
+    try {
+        for (; count > 0; --count, source = source->next) {
+            prefetch_node(source->next);
+            node_type* copy = create_node(alloc, source->data);
+            if (last == nullptr) {
+                head = copy;
+            } else {
+                last->next = copy;
+            }
+            last = copy;
+        }
+    }
+    catch (...) {
+        destroy_chain(alloc, head);
+        last = nullptr;
+        throw;
+    }
+    return head;
+}
+
+template<typename NodeAlloc>
+bool release_all_nodes(NodeAlloc& alloc) noexcept {
+    if constexpr (allocator_has_release_exclusive<NodeAlloc>::value) {
+        return alloc.release_exclusive();
+    } else {
+        return false;
+    }
+}
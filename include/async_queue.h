@@ -0,0 +1,260 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>)
+#include <coroutine>
+#define FWD_HAS_COROUTINES 1
+#else
+#define FWD_HAS_COROUTINES 0
+#endif
+
+#include "concurrent_queue.h"
+
+#if FWD_HAS_COROUTINES
+/**
+ * @brief Multi-producer/multi-consumer FIFO queue whose consumers are C++20 coroutines
+ * @tparam T The type of elements stored in the queue
+ * @tparam Alloc Allocator for the elements, passed to the underlying ConcurrentQueue
+ *
+ * co_await q.pop() completes at once when an element is available and otherwise suspends
+ * the coroutine, which costs no thread: the thread that ran it goes back to whatever
+ * resumed the coroutine in the first place. push() resumes the longest-waiting suspended
+ * consumer, on the pushing thread, before returning; that consumer then runs until its
+ * next suspension point. Thousands of pipeline stages can so wait on a few threads.
+ *
+ * Elements live in a lock-free ConcurrentQueue<T>. Suspended consumers are linked into
+ * an intrusive FIFO through a node inside their awaiter, so suspending never allocates
+ * and cannot fail once the consumer has counted itself as waiting. A signed counter
+ * pairs the two: it holds the number of elements not yet claimed by a
+ * consumer, or minus the number of suspended consumers. A push that finds it negative
+ * owes its element to a waiter and resumes one; a consumer that drives it negative
+ * suspends. Both sides decide with one atomic read-modify-write, so no wake-up is lost.
+ *
+ * Only available when built as C++20 with coroutine support (FWD_HAS_COROUTINES). The
+ * queue must outlive every coroutine suspended on it.
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+class AsyncQueue {
+private:
+    /**
+     * @brief Waiter list node, embedded in the awaiter of a suspending consumer
+     */
+    struct waiter_link {
+        std::atomic<waiter_link*> next{nullptr}; ///< Next waiter in arrival order
+        std::coroutine_handle<> handle;          ///< Coroutine to resume
+    };
+
+public:
+    using allocator_type = Alloc;
+
+    /**
+     * @brief Awaitable returned by pop(); co_await yields the front element
+     */
+    class pop_awaiter {
+    private:
+        AsyncQueue* queue; ///< Queue to take the element from
+        waiter_link link;  ///< Node linked into the waiter list while suspended
+
+    public:
+        /**
+         * @brief Constructor
+         * @param q Queue to take the element from
+         */
+        explicit pop_awaiter(AsyncQueue& q) noexcept : queue(&q) {}
+
+        /**
+         * @brief Claim an element without suspending if one is available
+         * @return True if an element was claimed
+         */
+        bool await_ready() noexcept { return queue->try_claim(); }
+
+        /**
+         * @brief Claim an element or register the coroutine as a waiter
+         * @param waiter The awaiting coroutine
+         * @return False if an element was claimed after all, true if the coroutine is suspended
+         */
+        bool await_suspend(std::coroutine_handle<> waiter) noexcept { return queue->claim_or_wait(link, waiter); }
+
+        /**
+         * @brief Take the claimed element
+         * @return The removed element
+         */
+        T await_resume() { return queue->take(); }
+    };
+
+    /**
+     * @brief Awaitable returned by pop_batch(); co_await yields between 1 and n elements
+     */
+    class batch_awaiter {
+    private:
+        AsyncQueue* queue; ///< Queue to take the elements from
+        size_t limit;      ///< Largest number of elements to take
+        waiter_link link;  ///< Node linked into the waiter list while suspended
+
+    public:
+        /**
+         * @brief Constructor
+         * @param q Queue to take the elements from
+         * @param n Largest number of elements to take
+         */
+        batch_awaiter(AsyncQueue& q, size_t n) noexcept : queue(&q), limit(n) {}
+
+        /**
+         * @brief Claim an element without suspending if one is available
+         * @return True if an element was claimed
+         */
+        bool await_ready() noexcept { return queue->try_claim(); }
+
+        /**
+         * @brief Claim an element or register the coroutine as a waiter
+         * @param waiter The awaiting coroutine
+         * @return False if an element was claimed after all, true if the coroutine is suspended
+         */
+        bool await_suspend(std::coroutine_handle<> waiter) noexcept { return queue->claim_or_wait(link, waiter); }
+
+        /**
+         * @brief Take the claimed element and as many more as are available, up to the limit
+         * @return The removed elements in FIFO order
+         */
+        std::vector<T> await_resume() {
+            std::vector<T> batch;
+            batch.push_back(queue->take());
+            while (batch.size() < limit && queue->try_claim()) batch.push_back(queue->take());
+            return batch;
+        }
+    };
+
+    /**
+     * @brief Default constructor - creates an empty queue
+     */
+    AsyncQueue();
+
+    /**
+     * @brief Creates an empty queue that allocates its nodes through the given allocator
+     * @param alloc Allocator to use for the element nodes
+     */
+    explicit AsyncQueue(const Alloc& alloc);
+
+    AsyncQueue(const AsyncQueue&) = delete;
+    AsyncQueue& operator=(const AsyncQueue&) = delete;
+
+    /**
+     * @brief Add element to the back of the queue and resume one waiting consumer, if any (copy semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     */
+    void push(const T& value);
+
+    /**
+     * @brief Add element to the back of the queue and resume one waiting consumer, if any (move semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     */
+    void push(T&& value);
+
+    /**
+     * @brief Construct an element in place at the back of the queue and resume one waiting consumer, if any
+     * @param args Arguments forwarded to the T constructor
+     * @throws std::runtime_error if memory allocation fails
+     */
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    /**
+     * @brief Remove the front element, suspending the awaiting coroutine while the queue is empty
+     * @return Awaitable yielding the removed element
+     */
+    pop_awaiter pop() noexcept;
+
+    /**
+     * @brief Remove up to n elements, suspending the awaiting coroutine while the queue is empty
+     * @param n Largest number of elements to take
+     * @return Awaitable yielding at least one and at most n elements; it does not wait for more
+     *         once the first one has arrived
+     * @throws std::invalid_argument if n is 0
+     */
+    batch_awaiter pop_batch(size_t n);
+
+    /**
+     * @brief Remove the front element if there is one; never suspends
+     * @return The removed element, or std::nullopt if no element was available
+     */
+    std::optional<T> try_pop();
+
+    /**
+     * @brief Check if queue has no unclaimed element at the moment of the call
+     * @return True if a pop() would suspend
+     */
+    bool is_empty() const noexcept;
+
+    /**
+     * @brief Checks if the queue has no unclaimed element at the moment of the call
+     * @return true if a pop() would suspend
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Get the number of elements not yet claimed by a consumer
+     * @return Approximate size of the queue
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Get the number of consumers suspended on the queue
+     * @return Approximate number of waiting coroutines
+     */
+    size_t waiting() const noexcept;
+
+private:
+    /**
+     * @brief Claim one element if the counter shows an unclaimed one
+     * @return True if an element was claimed
+     */
+    bool try_claim() noexcept;
+
+    /**
+     * @brief Claim one element, or enqueue the waiter to be resumed by a later push
+     * @param link Node of the awaiter, linked into the waiter list if the coroutine waits
+     * @param waiter The awaiting coroutine
+     * @return False if an element was claimed, true if the waiter was enqueued
+     */
+    bool claim_or_wait(waiter_link& link, std::coroutine_handle<> waiter) noexcept;
+
+    /**
+     * @brief Remove an element already claimed through the counter
+     * @return The removed element
+     */
+    T take();
+
+    /**
+     * @brief Hand the element just pushed to a waiter, if the counter says one is owed
+     */
+    void release_one();
+
+    /**
+     * @brief Append a waiter to the waiter list; wait-free
+     * @param link Node to append
+     */
+    void link_waiter(waiter_link& link) noexcept;
+
+    /**
+     * @brief Detach the longest-waiting waiter; callers are serialized by unlinking
+     * @return The detached node, or nullptr if none is fully linked yet
+     */
+    waiter_link* unlink_waiter() noexcept;
+
+    ConcurrentQueue<T, Alloc> items;                  ///< Elements, claimed or not
+    alignas(64) std::atomic<ptrdiff_t> available;     ///< Unclaimed elements, or minus the suspended consumers
+    alignas(64) std::atomic<waiter_link*> waiterTail; ///< Most recently linked waiter
+    alignas(64) waiter_link* waiterHead;              ///< Oldest linked node, guarded by unlinking
+    std::atomic_flag unlinking;                       ///< Held by the push that detaches a waiter
+    waiter_link waiterStub;                           ///< Placeholder that keeps the waiter list non-empty
+};
+
+#include "async_queue.ipp"
+#endif
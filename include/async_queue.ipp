@@ -0,0 +1,157 @@
+#include "async_queue.h"
+#include <thread>
+#include <utility>
+
+// AsyncQueue constructors
+template<typename T, typename Alloc>
+AsyncQueue<T, Alloc>::AsyncQueue() : AsyncQueue(Alloc()) {}
+
+template<typename T, typename Alloc>
+AsyncQueue<T, Alloc>::AsyncQueue(const Alloc& alloc)
+    : items(alloc), available(0), waiterTail(&waiterStub), waiterHead(&waiterStub) {}
+
+// Producers
+template<typename T, typename Alloc>
+void AsyncQueue<T, Alloc>::push(const T& value) {
+    emplace(value);
+}
+
+template<typename T, typename Alloc>
+void AsyncQueue<T, Alloc>::push(T&& value) {
+    emplace(std::move(value));
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+void AsyncQueue<T, Alloc>::emplace(Args&&... args) {
+    // The element is in the queue before the counter offers it to anyone
+    items.emplace(std::forward<Args>(args)...);
+    release_one();
+}
+
+template<typename T, typename Alloc>
+void AsyncQueue<T, Alloc>::release_one() {
+    if (available.fetch_add(1, std::memory_order_acq_rel) >= 0) return;
+
+    // A consumer has counted itself as waiting; it may still be on its way into the waiter list
+    waiter_link* link;
+    while ((link = unlink_waiter()) == nullptr) std::this_thread::yield();
+
+    // The link lives in the awaiter, which resuming may destroy
+    std::coroutine_handle<> waiter = link->handle;
+    waiter.resume();
+}
+
+template<typename T, typename Alloc>
+void AsyncQueue<T, Alloc>::link_waiter(waiter_link& link) noexcept {
+    link.next.store(nullptr, std::memory_order_relaxed);
+    waiter_link* previous = waiterTail.exchange(&link, std::memory_order_acq_rel);
+    previous->next.store(&link, std::memory_order_release);
+}
+
+template<typename T, typename Alloc>
+auto AsyncQueue<T, Alloc>::unlink_waiter() noexcept -> waiter_link* {
+    while (unlinking.test_and_set(std::memory_order_acquire)) std::this_thread::yield();
+
+    // Intrusive multi-producer FIFO after Vyukov: the stub stands in for the list when
+    // the last real node is detached, so linking never has to touch the head
+    waiter_link* result = nullptr;
+    waiter_link* head = waiterHead;
+    waiter_link* next = head->next.load(std::memory_order_acquire);
+    if (head == &waiterStub && next != nullptr) {
+        waiterHead = next;
+        head = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+    if (head != &waiterStub) {
+        if (next != nullptr) {
+            waiterHead = next;
+            result = head;
+        }
+        else if (waiterTail.load(std::memory_order_acquire) == head) {
+            // head is the only node: put the stub behind it so it can be detached
+            link_waiter(waiterStub);
+            next = head->next.load(std::memory_order_acquire);
+            if (next != nullptr) {
+                waiterHead = next;
+                result = head;
+            }
+        }
+    }
+
+    unlinking.clear(std::memory_order_release);
+    return result;
+}
+
+// Consumers
+template<typename T, typename Alloc>
+bool AsyncQueue<T, Alloc>::try_claim() noexcept {
+    ptrdiff_t count = available.load(std::memory_order_acquire);
+    while (count > 0) {
+        if (available.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T, typename Alloc>
+bool AsyncQueue<T, Alloc>::claim_or_wait(waiter_link& link, std::coroutine_handle<> waiter) noexcept {
+    link.handle = waiter;
+    if (available.fetch_sub(1, std::memory_order_acq_rel) > 0) return false;
+
+    // The next push that sees the negative count resumes this coroutine, possibly before
+    // link_waiter returns; nothing of the awaiter may be touched after it
+    link_waiter(link);
+    return true;
+}
+
+template<typename T, typename Alloc>
+T AsyncQueue<T, Alloc>::take() {
+    // A claim is only granted after the element was pushed, so this spins at most for the
+    // few instructions a concurrent pop needs to advance the head
+    for (;;) {
+        if (std::optional<T> value = items.try_pop()) return std::move(*value);
+        std::this_thread::yield();
+    }
+}
+
+template<typename T, typename Alloc>
+auto AsyncQueue<T, Alloc>::pop() noexcept -> pop_awaiter {
+    return pop_awaiter(*this);
+}
+
+template<typename T, typename Alloc>
+auto AsyncQueue<T, Alloc>::pop_batch(size_t n) -> batch_awaiter {
+    if (n == 0) throw std::invalid_argument("Cannot pop an empty batch from AsyncQueue");
+    return batch_awaiter(*this, n);
+}
+
+template<typename T, typename Alloc>
+std::optional<T> AsyncQueue<T, Alloc>::try_pop() {
+    if (!try_claim()) return std::nullopt;
+    return take();
+}
+
+// Observers
+template<typename T, typename Alloc>
+bool AsyncQueue<T, Alloc>::is_empty() const noexcept {
+    return available.load(std::memory_order_acquire) <= 0;
+}
+
+template<typename T, typename Alloc>
+bool AsyncQueue<T, Alloc>::empty() const noexcept {
+    return is_empty();
+}
+
+template<typename T, typename Alloc>
+size_t AsyncQueue<T, Alloc>::size() const noexcept {
+    ptrdiff_t count = available.load(std::memory_order_acquire);
+    return count > 0 ? static_cast<size_t>(count) : 0;
+}
+
+template<typename T, typename Alloc>
+size_t AsyncQueue<T, Alloc>::waiting() const noexcept {
+    ptrdiff_t count = available.load(std::memory_order_acquire);
+    return count < 0 ? static_cast<size_t>(-count) : 0;
+}
@@ -0,0 +1,273 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Encodes single elements for the binary container format
+ * @tparam T Element type
+ *
+ * The generic codec stores each element as a length-prefixed record holding the text
+ * produced by operator<<, so every type that print()/read() accept can be saved.
+ * Specialize binary_codec for a type to give it a real binary encoding; trivially
+ * copyable types and std::string already have one.
+ */
+template<typename T, typename = void>
+struct binary_codec {
+    static constexpr bool raw = false; ///< Elements are not stored as their object bytes
+
+    /**
+     * @brief Write one element
+     * @param os Output stream (opened in binary mode)
+     * @param value Element to write
+     */
+    static void write(std::ostream& os, const T& value);
+
+    /**
+     * @brief Read one element
+     * @param is Input stream (opened in binary mode)
+     * @param value Receives the element
+     * @throws std::runtime_error if the record is truncated or cannot be parsed
+     */
+    static void read(std::istream& is, T& value);
+};
+
+/**
+ * @brief Codec for trivially copyable types: the object bytes are the encoding
+ *
+ * Containers detect this case and move whole batches of elements with one stream
+ * call. The bytes are written in host byte order and layout.
+ */
+template<typename T>
+struct binary_codec<T, std::enable_if_t<std::is_trivially_copyable_v<T>>> {
+    static constexpr bool raw = true; ///< Elements are stored as their object bytes
+
+    static void write(std::ostream& os, const T& value) {
+        os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    static void read(std::istream& is, T& value) {
+        if (!is.read(reinterpret_cast<char*>(&value), sizeof(T))) {
+            throw std::runtime_error("Unexpected end of binary data");
+        }
+    }
+};
+
+/**
+ * @brief Writes an unsigned integer in host byte order
+ * @tparam U Unsigned integer type
+ * @param os Output stream
+ * @param value Value to write
+ */
+template<typename U>
+inline void binary_write_uint(std::ostream& os, U value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(U));
+}
+
+/**
+ * @brief Reads an unsigned integer written by binary_write_uint
+ * @tparam U Unsigned integer type
+ * @param is Input stream
+ * @return The value read
+ * @throws std::runtime_error if the stream ends early
+ */
+template<typename U>
+inline U binary_read_uint(std::istream& is) {
+    U value;
+    if (!is.read(reinterpret_cast<char*>(&value), sizeof(U))) {
+        throw std::runtime_error("Unexpected end of binary data");
+    }
+    return value;
+}
+
+/**
+ * @brief Reads a length-prefixed byte record into a string
+ * @param is Input stream
+ * @param bytes Receives the record contents
+ * @throws std::runtime_error if the stream ends early
+ */
+inline void binary_read_record(std::istream& is, std::string& bytes) {
+    uint64_t length = binary_read_uint<uint64_t>(is);
+    bytes.clear();
+
+    // Grow with the data actually present instead of trusting the prefix up front
+    char buffer[4096];
+    while (length > 0) {
+        size_t part = length < sizeof(buffer) ? static_cast<size_t>(length) : sizeof(buffer);
+        if (!is.read(buffer, static_cast<std::streamsize>(part))) {
+            throw std::runtime_error("Unexpected end of binary data");
+        }
+        bytes.append(buffer, part);
+        length -= part;
+    }
+}
+
+/**
+ * @brief Codec for std::string: a length prefix followed by the characters
+ */
+template<>
+struct binary_codec<std::string> {
+    static constexpr bool raw = false;
+
+    static void write(std::ostream& os, const std::string& value) {
+        binary_write_uint<uint64_t>(os, value.size());
+        os.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+
+    static void read(std::istream& is, std::string& value) {
+        binary_read_record(is, value);
+    }
+};
+
+template<typename T, typename Enable>
+void binary_codec<T, Enable>::write(std::ostream& os, const T& value) {
+    std::ostringstream text;
+    text << value;
+    if (!text) throw std::runtime_error("Failed to format element");
+    const std::string bytes = text.str();
+    binary_write_uint<uint64_t>(os, bytes.size());
+    os.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+template<typename T, typename Enable>
+void binary_codec<T, Enable>::read(std::istream& is, T& value) {
+    std::string bytes;
+    binary_read_record(is, bytes);
+    std::istringstream text(bytes);
+    if (!(text >> value)) throw std::runtime_error("Failed to parse element");
+}
+
+/**
+ * @brief Header preceding the elements of a saved container
+ *
+ * Layout: the magic "FWDC", a 16-bit format version, 16 bits of flags, the 32-bit size
+ * of a raw element (0 unless the raw flag is set) and the 64-bit element count.
+ */
+struct binary_header {
+    static constexpr char magic[4] = {'F', 'W', 'D', 'C'}; ///< File signature
+    static constexpr uint16_t version = 1;                   ///< Current format version
+    static constexpr uint16_t raw_flag = 1;                  ///< Elements are stored as object bytes
+
+    uint16_t flags;       ///< Format flags
+    uint32_t elementSize; ///< sizeof(T) for raw elements, 0 otherwise
+    uint64_t count;       ///< Number of elements that follow
+};
+
+/**
+ * @brief Writes the header for count elements of type T
+ * @tparam T Element type
+ * @param os Output stream
+ * @param count Number of elements that will follow
+ */
+template<typename T>
+void binary_write_header(std::ostream& os, size_t count) {
+    constexpr bool raw = binary_codec<T>::raw;
+    os.write(binary_header::magic, sizeof(binary_header::magic));
+    binary_write_uint<uint16_t>(os, binary_header::version);
+    binary_write_uint<uint16_t>(os, raw ? binary_header::raw_flag : 0);
+    binary_write_uint<uint32_t>(os, raw ? static_cast<uint32_t>(sizeof(T)) : 0);
+    binary_write_uint<uint64_t>(os, count);
+}
+
+/**
+ * @brief Reads and validates a header written for elements of type T
+ * @tparam T Element type expected by the caller
+ * @param is Input stream
+ * @return The decoded header
+ * @throws std::runtime_error on a bad signature, an unknown version or an element layout that does not match T
+ */
+template<typename T>
+binary_header binary_read_header(std::istream& is) {
+    char magic[sizeof(binary_header::magic)];
+    if (!is.read(magic, sizeof(magic))) throw std::runtime_error("Unexpected end of binary data");
+    if (std::memcmp(magic, binary_header::magic, sizeof(magic)) != 0) {
+        throw std::runtime_error("Not a binary container stream");
+    }
+    if (binary_read_uint<uint16_t>(is) != binary_header::version) {
+        throw std::runtime_error("Unsupported binary format version");
+    }
+
+    binary_header header;
+    header.flags = binary_read_uint<uint16_t>(is);
+    header.elementSize = binary_read_uint<uint32_t>(is);
+    header.count = binary_read_uint<uint64_t>(is);
+
+    constexpr bool raw = binary_codec<T>::raw;
+    bool stored_raw = (header.flags & binary_header::raw_flag) != 0;
+    if (stored_raw != raw || (raw && header.elementSize != sizeof(T))) {
+        throw std::runtime_error("Binary data was saved for a different element type");
+    }
+    return header;
+}
+
+/**
+ * @brief Writes the elements of [first, last) with the codec for T
+ * @tparam T Element type
+ * @tparam InputIt Iterator over const T
+ * @param os Output stream
+ * @param first Start of the range
+ * @param last End of the range
+ *
+ * Raw elements are gathered into a buffer and written a batch at a time.
+ */
+template<typename T, typename InputIt>
+void binary_write_elements(std::ostream& os, InputIt first, InputIt last) {
+    if constexpr (binary_codec<T>::raw) {
+        constexpr size_t batch = 4096 / sizeof(T) > 0 ? 4096 / sizeof(T) : 1;
+        alignas(T) char buffer[batch * sizeof(T)];
+        size_t filled = 0;
+        for (; first != last; ++first) {
+            std::memcpy(buffer + filled * sizeof(T), std::addressof(*first), sizeof(T));
+            if (++filled == batch) {
+                os.write(buffer, static_cast<std::streamsize>(filled * sizeof(T)));
+                filled = 0;
+            }
+        }
+        os.write(buffer, static_cast<std::streamsize>(filled * sizeof(T)));
+    } else {
+        for (; first != last; ++first) binary_codec<T>::write(os, *first);
+    }
+}
+
+/**
+ * @brief Reads count elements with the codec for T, handing each to a sink
+ * @tparam T Element type
+ * @tparam Sink Callable taking T&&
+ * @param is Input stream
+ * @param count Number of elements to read
+ * @param sink Receives the elements in stream order
+ * @throws std::runtime_error if the stream ends early or an element cannot be decoded
+ *
+ * Raw elements are read a batch at a time and copied straight out of the buffer.
+ */
+template<typename T, typename Sink>
+void binary_read_elements(std::istream& is, uint64_t count, Sink&& sink) {
+    if constexpr (binary_codec<T>::raw) {
+        constexpr size_t batch = 4096 / sizeof(T) > 0 ? 4096 / sizeof(T) : 1;
+        alignas(T) char buffer[batch * sizeof(T)];
+        while (count > 0) {
+            size_t part = count < batch ? static_cast<size_t>(count) : batch;
+            if (!is.read(buffer, static_cast<std::streamsize>(part * sizeof(T)))) {
+                throw std::runtime_error("Unexpected end of binary data");
+            }
+            for (size_t i = 0; i < part; ++i) {
+                sink(std::move(*std::launder(reinterpret_cast<T*>(buffer + i * sizeof(T)))));
+            }
+            count -= part;
+        }
+    } else {
+        for (; count > 0; --count) {
+            T value;
+            binary_codec<T>::read(is, value);
+            sink(std::move(value));
+        }
+    }
+}
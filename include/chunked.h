@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief Storage policy tag selecting the unrolled (chunked) layout for Stack and Queue
+ * @tparam ChunkCapacity Number of elements stored contiguously in each chunk
+ * @tparam Alloc Allocator, rebound internally to Chunk<T, ChunkCapacity> (default: std::allocator<void>)
+ * 
+ * Used in place of the allocator parameter: Queue<T, Chunked<64>> and Stack<T, Chunked<64>>
+ * keep up to ChunkCapacity elements per node, so node overhead is paid once per chunk
+ * and forward scans walk contiguous memory.
+ */
+template<size_t ChunkCapacity, typename Alloc = std::allocator<void>>
+struct Chunked {
+    static_assert(ChunkCapacity > 0, "Chunked storage needs a capacity of at least one element");
+
+    static constexpr size_t capacity = ChunkCapacity; ///< Elements per chunk
+    using allocator_type = Alloc;                      ///< Allocator the chunks are drawn from
+};
+
+/**
+ * @brief Node of an unrolled list holding up to N elements in raw inline storage
+ * @tparam T Type of elements stored in the chunk
+ * @tparam N Capacity of the chunk
+ * 
+ * Slots [begin, end) hold constructed elements; the rest is uninitialized.
+ */
+template<typename T, size_t N>
+struct Chunk {
+    Chunk<T, N>* next; ///< Pointer to the next chunk in the list
+    size_t begin;      ///< Index of the first constructed slot
+    size_t end;        ///< Index one past the last constructed slot
+    alignas(T) unsigned char storage[N * sizeof(T)]; ///< Raw storage for the elements
+
+    /**
+     * @brief Constructs an empty chunk
+     * @param next_chunk Pointer to the next chunk (default: nullptr)
+     */
+    Chunk(Chunk<T, N>* next_chunk = nullptr) : next(next_chunk), begin(0), end(0) {}
+
+    /**
+     * @brief Returns a pointer to the given slot
+     * @param index Slot index in [0, N)
+     * @return Pointer to the slot storage
+     */
+    T* slot(size_t index) noexcept {
+        return reinterpret_cast<T*>(storage) + index;
+    }
+
+    /**
+     * @brief Returns a pointer to the given slot (const version)
+     * @param index Slot index in [0, N)
+     * @return Const pointer to the slot storage
+     */
+    const T* slot(size_t index) const noexcept {
+        return reinterpret_cast<const T*>(storage) + index;
+    }
+
+    /**
+     * @brief Number of constructed elements in the chunk
+     * @return Element count
+     */
+    size_t count() const noexcept { return end - begin; }
+};
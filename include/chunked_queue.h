@@ -0,0 +1,599 @@
+#pragma once
+#include <iostream>
+#include <memory>
+#include <exception>
+#include <sstream>
+
+#include "chunked.h"
+#include "queue.h"
+
+/**
+ * @brief A queue implementation using an unrolled list of chunks
+ * @tparam T The type of elements stored in the queue
+ * @tparam N Number of elements stored per chunk
+ * @tparam Alloc Allocator, rebound internally to Chunk<T, N>
+ *
+ * Elements are pushed into the free tail of the rear chunk and popped from the
+ * head of the front chunk. A new chunk is allocated only when the rear chunk is
+ * full, and a chunk is released once all of its elements have been popped.
+ */
+template<typename T, size_t N, typename Alloc>
+class Queue<T, Chunked<N, Alloc>> final : public fwd_container<T> {
+public:
+    /**
+     * @brief Iterator implementation for chunked Queue (non-const version)
+     */
+    class chunked_queue_iterator {
+    private:
+        Chunk<T, N>* chunk; ///< Current chunk pointer (nullptr at the end)
+        size_t index;       ///< Current slot within the chunk
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = T*;
+        using reference         = T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        chunked_queue_iterator() : chunk(nullptr), index(0) {}
+
+        /**
+         * @brief Constructor
+         * @param c Starting chunk for iteration
+         * @param i Starting slot within the chunk
+         */
+        chunked_queue_iterator(Chunk<T, N>* c, size_t i) : chunk(c), index(i) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Reference to the current element
+         */
+        T& operator*() const {
+            return *chunk->slot(index);
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Pointer to the current element
+         */
+        T* operator->() const {
+            return chunk->slot(index);
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        chunked_queue_iterator& operator++() {
+            if (++index == chunk->end) {
+                chunk = chunk->next;
+                index = chunk ? chunk->begin : 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        chunked_queue_iterator operator++(int) {
+            chunked_queue_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Advance by several elements, jumping over whole chunks
+         * @param n Number of elements to skip (at most the distance to the end)
+         * @return Reference to this iterator
+         */
+        chunked_queue_iterator& skip(size_t n) {
+            while (n > 0) {
+                const size_t left = chunk->end - index;
+                if (n < left) {
+                    index += n;
+                    break;
+                }
+                n -= left;
+                chunk = chunk->next;
+                index = chunk ? chunk->begin : 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same slot
+         */
+        friend bool operator==(const chunked_queue_iterator& lhs, const chunked_queue_iterator& rhs) {
+            return lhs.chunk == rhs.chunk && lhs.index == rhs.index;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different slots
+         */
+        friend bool operator!=(const chunked_queue_iterator& lhs, const chunked_queue_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the current chunk pointer
+         * @return Pointer to current chunk
+         */
+        Chunk<T, N>* get_chunk() const { return chunk; }
+
+        /**
+         * @brief Get the current slot index
+         * @return Slot index within the current chunk
+         */
+        size_t get_index() const { return index; }
+    };
+
+    /**
+     * @brief Const iterator implementation for chunked Queue
+     */
+    class chunked_queue_const_iterator {
+    private:
+        const Chunk<T, N>* chunk; ///< Current chunk pointer (nullptr at the end)
+        size_t index;             ///< Current slot within the chunk
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = const T*;
+        using reference         = const T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        chunked_queue_const_iterator() : chunk(nullptr), index(0) {}
+
+        /**
+         * @brief Constructor
+         * @param c Starting chunk for iteration
+         * @param i Starting slot within the chunk
+         */
+        chunked_queue_const_iterator(const Chunk<T, N>* c, size_t i) : chunk(c), index(i) {}
+
+        /**
+         * @brief Constructor from non-const iterator
+         * @param other Iterator to convert from
+         */
+        chunked_queue_const_iterator(const chunked_queue_iterator& other) : chunk(other.get_chunk()), index(other.get_index()) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Const reference to the current element
+         */
+        const T& operator*() const {
+            return *chunk->slot(index);
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Const pointer to the current element
+         */
+        const T* operator->() const {
+            return chunk->slot(index);
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        chunked_queue_const_iterator& operator++() {
+            if (++index == chunk->end) {
+                chunk = chunk->next;
+                index = chunk ? chunk->begin : 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        chunked_queue_const_iterator operator++(int) {
+            chunked_queue_const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Advance by several elements, jumping over whole chunks
+         * @param n Number of elements to skip (at most the distance to the end)
+         * @return Reference to this iterator
+         */
+        chunked_queue_const_iterator& skip(size_t n) {
+            while (n > 0) {
+                const size_t left = chunk->end - index;
+                if (n < left) {
+                    index += n;
+                    break;
+                }
+                n -= left;
+                chunk = chunk->next;
+                index = chunk ? chunk->begin : 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same slot
+         */
+        friend bool operator==(const chunked_queue_const_iterator& lhs, const chunked_queue_const_iterator& rhs) {
+            return lhs.chunk == rhs.chunk && lhs.index == rhs.index;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different slots
+         */
+        friend bool operator!=(const chunked_queue_const_iterator& lhs, const chunked_queue_const_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the current chunk pointer
+         * @return Const pointer to current chunk
+         */
+        const Chunk<T, N>* get_chunk() const { return chunk; }
+
+        /**
+         * @brief Get the current slot index
+         * @return Slot index within the current chunk
+         */
+        size_t get_index() const { return index; }
+    };
+
+    using iterator = chunked_queue_iterator;
+    using const_iterator = chunked_queue_const_iterator;
+    using allocator_type = Alloc;
+
+    static constexpr size_t chunk_capacity = N; ///< Elements per chunk
+
+    /**
+     * @brief Default constructor - creates an empty queue
+     */
+    Queue();
+
+    /**
+     * @brief Creates an empty queue that allocates its chunks through the given allocator
+     * @param alloc Allocator to use for all chunks of this queue
+     */
+    explicit Queue(const Alloc& alloc);
+
+    /**
+     * @brief Copy constructor - creates a deep copy of another queue
+     * @param other Queue to copy from
+     * @throws std::runtime_error if memory allocation fails during copying
+     */
+    Queue(const Queue& other);
+
+    /**
+     * @brief Move constructor - transfers ownership from another queue
+     * @param other Queue to move from (will be left in valid but empty state)
+     */
+    Queue(Queue&& other);
+
+    /**
+     * @brief Copy assignment operator
+     * @param other Queue to copy from
+     * @return Reference to this queue
+     * @throws std::runtime_error if memory allocation fails during copying
+     */
+    Queue& operator=(const Queue& other);
+
+    /**
+     * @brief Move assignment operator
+     * @param other Queue to move from
+     * @return Reference to this queue
+     */
+    Queue& operator=(Queue&& other);
+
+    /**
+     * @brief Virtual destructor
+     */
+    ~Queue();
+
+    // fwd_container interface implementation
+    /**
+     * @brief Add element to the back of the queue (copy semantics)
+     * @param value The value to add
+     */
+    void push(const T& value) override;
+
+    /**
+     * @brief Add element to the back of the queue (move semantics)
+     * @param value The value to add
+     */
+    void push(T&& value) override;
+
+    /**
+     * @brief Construct an element in place on the back of the queue
+     * @param args Arguments forwarded to the T constructor
+     * @return Reference to the new element
+     * @throws std::runtime_error if memory allocation fails
+     */
+    template<typename... Args>
+    T& emplace(Args&&... args);
+
+    /**
+     * @brief Remove and return element from the front of the queue
+     * @return The removed element from front
+     * @throws std::runtime_error if queue is empty
+     */
+    T pop() override;
+
+    /**
+     * @brief Get reference to the front element
+     * @return Reference to the front element
+     * @throws std::runtime_error if queue is empty
+     */
+    T& get_front() override;
+
+    /**
+     * @brief Get const reference to the front element
+     * @return Const reference to the front element
+     * @throws std::runtime_error if queue is empty
+     */
+    const T& get_front() const override;
+
+    /**
+     * @brief Remove the front element if there is one; never throws on empty
+     * @param out Receives the removed element
+     * @return True if an element was removed, false if the queue was empty
+     */
+    bool try_pop(T& out) override;
+
+    /**
+     * @brief Remove the front element if there is one; never throws on empty
+     * @return The removed element, or std::nullopt if the queue was empty
+     */
+    std::optional<T> try_pop() override;
+
+    /**
+     * @brief Get pointer to the front element
+     * @return Pointer to the front element, or nullptr if the queue is empty
+     */
+    T* try_front() noexcept override;
+
+    /**
+     * @brief Get const pointer to the front element
+     * @return Const pointer to the front element, or nullptr if the queue is empty
+     */
+    const T* try_front() const noexcept override;
+
+    /**
+     * @brief Check if queue is empty
+     * @return True if queue is empty, false otherwise
+     */
+    bool is_empty() const override;
+
+    /**
+     * @brief Get the number of elements in queue
+     * @return Size of the queue
+     */
+    size_t size() const override;
+
+    /**
+     * @brief Write the queue in the binary format, front element first
+     * @param os Output stream (should be opened in binary mode)
+     * @return Reference to the output stream
+     * @throws std::runtime_error if an element cannot be encoded or the stream fails
+     */
+    std::ostream& save(std::ostream& os) const override;
+
+    /**
+     * @brief Append the elements stored by save() to the back of the queue
+     * @param is Input stream (should be opened in binary mode)
+     * @return Reference to the input stream
+     * @throws std::runtime_error if the data is malformed or memory allocation fails
+     * 
+     * Elements are pushed as they are decoded; on failure the queue is cut back to its
+     * old rear.
+     */
+    std::istream& load(std::istream& is) override;
+
+    /**
+     * @brief Assignment from any fwd_container
+     * @param other Container to copy from
+     * @return Reference to this queue
+     * @throws std::bad_cast if other is not a chunked queue of the same type
+     */
+    Queue& operator=(const fwd_container<T>& other) override;
+
+    /**
+     * @brief Get iterator to the beginning of the queue
+     * @return Iterator to the first element
+     */
+    iterator begin();
+
+    /**
+     * @brief Get iterator to the end of the queue
+     * @return Iterator to the position after the last element
+     */
+    iterator end();
+
+    /**
+     * @brief Get const iterator to the beginning of the queue
+     * @return Const iterator to the first element
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Get const iterator to the end of the queue
+     * @return Const iterator to the position after the last element
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief Get const iterator to the beginning of the queue
+     * @return Const iterator to the first element
+     */
+    const_iterator cbegin() const;
+
+    /**
+     * @brief Get const iterator to the end of the queue
+     * @return Const iterator to the position after the last element
+     */
+    const_iterator cend() const;
+
+    /**
+     * @brief Returns the number of elements in the queue
+     * @return Current size of the queue
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Returns the number of chunks currently allocated
+     * @return Chunk count
+     */
+    size_t chunk_count() const;
+
+    /**
+     * @brief Returns a reference to the front element (non-const version)
+     * @return Reference to the front element
+     * @throws std::runtime_error if queue is empty
+     */
+    T& front();
+
+    /**
+     * @brief Returns a reference to front element (const version)
+     * @return Const reference to front element
+     * @throws std::runtime_error if queue is empty
+     */
+    const T& front() const;
+
+    /**
+     * @brief Removes all elements from the queue
+     */
+    void clear();
+
+    /**
+     * @brief Checks if the queue is empty
+     * @return true if queue is empty, false otherwise
+     */
+    bool empty() const;
+
+    static constexpr bool reversed_spans = false; ///< Addresses inside a for_each_span() run descend in iteration order
+
+    /**
+     * @brief Visit the elements as runs of contiguous memory
+     * @param f Callable taking (const T* first, const T* last) and returning false to stop early
+     *
+     * One run per chunk, front chunk first; inside a run the addresses ascend in iteration
+     * order, so vectorized kernels can scan the chunks directly.
+     */
+    template<typename F>
+    void for_each_span(F&& f) const;
+
+    /**
+     * @brief Visit the elements as runs of contiguous, modifiable memory
+     * @param f Callable taking (T* first, T* last) and returning false to stop early
+     */
+    template<typename F>
+    void for_each_span(F&& f);
+
+    /**
+     * @brief Returns a copy of the allocator associated with the queue
+     * @return Allocator rebound back to the policy's allocator type
+     */
+    Alloc get_allocator() const;
+
+protected:
+    /**
+     * @brief Create a polymorphic iterator to the beginning of the queue
+     * @return Type-erased iterator to the first element
+     */
+    typename fwd_container<T>::iterator make_begin() override;
+
+    /**
+     * @brief Create a polymorphic iterator to the end of the queue
+     * @return Type-erased iterator to the position after the last element
+     */
+    typename fwd_container<T>::iterator make_end() override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the beginning of the queue
+     * @return Type-erased const iterator to the first element
+     */
+    typename fwd_container<T>::const_iterator make_begin() const override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the end of the queue
+     * @return Type-erased const iterator to the position after the last element
+     */
+    typename fwd_container<T>::const_iterator make_end() const override;
+
+    /**
+     * @brief Print queue contents to output stream
+     * @param os Output stream
+     * @return Reference to the output stream
+     */
+    virtual std::ostream& print(std::ostream& os) const override;
+
+    /**
+     * @brief Read queue contents from input stream
+     * @param is Input stream
+     * @return Reference to the input stream
+     */
+    virtual std::istream& read(std::istream& is) override;
+
+private:
+    using ChunkType = Chunk<T, N>;
+    using ChunkAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<ChunkType>;
+    using ChunkTraits = std::allocator_traits<ChunkAllocator>;
+
+    /**
+     * @brief Destroys the front element and releases its chunk once drained (queue must not be empty)
+     */
+    void drop_front() noexcept;
+
+    /**
+     * @brief Returns a rear chunk with at least one free slot, allocating one if needed
+     * @return Pointer to the chunk that receives the next element
+     */
+    ChunkType* writable_rear();
+
+    /**
+     * @brief Commits the element just constructed in the rear chunk
+     * @param chunk Chunk returned by writable_rear()
+     */
+    void commit_rear(ChunkType* chunk);
+
+    /**
+     * @brief Releases a chunk allocated by writable_rear() that received no element
+     * @param chunk Chunk returned by writable_rear()
+     */
+    void discard_rear(ChunkType* chunk) noexcept;
+
+    /**
+     * @brief Destroy every element pushed after the given rear position
+     * @param rear Rear chunk to restore (nullptr empties the queue)
+     * @param rearEnd Value of rear->end to restore
+     * @param count Number of elements to restore
+     */
+    void truncate_to(ChunkType* rear, size_t rearEnd, size_t count) noexcept;
+
+    ChunkType* frontChunk;     ///< Pointer to the front chunk (for pop operations)
+    ChunkType* rearChunk;      ///< Pointer to the rear chunk (for push operations)
+    size_t queueSize;          ///< Number of elements in the queue
+    ChunkAllocator chunkAlloc; ///< Allocator providing storage for the chunks
+};
+
+#include "chunked_queue.ipp"
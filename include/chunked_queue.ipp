@@ -0,0 +1,512 @@
+#include "chunked_queue.h"
+
+// Chunked Queue constructors and operators
+template<typename T, size_t N, typename Alloc>
+Queue<T, Chunked<N, Alloc>>::Queue() : frontChunk(nullptr), rearChunk(nullptr), queueSize(0), chunkAlloc() {}
+
+template<typename T, size_t N, typename Alloc>
+Queue<T, Chunked<N, Alloc>>::Queue(const Alloc& alloc)
+    : frontChunk(nullptr), rearChunk(nullptr), queueSize(0), chunkAlloc(alloc) {}
+
+template<typename T, size_t N, typename Alloc>
+Queue<T, Chunked<N, Alloc>>::Queue(const Queue& other)
+    : frontChunk(nullptr), rearChunk(nullptr), queueSize(0), chunkAlloc(ChunkTraits::select_on_container_copy_construction(other.chunkAlloc)) {
+    try {
+        for (const ChunkType* chunk = other.frontChunk; chunk != nullptr; chunk = chunk->next) {
+            for (size_t i = chunk->begin; i < chunk->end; ++i) {
+                push(*chunk->slot(i));
+            }
+        }
+    }
+    catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+Queue<T, Chunked<N, Alloc>>::Queue(Queue&& other)
+    : frontChunk(other.frontChunk), rearChunk(other.rearChunk), queueSize(other.queueSize), chunkAlloc(std::move(other.chunkAlloc)) {
+    other.frontChunk = nullptr;
+    other.rearChunk = nullptr;
+    other.queueSize = 0;
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Queue<T, Chunked<N, Alloc>>::operator=(const Queue& other) -> Queue& {
+    if (this != &other) {
+        clear();
+        if constexpr (ChunkTraits::propagate_on_container_copy_assignment::value) {
+            chunkAlloc = other.chunkAlloc;
+        }
+
+        for (const ChunkType* chunk = other.frontChunk; chunk != nullptr; chunk = chunk->next) {
+            for (size_t i = chunk->begin; i < chunk->end; ++i) {
+                push(*chunk->slot(i));
+            }
+        }
+    }
+    return *this;
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Queue<T, Chunked<N, Alloc>>::operator=(Queue&& other) -> Queue& {
+    if (this != &other) {
+        clear();
+        if constexpr (!ChunkTraits::propagate_on_container_move_assignment::value) {
+            // Chunks owned by a foreign allocator cannot be adopted; copy them and release the source
+            if (chunkAlloc != other.chunkAlloc) {
+                *this = static_cast<const Queue&>(other);
+                other.clear();
+                return *this;
+            }
+        }
+        else {
+            chunkAlloc = std::move(other.chunkAlloc);
+        }
+        frontChunk = other.frontChunk;
+        rearChunk = other.rearChunk;
+        queueSize = other.queueSize;
+
+        other.frontChunk = nullptr;
+        other.rearChunk = nullptr;
+        other.queueSize = 0;
+    }
+    return *this;
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Queue<T, Chunked<N, Alloc>>::operator=(const fwd_container<T>& other) -> Queue& {
+    const Queue* derived = dynamic_cast<const Queue*>(&other);
+    if (!derived) {
+        throw std::bad_cast();
+    }
+    return *this = *derived; // Use same-type assignment operator
+}
+
+template<typename T, size_t N, typename Alloc>
+Queue<T, Chunked<N, Alloc>>::~Queue() {
+    clear();
+}
+
+// Chunk management
+template<typename T, size_t N, typename Alloc>
+auto Queue<T, Chunked<N, Alloc>>::writable_rear() -> ChunkType* {
+    if (rearChunk != nullptr && rearChunk->end < N) return rearChunk;
+    return create_node(chunkAlloc);
+}
+
+template<typename T, size_t N, typename Alloc>
+void Queue<T, Chunked<N, Alloc>>::commit_rear(ChunkType* chunk) {
+    ++chunk->end;
+    if (chunk != rearChunk) {
+        if (rearChunk == nullptr) {
+            frontChunk = chunk;
+        } else {
+            rearChunk->next = chunk;
+        }
+        rearChunk = chunk;
+    }
+    ++queueSize;
+}
+
+template<typename T, size_t N, typename Alloc>
+void Queue<T, Chunked<N, Alloc>>::discard_rear(ChunkType* chunk) noexcept {
+    if (chunk != rearChunk) destroy_node(chunkAlloc, chunk);
+}
+
+template<typename T, size_t N, typename Alloc>
+void Queue<T, Chunked<N, Alloc>>::truncate_to(ChunkType* rear, size_t rearEnd, size_t count) noexcept {
+    if (rear == nullptr) {
+        clear();
+        return;
+    }
+
+    for (size_t i = rearEnd; i < rear->end; ++i) {
+        rear->slot(i)->~T();
+    }
+    rear->end = rearEnd;
+
+    ChunkType* extra = rear->next;
+    rear->next = nullptr;
+    while (extra != nullptr) {
+        ChunkType* chunk = extra;
+        extra = chunk->next;
+        for (size_t i = chunk->begin; i < chunk->end; ++i) {
+            chunk->slot(i)->~T();
+        }
+        destroy_node(chunkAlloc, chunk);
+    }
+    rearChunk = rear;
+    queueSize = count;
+}
+
+// fwd_container interface implementation
+template<typename T, size_t N, typename Alloc>
+void Queue<T, Chunked<N, Alloc>>::push(const T& value) {
+    emplace(value);
+}
+
+template<typename T, size_t N, typename Alloc>
+void Queue<T, Chunked<N, Alloc>>::push(T&& value) {
+    emplace(std::move(value));
+}
+
+template<typename T, size_t N, typename Alloc>
+template<typename... Args>
+T& Queue<T, Chunked<N, Alloc>>::emplace(Args&&... args) {
+    ChunkType* chunk = nullptr;
+    try {
+        chunk = writable_rear();
+        T* element = ::new (static_cast<void*>(chunk->slot(chunk->end))) T(std::forward<Args>(args)...);
+        commit_rear(chunk);
+        return *element;
+    }
+    catch (std::bad_alloc& e) {
+        if (chunk) discard_rear(chunk);
+        throw std::runtime_error("Failed to allocate memory for new queue element: " + std::string(e.what()));
+    }
+    catch (...) {
+        if (chunk) discard_rear(chunk);
+        throw;
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+void Queue<T, Chunked<N, Alloc>>::drop_front() noexcept {
+    ChunkType* chunk = frontChunk;
+    chunk->slot(chunk->begin)->~T();
+    ++chunk->begin;
+    --queueSize;
+
+    if (chunk->begin == chunk->end) {
+        if (chunk->next != nullptr) {
+            frontChunk = chunk->next;
+            destroy_node(chunkAlloc, chunk);
+        } else {
+            // Keep the last chunk around so a push/pop ping-pong does not allocate
+            chunk->begin = chunk->end = 0;
+        }
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+T Queue<T, Chunked<N, Alloc>>::pop() {
+    if (is_empty()) throw std::runtime_error("Cannot pop: Queue is empty");
+
+    T value = std::move(*frontChunk->slot(frontChunk->begin));
+    drop_front();
+    return value;
+}
+
+template<typename T, size_t N, typename Alloc>
+bool Queue<T, Chunked<N, Alloc>>::try_pop(T& out) {
+    if (is_empty()) return false;
+
+    out = std::move(*frontChunk->slot(frontChunk->begin));
+    drop_front();
+    return true;
+}
+
+template<typename T, size_t N, typename Alloc>
+std::optional<T> Queue<T, Chunked<N, Alloc>>::try_pop() {
+    if (is_empty()) return std::nullopt;
+
+    std::optional<T> value(std::move(*frontChunk->slot(frontChunk->begin)));
+    drop_front();
+    return value;
+}
+
+template<typename T, size_t N, typename Alloc>
+T* Queue<T, Chunked<N, Alloc>>::try_front() noexcept {
+    return is_empty() ? nullptr : frontChunk->slot(frontChunk->begin);
+}
+
+template<typename T, size_t N, typename Alloc>
+const T* Queue<T, Chunked<N, Alloc>>::try_front() const noexcept {
+    return is_empty() ? nullptr : frontChunk->slot(frontChunk->begin);
+}
+
+template<typename T, size_t N, typename Alloc>
+T& Queue<T, Chunked<N, Alloc>>::get_front() {
+    if (is_empty()) throw std::runtime_error("Cannot get front data: Queue is empty");
+    return *frontChunk->slot(frontChunk->begin);
+}
+
+template<typename T, size_t N, typename Alloc>
+const T& Queue<T, Chunked<N, Alloc>>::get_front() const {
+    if (is_empty()) throw std::runtime_error("Cannot get front data: Queue is empty");
+    return *frontChunk->slot(frontChunk->begin);
+}
+
+template<typename T, size_t N, typename Alloc>
+bool Queue<T, Chunked<N, Alloc>>::is_empty() const {
+    return queueSize == 0;
+}
+
+template<typename T, size_t N, typename Alloc>
+size_t Queue<T, Chunked<N, Alloc>>::size() const {
+    return queueSize;
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Queue<T, Chunked<N, Alloc>>::begin() -> iterator {
+    if (is_empty()) return end();
+    return iterator(frontChunk, frontChunk->begin);
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Queue<T, Chunked<N, Alloc>>::end() -> iterator {
+    return iterator(nullptr, 0);
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Queue<T, Chunked<N, Alloc>>::begin() const -> const_iterator {
+    if (is_empty()) return end();
+    return const_iterator(frontChunk, frontChunk->begin);
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Queue<T, Chunked<N, Alloc>>::end() const -> const_iterator {
+    return const_iterator(nullptr, 0);
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Queue<T, Chunked<N, Alloc>>::cbegin() const -> const_iterator {
+    return begin();
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Queue<T, Chunked<N, Alloc>>::cend() const -> const_iterator {
+    return end();
+}
+
+// Polymorphic iterators for access through fwd_container<T>
+template<typename T, size_t N, typename Alloc>
+typename fwd_container<T>::iterator Queue<T, Chunked<N, Alloc>>::make_begin() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(begin());
+}
+
+template<typename T, size_t N, typename Alloc>
+typename fwd_container<T>::iterator Queue<T, Chunked<N, Alloc>>::make_end() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(end());
+}
+
+template<typename T, size_t N, typename Alloc>
+typename fwd_container<T>::const_iterator Queue<T, Chunked<N, Alloc>>::make_begin() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(begin());
+}
+
+template<typename T, size_t N, typename Alloc>
+typename fwd_container<T>::const_iterator Queue<T, Chunked<N, Alloc>>::make_end() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(end());
+}
+
+// Additional methods
+template<typename T, size_t N, typename Alloc>
+size_t Queue<T, Chunked<N, Alloc>>::getSize() const {
+    return queueSize;
+}
+
+template<typename T, size_t N, typename Alloc>
+size_t Queue<T, Chunked<N, Alloc>>::chunk_count() const {
+    size_t count = 0;
+    for (const ChunkType* chunk = frontChunk; chunk != nullptr; chunk = chunk->next) ++count;
+    return count;
+}
+
+template<typename T, size_t N, typename Alloc>
+T& Queue<T, Chunked<N, Alloc>>::front() {
+    return get_front();
+}
+
+template<typename T, size_t N, typename Alloc>
+const T& Queue<T, Chunked<N, Alloc>>::front() const {
+    return get_front();
+}
+
+template<typename T, size_t N, typename Alloc>
+void Queue<T, Chunked<N, Alloc>>::clear() {
+    ChunkType* chunk = frontChunk;
+    frontChunk = nullptr;
+    rearChunk = nullptr;
+    queueSize = 0;
+
+    if constexpr (std::is_trivially_destructible_v<T>) {
+        if (chunk != nullptr && release_all_nodes(chunkAlloc)) return;
+    }
+    while (chunk != nullptr) {
+        ChunkType* next = chunk->next;
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = chunk->begin; i < chunk->end; ++i) {
+                chunk->slot(i)->~T();
+            }
+        }
+        destroy_node(chunkAlloc, chunk);
+        chunk = next;
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+bool Queue<T, Chunked<N, Alloc>>::empty() const {
+    return is_empty();
+}
+
+template<typename T, size_t N, typename Alloc>
+template<typename F>
+void Queue<T, Chunked<N, Alloc>>::for_each_span(F&& f) const {
+    for (const ChunkType* chunk = frontChunk; chunk != nullptr; chunk = chunk->next) {
+        if (!f(chunk->slot(chunk->begin), chunk->slot(chunk->end))) return;
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+template<typename F>
+void Queue<T, Chunked<N, Alloc>>::for_each_span(F&& f) {
+    for (ChunkType* chunk = frontChunk; chunk != nullptr; chunk = chunk->next) {
+        if (!f(chunk->slot(chunk->begin), chunk->slot(chunk->end))) return;
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+Alloc Queue<T, Chunked<N, Alloc>>::get_allocator() const {
+    return Alloc(chunkAlloc);
+}
+
+// Protected methods for stream operations
+template<typename T, size_t N, typename Alloc>
+std::ostream& Queue<T, Chunked<N, Alloc>>::print(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+
+        bool first = true;
+        for (const ChunkType* chunk = frontChunk; chunk != nullptr; chunk = chunk->next) {
+            for (size_t i = chunk->begin; i < chunk->end; ++i) {
+                if (!first) {
+                    os << " ";
+                }
+
+                if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+
+                os << *chunk->slot(i);
+                first = false;
+            }
+        }
+
+        if (!os.good()) throw std::runtime_error("Output stream failed after serialization");
+
+        return os;
+
+    } catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Queue serialization failed: ") + e.what());
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+std::istream& Queue<T, Chunked<N, Alloc>>::read(std::istream& is) {
+    try {
+        if (!is.good()) {
+            throw std::runtime_error("Input stream is in bad state");
+        }
+
+        // Everything read is appended behind the current rear, so rolling back only
+        // has to cut the chain there again
+        ChunkType* oldRear = rearChunk;
+        size_t oldEnd = oldRear != nullptr ? oldRear->end : 0;
+        size_t oldSize = queueSize;
+
+        if constexpr (is_fast_parsable_v<T>) {
+            if (fast_parse_applies(is)) {
+                try {
+                    parse_text_elements<T>(is, [this](T value) { emplace(value); });
+                }
+                catch (...) {
+                    truncate_to(oldRear, oldEnd, oldSize);
+                    throw;
+                }
+                return is;
+            }
+        }
+
+        try {
+            T value;
+            while (is >> value) {
+                try {
+                    this->push(value);
+                }
+                catch (const std::bad_alloc& e) {
+                    throw std::runtime_error("Memory allocation failed during input: " + std::string(e.what()));
+                }
+                catch (const std::exception& e) {
+                    throw std::runtime_error("Push operation failed during input: " + std::string(e.what()));
+                }
+
+                if (!is.good() && !is.eof()) {
+                    throw std::runtime_error("Input stream failed during data reading");
+                }
+            }
+
+            if (is.eof()) {
+                is.clear();
+            }
+
+            if (is.fail() && !is.eof()) {
+                throw std::runtime_error("Failed to parse input data");
+            }
+
+            return is;
+
+        }
+        catch (...) {
+            truncate_to(oldRear, oldEnd, oldSize);
+            throw;
+        }
+
+    }
+    catch (const std::exception& e)
+    {
+        is.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Queue input failed: ") + e.what());
+    }
+}
+
+// Binary serialization
+template<typename T, size_t N, typename Alloc>
+std::ostream& Queue<T, Chunked<N, Alloc>>::save(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+        binary_write_header<T>(os, queueSize);
+        binary_write_elements<T>(os, begin(), end());
+        if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+        return os;
+    }
+    catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Queue save failed: ") + e.what());
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+std::istream& Queue<T, Chunked<N, Alloc>>::load(std::istream& is) {
+    try {
+        if (!is.good()) throw std::runtime_error("Input stream is in bad state");
+        binary_header header = binary_read_header<T>(is);
+
+        ChunkType* oldRear = rearChunk;
+        size_t oldEnd = oldRear != nullptr ? oldRear->end : 0;
+        size_t oldSize = queueSize;
+        try {
+            binary_read_elements<T>(is, header.count, [this](T&& value) { emplace(std::move(value)); });
+        }
+        catch (...) {
+            truncate_to(oldRear, oldEnd, oldSize);
+            throw;
+        }
+        return is;
+    }
+    catch (const std::exception& e) {
+        is.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Queue load failed: ") + e.what());
+    }
+}
@@ -0,0 +1,603 @@
+#pragma once
+#include <iostream>
+#include <memory>
+#include <exception>
+#include <sstream>
+#include <vector>
+
+#include "chunked.h"
+#include "stack.h"
+
+/**
+ * @brief Stack implementation using an unrolled list of chunks
+ * @tparam T Type of elements stored in the stack
+ * @tparam N Number of elements stored per chunk
+ * @tparam Alloc Allocator, rebound internally to Chunk<T, N>
+ *
+ * Elements are pushed into and popped from the end of the top chunk; older chunks
+ * are always full. One emptied chunk is kept as a spare so that pushing and popping
+ * across a chunk boundary does not allocate every time.
+ */
+template<typename T, size_t N, typename Alloc>
+class Stack<T, Chunked<N, Alloc>> final : public fwd_container<T> {
+public:
+    /**
+     * @brief Iterator implementation for chunked Stack (non-const version)
+     */
+    class chunked_stack_iterator {
+    private:
+        Chunk<T, N>* chunk; ///< Current chunk pointer (nullptr at the end)
+        size_t index;       ///< Current slot within the chunk
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = T*;
+        using reference         = T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        chunked_stack_iterator() : chunk(nullptr), index(0) {}
+
+        /**
+         * @brief Constructor
+         * @param c Starting chunk for iteration
+         * @param i Starting slot within the chunk
+         */
+        chunked_stack_iterator(Chunk<T, N>* c, size_t i) : chunk(c), index(i) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Reference to the current element
+         */
+        T& operator*() const {
+            return *chunk->slot(index);
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Pointer to the current element
+         */
+        T* operator->() const {
+            return chunk->slot(index);
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        chunked_stack_iterator& operator++() {
+            if (index == chunk->begin) {
+                chunk = chunk->next;
+                index = chunk ? chunk->end - 1 : 0;
+            } else {
+                --index;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        chunked_stack_iterator operator++(int) {
+            chunked_stack_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Advance by several elements, jumping over whole chunks
+         * @param n Number of elements to skip (at most the distance to the end)
+         * @return Reference to this iterator
+         */
+        chunked_stack_iterator& skip(size_t n) {
+            while (n > 0) {
+                const size_t left = index - chunk->begin + 1;
+                if (n < left) {
+                    index -= n;
+                    break;
+                }
+                n -= left;
+                chunk = chunk->next;
+                index = chunk ? chunk->end - 1 : 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same slot
+         */
+        friend bool operator==(const chunked_stack_iterator& lhs, const chunked_stack_iterator& rhs) {
+            return lhs.chunk == rhs.chunk && lhs.index == rhs.index;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different slots
+         */
+        friend bool operator!=(const chunked_stack_iterator& lhs, const chunked_stack_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the current chunk pointer
+         * @return Pointer to current chunk
+         */
+        Chunk<T, N>* get_chunk() const { return chunk; }
+
+        /**
+         * @brief Get the current slot index
+         * @return Slot index within the current chunk
+         */
+        size_t get_index() const { return index; }
+    };
+
+    /**
+     * @brief Const iterator implementation for chunked Stack
+     */
+    class chunked_stack_const_iterator {
+    private:
+        const Chunk<T, N>* chunk; ///< Current chunk pointer (nullptr at the end)
+        size_t index;             ///< Current slot within the chunk
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = const T*;
+        using reference         = const T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        chunked_stack_const_iterator() : chunk(nullptr), index(0) {}
+
+        /**
+         * @brief Constructor
+         * @param c Starting chunk for iteration
+         * @param i Starting slot within the chunk
+         */
+        chunked_stack_const_iterator(const Chunk<T, N>* c, size_t i) : chunk(c), index(i) {}
+
+        /**
+         * @brief Constructor from non-const iterator
+         * @param other Iterator to convert from
+         */
+        chunked_stack_const_iterator(const chunked_stack_iterator& other) : chunk(other.get_chunk()), index(other.get_index()) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Const reference to the current element
+         */
+        const T& operator*() const {
+            return *chunk->slot(index);
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Const pointer to the current element
+         */
+        const T* operator->() const {
+            return chunk->slot(index);
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        chunked_stack_const_iterator& operator++() {
+            if (index == chunk->begin) {
+                chunk = chunk->next;
+                index = chunk ? chunk->end - 1 : 0;
+            } else {
+                --index;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        chunked_stack_const_iterator operator++(int) {
+            chunked_stack_const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Advance by several elements, jumping over whole chunks
+         * @param n Number of elements to skip (at most the distance to the end)
+         * @return Reference to this iterator
+         */
+        chunked_stack_const_iterator& skip(size_t n) {
+            while (n > 0) {
+                const size_t left = index - chunk->begin + 1;
+                if (n < left) {
+                    index -= n;
+                    break;
+                }
+                n -= left;
+                chunk = chunk->next;
+                index = chunk ? chunk->end - 1 : 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same slot
+         */
+        friend bool operator==(const chunked_stack_const_iterator& lhs, const chunked_stack_const_iterator& rhs) {
+            return lhs.chunk == rhs.chunk && lhs.index == rhs.index;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different slots
+         */
+        friend bool operator!=(const chunked_stack_const_iterator& lhs, const chunked_stack_const_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the current chunk pointer
+         * @return Const pointer to current chunk
+         */
+        const Chunk<T, N>* get_chunk() const { return chunk; }
+
+        /**
+         * @brief Get the current slot index
+         * @return Slot index within the current chunk
+         */
+        size_t get_index() const { return index; }
+    };
+
+    using iterator = chunked_stack_iterator;
+    using const_iterator = chunked_stack_const_iterator;
+    using allocator_type = Alloc;
+
+    static constexpr size_t chunk_capacity = N; ///< Elements per chunk
+
+    /**
+     * @brief Default constructor - creates an empty stack
+     */
+    Stack();
+
+    /**
+     * @brief Creates an empty stack that allocates its chunks through the given allocator
+     * @param alloc Allocator to use for all chunks of this stack
+     */
+    explicit Stack(const Alloc& alloc);
+
+    /**
+     * @brief Copy constructor - creates a deep copy of another stack
+     * @param other Stack to copy from
+     * @throws std::runtime_error if memory allocation fails during copying
+     */
+    Stack(const Stack& other);
+
+    /**
+     * @brief Move constructor - transfers ownership from another stack
+     * @param other Stack to move from (will be left in valid but empty state)
+     */
+    Stack(Stack&& other);
+
+    /**
+     * @brief Copy assignment operator
+     * @param other Stack to copy from
+     * @return Reference to this stack
+     * @throws std::runtime_error if memory allocation fails during copying
+     */
+    Stack& operator=(const Stack& other);
+
+    /**
+     * @brief Move assignment operator
+     * @param other Stack to move from
+     * @return Reference to this stack
+     */
+    Stack& operator=(Stack&& other);
+
+    /**
+     * @brief Virtual destructor
+     */
+    ~Stack();
+
+    // fwd_container interface implementation
+    /**
+     * @brief Add element to the top of the stack (copy semantics)
+     * @param value The value to add
+     */
+    void push(const T& value) override;
+
+    /**
+     * @brief Add element to the top of the stack (move semantics)
+     * @param value The value to add
+     */
+    void push(T&& value) override;
+
+    /**
+     * @brief Construct an element in place on the top of the stack
+     * @param args Arguments forwarded to the T constructor
+     * @return Reference to the new element
+     * @throws std::runtime_error if memory allocation fails
+     */
+    template<typename... Args>
+    T& emplace(Args&&... args);
+
+    /**
+     * @brief Remove and return element from the top of the stack
+     * @return The removed element from top
+     * @throws std::runtime_error if stack is empty
+     */
+    T pop() override;
+
+    /**
+     * @brief Get reference to the top element
+     * @return Reference to the top element
+     * @throws std::runtime_error if stack is empty
+     */
+    T& get_front() override;
+
+    /**
+     * @brief Get const reference to the top element
+     * @return Const reference to the top element
+     * @throws std::runtime_error if stack is empty
+     */
+    const T& get_front() const override;
+
+    /**
+     * @brief Remove the top element if there is one; never throws on empty
+     * @param out Receives the removed element
+     * @return True if an element was removed, false if the stack was empty
+     */
+    bool try_pop(T& out) override;
+
+    /**
+     * @brief Remove the top element if there is one; never throws on empty
+     * @return The removed element, or std::nullopt if the stack was empty
+     */
+    std::optional<T> try_pop() override;
+
+    /**
+     * @brief Get pointer to the top element
+     * @return Pointer to the top element, or nullptr if the stack is empty
+     */
+    T* try_front() noexcept override;
+
+    /**
+     * @brief Get const pointer to the top element
+     * @return Const pointer to the top element, or nullptr if the stack is empty
+     */
+    const T* try_front() const noexcept override;
+
+    /**
+     * @brief Check if stack is empty
+     * @return True if stack is empty, false otherwise
+     */
+    bool is_empty() const override;
+
+    /**
+     * @brief Get the number of elements in stack
+     * @return Size of the stack
+     */
+    size_t size() const override;
+
+    /**
+     * @brief Write the stack in the binary format, top element first
+     * @param os Output stream (should be opened in binary mode)
+     * @return Reference to the output stream
+     * @throws std::runtime_error if an element cannot be encoded or the stream fails
+     */
+    std::ostream& save(std::ostream& os) const override;
+
+    /**
+     * @brief Place the elements stored by save() on top of the stack
+     * @param is Input stream (should be opened in binary mode)
+     * @return Reference to the input stream
+     * @throws std::runtime_error if the data is malformed or memory allocation fails
+     * 
+     * The stream lists the top element first, so the decoded elements are staged and
+     * pushed bottom-up; on failure the pushed elements are popped again.
+     */
+    std::istream& load(std::istream& is) override;
+
+    /**
+     * @brief Assignment from any fwd_container
+     * @param other Container to copy from
+     * @return Reference to this stack
+     * @throws std::bad_cast if other is not a chunked stack of the same type
+     */
+    Stack& operator=(const fwd_container<T>& other) override;
+
+    /**
+     * @brief Get iterator to the beginning of the stack
+     * @return Iterator to the first element (top of stack)
+     */
+    iterator begin();
+
+    /**
+     * @brief Get iterator to the end of the stack
+     * @return Iterator to the position after the last element
+     */
+    iterator end();
+
+    /**
+     * @brief Get const iterator to the beginning of the stack
+     * @return Const iterator to the first element (top of stack)
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Get const iterator to the end of the stack
+     * @return Const iterator to the position after the last element
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief Get const iterator to the beginning of the stack
+     * @return Const iterator to the first element (top of stack)
+     */
+    const_iterator cbegin() const;
+
+    /**
+     * @brief Get const iterator to the end of the stack
+     * @return Const iterator to the position after the last element
+     */
+    const_iterator cend() const;
+
+    /**
+     * @brief Returns the number of elements in the stack
+     * @return Current size of the stack
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Returns the number of chunks currently allocated
+     * @return Chunk count
+     */
+    size_t chunk_count() const;
+
+    /**
+     * @brief Returns a reference to the top element (non-const version)
+     * @return Reference to the top element
+     * @throws std::runtime_error if stack is empty
+     */
+    T& top();
+
+    /**
+     * @brief Returns a reference to top element (const version)
+     * @return Const reference to top element
+     * @throws std::runtime_error if stack is empty
+     */
+    const T& top() const;
+
+    /**
+     * @brief Removes all elements from the stack
+     */
+    void clear();
+
+    /**
+     * @brief Checks if the stack is empty
+     * @return true if stack is empty, false otherwise
+     */
+    bool empty() const;
+
+    static constexpr bool reversed_spans = true; ///< Addresses inside a for_each_span() run descend in iteration order
+
+    /**
+     * @brief Visit the elements as runs of contiguous memory
+     * @param f Callable taking (const T* first, const T* last) and returning false to stop early
+     *
+     * One run per chunk, top chunk first; inside a run the addresses ascend, which is the
+     * reverse of iteration order (the top element is the last one of the first run).
+     */
+    template<typename F>
+    void for_each_span(F&& f) const;
+
+    /**
+     * @brief Visit the elements as runs of contiguous, modifiable memory
+     * @param f Callable taking (T* first, T* last) and returning false to stop early
+     */
+    template<typename F>
+    void for_each_span(F&& f);
+
+    /**
+     * @brief Returns a copy of the allocator associated with the stack
+     * @return Allocator rebound back to the policy's allocator type
+     */
+    Alloc get_allocator() const;
+
+protected:
+    /**
+     * @brief Create a polymorphic iterator to the beginning of the stack
+     * @return Type-erased iterator to the first element
+     */
+    typename fwd_container<T>::iterator make_begin() override;
+
+    /**
+     * @brief Create a polymorphic iterator to the end of the stack
+     * @return Type-erased iterator to the position after the last element
+     */
+    typename fwd_container<T>::iterator make_end() override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the beginning of the stack
+     * @return Type-erased const iterator to the first element
+     */
+    typename fwd_container<T>::const_iterator make_begin() const override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the end of the stack
+     * @return Type-erased const iterator to the position after the last element
+     */
+    typename fwd_container<T>::const_iterator make_end() const override;
+
+    /**
+     * @brief Print stack contents to output stream
+     * @param os Output stream
+     * @return Reference to the output stream
+     */
+    virtual std::ostream& print(std::ostream& os) const override;
+
+    /**
+     * @brief Read stack contents from input stream
+     * @param is Input stream
+     * @return Reference to the input stream
+     */
+    virtual std::istream& read(std::istream& is) override;
+
+private:
+    using ChunkType = Chunk<T, N>;
+    using ChunkAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<ChunkType>;
+    using ChunkTraits = std::allocator_traits<ChunkAllocator>;
+
+    /**
+     * @brief Destroys the top element and retires its chunk once drained (stack must not be empty)
+     */
+    void drop_top() noexcept;
+
+    /**
+     * @brief Replaces the (empty) contents with a chunk-by-chunk copy of another stack
+     * @param other Stack to copy from
+     * @throws std::runtime_error if memory allocation fails; the stack is left empty
+     */
+    void copy_chunks(const Stack& other);
+
+    /**
+     * @brief Returns a top chunk with at least one free slot, taking the spare or allocating one if needed
+     * @return Pointer to the chunk that receives the next element
+     */
+    ChunkType* writable_top();
+
+    /**
+     * @brief Commits the element just constructed in the top chunk
+     * @param chunk Chunk returned by writable_top()
+     */
+    void commit_top(ChunkType* chunk);
+
+    /**
+     * @brief Returns a chunk obtained from writable_top() that received no element
+     * @param chunk Chunk returned by writable_top()
+     */
+    void discard_top(ChunkType* chunk) noexcept;
+
+    ChunkType* topChunk;       ///< Pointer to the top chunk of the stack
+    ChunkType* spareChunk;     ///< Emptied chunk kept for reuse (may be nullptr)
+    size_t stackSize;          ///< Number of elements in the stack
+    ChunkAllocator chunkAlloc; ///< Allocator providing storage for the chunks
+};
+
+#include "chunked_stack.ipp"
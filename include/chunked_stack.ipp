@@ -0,0 +1,514 @@
+#include "chunked_stack.h"
+
+// Chunked Stack constructors and operators
+template<typename T, size_t N, typename Alloc>
+Stack<T, Chunked<N, Alloc>>::Stack() : topChunk(nullptr), spareChunk(nullptr), stackSize(0), chunkAlloc() {}
+
+template<typename T, size_t N, typename Alloc>
+Stack<T, Chunked<N, Alloc>>::Stack(const Alloc& alloc)
+    : topChunk(nullptr), spareChunk(nullptr), stackSize(0), chunkAlloc(alloc) {}
+
+template<typename T, size_t N, typename Alloc>
+Stack<T, Chunked<N, Alloc>>::Stack(const Stack& other)
+    : topChunk(nullptr), spareChunk(nullptr), stackSize(0), chunkAlloc(ChunkTraits::select_on_container_copy_construction(other.chunkAlloc)) {
+    copy_chunks(other);
+}
+
+template<typename T, size_t N, typename Alloc>
+Stack<T, Chunked<N, Alloc>>::Stack(Stack&& other)
+    : topChunk(other.topChunk), spareChunk(other.spareChunk), stackSize(other.stackSize), chunkAlloc(std::move(other.chunkAlloc)) {
+    other.topChunk = nullptr;
+    other.spareChunk = nullptr;
+    other.stackSize = 0;
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, Chunked<N, Alloc>>::operator=(const Stack& other) -> Stack& {
+    if (this != &other) {
+        clear();
+        if constexpr (ChunkTraits::propagate_on_container_copy_assignment::value) {
+            chunkAlloc = other.chunkAlloc;
+        }
+        copy_chunks(other);
+    }
+    return *this;
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, Chunked<N, Alloc>>::operator=(Stack&& other) -> Stack& {
+    if (this != &other) {
+        clear();
+        if constexpr (!ChunkTraits::propagate_on_container_move_assignment::value) {
+            // Chunks owned by a foreign allocator cannot be adopted; copy them and release the source
+            if (chunkAlloc != other.chunkAlloc) {
+                *this = static_cast<const Stack&>(other);
+                other.clear();
+                return *this;
+            }
+        }
+        else {
+            chunkAlloc = std::move(other.chunkAlloc);
+        }
+        topChunk = other.topChunk;
+        spareChunk = other.spareChunk;
+        stackSize = other.stackSize;
+
+        other.topChunk = nullptr;
+        other.spareChunk = nullptr;
+        other.stackSize = 0;
+    }
+    return *this;
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, Chunked<N, Alloc>>::operator=(const fwd_container<T>& other) -> Stack& {
+    const Stack* derived = dynamic_cast<const Stack*>(&other);
+    if (!derived) {
+        throw std::bad_cast();
+    }
+    return *this = *derived;
+}
+
+template<typename T, size_t N, typename Alloc>
+Stack<T, Chunked<N, Alloc>>::~Stack() {
+    clear();
+}
+
+// Chunk management
+template<typename T, size_t N, typename Alloc>
+void Stack<T, Chunked<N, Alloc>>::copy_chunks(const Stack& other) {
+    ChunkType* newTopChunk = nullptr;
+    ChunkType* prevNewChunk = nullptr;
+
+    try {
+        // Chunks are copied slot by slot so the copy keeps the same chunk boundaries
+        for (const ChunkType* chunk = other.topChunk; chunk != nullptr; chunk = chunk->next) {
+            ChunkType* newChunk = create_node(chunkAlloc);
+            if (prevNewChunk == nullptr) {
+                newTopChunk = newChunk;
+            } else {
+                prevNewChunk->next = newChunk;
+            }
+            prevNewChunk = newChunk;
+
+            for (size_t i = chunk->begin; i < chunk->end; ++i) {
+                ::new (static_cast<void*>(newChunk->slot(i))) T(*chunk->slot(i));
+                newChunk->end = i + 1;
+            }
+        }
+        topChunk = newTopChunk;
+        stackSize = other.stackSize;
+    }
+    catch (const std::bad_alloc& e) {
+        topChunk = newTopChunk;
+        clear();
+        throw std::runtime_error("Memory allocation failed during stack copy: " + std::string(e.what()));
+    }
+    catch (...) {
+        topChunk = newTopChunk;
+        clear();
+        throw;
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, Chunked<N, Alloc>>::writable_top() -> ChunkType* {
+    if (topChunk != nullptr && topChunk->end < N) return topChunk;
+    if (spareChunk != nullptr) {
+        ChunkType* chunk = spareChunk;
+        spareChunk = nullptr;
+        return chunk;
+    }
+    return create_node(chunkAlloc);
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, Chunked<N, Alloc>>::commit_top(ChunkType* chunk) {
+    ++chunk->end;
+    if (chunk != topChunk) {
+        chunk->next = topChunk;
+        topChunk = chunk;
+    }
+    ++stackSize;
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, Chunked<N, Alloc>>::discard_top(ChunkType* chunk) noexcept {
+    if (chunk != topChunk) {
+        if (spareChunk == nullptr) {
+            spareChunk = chunk;
+        } else {
+            destroy_node(chunkAlloc, chunk);
+        }
+    }
+}
+
+// fwd_container interface implementation
+template<typename T, size_t N, typename Alloc>
+void Stack<T, Chunked<N, Alloc>>::push(const T& value) {
+    emplace(value);
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, Chunked<N, Alloc>>::push(T&& value) {
+    emplace(std::move(value));
+}
+
+template<typename T, size_t N, typename Alloc>
+template<typename... Args>
+T& Stack<T, Chunked<N, Alloc>>::emplace(Args&&... args) {
+    ChunkType* chunk = nullptr;
+    try {
+        chunk = writable_top();
+        T* element = ::new (static_cast<void*>(chunk->slot(chunk->end))) T(std::forward<Args>(args)...);
+        commit_top(chunk);
+        return *element;
+    }
+    catch (std::bad_alloc& e) {
+        if (chunk) discard_top(chunk);
+        throw std::runtime_error("Failed to allocate memory for new stack element: " + std::string(e.what()));
+    }
+    catch (...) {
+        if (chunk) discard_top(chunk);
+        throw;
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, Chunked<N, Alloc>>::drop_top() noexcept {
+    ChunkType* chunk = topChunk;
+    chunk->slot(chunk->end - 1)->~T();
+    --chunk->end;
+    --stackSize;
+
+    if (chunk->end == chunk->begin && chunk->next != nullptr) {
+        topChunk = chunk->next;
+        chunk->next = nullptr;
+        if (spareChunk == nullptr) {
+            spareChunk = chunk;
+        } else {
+            destroy_node(chunkAlloc, chunk);
+        }
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+T Stack<T, Chunked<N, Alloc>>::pop() {
+    if (is_empty()) throw std::runtime_error("Cannot pop: Stack is empty");
+
+    T value = std::move(*topChunk->slot(topChunk->end - 1));
+    drop_top();
+    return value;
+}
+
+template<typename T, size_t N, typename Alloc>
+bool Stack<T, Chunked<N, Alloc>>::try_pop(T& out) {
+    if (is_empty()) return false;
+
+    out = std::move(*topChunk->slot(topChunk->end - 1));
+    drop_top();
+    return true;
+}
+
+template<typename T, size_t N, typename Alloc>
+std::optional<T> Stack<T, Chunked<N, Alloc>>::try_pop() {
+    if (is_empty()) return std::nullopt;
+
+    std::optional<T> value(std::move(*topChunk->slot(topChunk->end - 1)));
+    drop_top();
+    return value;
+}
+
+template<typename T, size_t N, typename Alloc>
+T* Stack<T, Chunked<N, Alloc>>::try_front() noexcept {
+    return is_empty() ? nullptr : topChunk->slot(topChunk->end - 1);
+}
+
+template<typename T, size_t N, typename Alloc>
+const T* Stack<T, Chunked<N, Alloc>>::try_front() const noexcept {
+    return is_empty() ? nullptr : topChunk->slot(topChunk->end - 1);
+}
+
+template<typename T, size_t N, typename Alloc>
+T& Stack<T, Chunked<N, Alloc>>::get_front() {
+    if (is_empty()) throw std::runtime_error("Cannot get top data: Stack is empty");
+    return *topChunk->slot(topChunk->end - 1);
+}
+
+template<typename T, size_t N, typename Alloc>
+const T& Stack<T, Chunked<N, Alloc>>::get_front() const {
+    if (is_empty()) throw std::runtime_error("Cannot get top data: Stack is empty");
+    return *topChunk->slot(topChunk->end - 1);
+}
+
+template<typename T, size_t N, typename Alloc>
+bool Stack<T, Chunked<N, Alloc>>::is_empty() const {
+    return stackSize == 0;
+}
+
+template<typename T, size_t N, typename Alloc>
+size_t Stack<T, Chunked<N, Alloc>>::size() const {
+    return stackSize;
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, Chunked<N, Alloc>>::begin() -> iterator {
+    if (is_empty()) return end();
+    return iterator(topChunk, topChunk->end - 1);
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, Chunked<N, Alloc>>::end() -> iterator {
+    return iterator(nullptr, 0);
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, Chunked<N, Alloc>>::begin() const -> const_iterator {
+    if (is_empty()) return end();
+    return const_iterator(topChunk, topChunk->end - 1);
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, Chunked<N, Alloc>>::end() const -> const_iterator {
+    return const_iterator(nullptr, 0);
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, Chunked<N, Alloc>>::cbegin() const -> const_iterator {
+    return begin();
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, Chunked<N, Alloc>>::cend() const -> const_iterator {
+    return end();
+}
+
+// Polymorphic iterators for access through fwd_container<T>
+template<typename T, size_t N, typename Alloc>
+typename fwd_container<T>::iterator Stack<T, Chunked<N, Alloc>>::make_begin() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(begin());
+}
+
+template<typename T, size_t N, typename Alloc>
+typename fwd_container<T>::iterator Stack<T, Chunked<N, Alloc>>::make_end() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(end());
+}
+
+template<typename T, size_t N, typename Alloc>
+typename fwd_container<T>::const_iterator Stack<T, Chunked<N, Alloc>>::make_begin() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(begin());
+}
+
+template<typename T, size_t N, typename Alloc>
+typename fwd_container<T>::const_iterator Stack<T, Chunked<N, Alloc>>::make_end() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(end());
+}
+
+// Additional methods
+template<typename T, size_t N, typename Alloc>
+size_t Stack<T, Chunked<N, Alloc>>::getSize() const {
+    return stackSize;
+}
+
+template<typename T, size_t N, typename Alloc>
+size_t Stack<T, Chunked<N, Alloc>>::chunk_count() const {
+    size_t count = spareChunk ? 1 : 0;
+    for (const ChunkType* chunk = topChunk; chunk != nullptr; chunk = chunk->next) ++count;
+    return count;
+}
+
+template<typename T, size_t N, typename Alloc>
+T& Stack<T, Chunked<N, Alloc>>::top() {
+    return get_front();
+}
+
+template<typename T, size_t N, typename Alloc>
+const T& Stack<T, Chunked<N, Alloc>>::top() const {
+    return get_front();
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, Chunked<N, Alloc>>::clear() {
+    ChunkType* chunk = topChunk;
+    ChunkType* spare = spareChunk;
+    topChunk = nullptr;
+    spareChunk = nullptr;
+    stackSize = 0;
+
+    if constexpr (std::is_trivially_destructible_v<T>) {
+        if ((chunk != nullptr || spare != nullptr) && release_all_nodes(chunkAlloc)) return;
+    }
+    while (chunk != nullptr) {
+        ChunkType* next = chunk->next;
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = chunk->begin; i < chunk->end; ++i) {
+                chunk->slot(i)->~T();
+            }
+        }
+        destroy_node(chunkAlloc, chunk);
+        chunk = next;
+    }
+    if (spare != nullptr) destroy_node(chunkAlloc, spare);
+}
+
+template<typename T, size_t N, typename Alloc>
+bool Stack<T, Chunked<N, Alloc>>::empty() const {
+    return is_empty();
+}
+
+template<typename T, size_t N, typename Alloc>
+template<typename F>
+void Stack<T, Chunked<N, Alloc>>::for_each_span(F&& f) const {
+    for (const ChunkType* chunk = topChunk; chunk != nullptr; chunk = chunk->next) {
+        if (!f(chunk->slot(chunk->begin), chunk->slot(chunk->end))) return;
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+template<typename F>
+void Stack<T, Chunked<N, Alloc>>::for_each_span(F&& f) {
+    for (ChunkType* chunk = topChunk; chunk != nullptr; chunk = chunk->next) {
+        if (!f(chunk->slot(chunk->begin), chunk->slot(chunk->end))) return;
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+Alloc Stack<T, Chunked<N, Alloc>>::get_allocator() const {
+    return Alloc(chunkAlloc);
+}
+
+// Protected methods for stream operations
+template<typename T, size_t N, typename Alloc>
+std::ostream& Stack<T, Chunked<N, Alloc>>::print(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+
+        bool first = true;
+        for (const ChunkType* chunk = topChunk; chunk != nullptr; chunk = chunk->next) {
+            for (size_t i = chunk->end; i-- > chunk->begin;) {
+                if (!first) {
+                    os << " ";
+                }
+
+                if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+
+                os << *chunk->slot(i);
+                first = false;
+            }
+        }
+
+        if (!os.good()) throw std::runtime_error("Output stream failed after serialization");
+
+        return os;
+
+    } catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Stack serialization failed: ") + e.what());
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+std::istream& Stack<T, Chunked<N, Alloc>>::read(std::istream& is) {
+    try {
+        if (!is.good()) {
+            throw std::runtime_error("Input stream is in bad state");
+        }
+
+        // Everything read goes on top, so rolling back only pops it again
+        size_t oldSize = stackSize;
+
+        if constexpr (is_fast_parsable_v<T>) {
+            if (fast_parse_applies(is)) {
+                try {
+                    parse_text_elements<T>(is, [this](T value) { emplace(value); });
+                }
+                catch (...) {
+                    while (stackSize > oldSize) drop_top();
+                    throw;
+                }
+                return is;
+            }
+        }
+
+        try {
+            T value;
+            while (is >> value) {
+                try {
+                    this->push(value);
+                }
+                catch (const std::bad_alloc& e) {
+                    throw std::runtime_error("Memory allocation failed during input: " + std::string(e.what()));
+                }
+                catch (const std::exception& e) {
+                    throw std::runtime_error("Push operation failed during input: " + std::string(e.what()));
+                }
+
+                if (!is.good() && !is.eof()) {
+                    throw std::runtime_error("Input stream failed during data reading");
+                }
+            }
+
+            if (is.eof()) {
+                is.clear();
+            }
+
+            if (is.fail() && !is.eof()) {
+                throw std::runtime_error("Failed to parse input data");
+            }
+
+            return is;
+
+        }
+        catch (...) {
+            while (stackSize > oldSize) drop_top();
+            throw;
+        }
+
+    }
+    catch (const std::exception& e)
+    {
+        is.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Stack input failed: ") + e.what());
+    }
+}
+
+// Binary serialization
+template<typename T, size_t N, typename Alloc>
+std::ostream& Stack<T, Chunked<N, Alloc>>::save(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+        binary_write_header<T>(os, stackSize);
+        binary_write_elements<T>(os, begin(), end());
+        if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+        return os;
+    }
+    catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Stack save failed: ") + e.what());
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+std::istream& Stack<T, Chunked<N, Alloc>>::load(std::istream& is) {
+    try {
+        if (!is.good()) throw std::runtime_error("Input stream is in bad state");
+        binary_header header = binary_read_header<T>(is);
+
+        std::vector<T> staged;
+        binary_read_elements<T>(is, header.count, [&staged](T&& value) { staged.push_back(std::move(value)); });
+
+        size_t oldSize = stackSize;
+        try {
+            for (size_t i = staged.size(); i > 0; --i) emplace(std::move(staged[i - 1]));
+        }
+        catch (...) {
+            while (stackSize > oldSize) drop_top();
+            throw;
+        }
+        return is;
+    }
+    catch (const std::exception& e) {
+        is.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Stack load failed: ") + e.what());
+    }
+}
@@ -0,0 +1,238 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+#include "Node.h"
+#include "hazard_pointer.h"
+
+/**
+ * @brief Lock-free multi-producer/multi-consumer FIFO queue
+ * @tparam T The type of elements stored in the queue
+ * @tparam Alloc Allocator for the elements, rebound internally to the node type (default: std::allocator<T>).
+ *               Nodes are freed by whichever thread reclaims them, so the allocator must be thread-safe.
+ *
+ * Michael–Scott linked queue: producers only contend on the tail, consumers only on the
+ * head. Dequeued nodes are reclaimed through hazard pointers, so no thread can touch a
+ * node after it has been freed. The interface mirrors fwd_container<T> where that is
+ * meaningful under concurrency; references to elements and iteration are not offered,
+ * because another thread may pop the element at any moment.
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+class ConcurrentQueue {
+public:
+    using allocator_type = Alloc;
+
+    /**
+     * @brief Default constructor - creates an empty queue
+     * @throws std::runtime_error if the sentinel node cannot be allocated
+     */
+    ConcurrentQueue();
+
+    /**
+     * @brief Creates an empty queue that allocates its nodes through the given allocator
+     * @param alloc Allocator to use for all nodes of this queue
+     * @throws std::runtime_error if the sentinel node cannot be allocated
+     */
+    explicit ConcurrentQueue(const Alloc& alloc);
+
+    /**
+     * @brief Creates an empty queue that holds at most capacity elements
+     * @param capacity Maximum number of elements, or 0 for an unbounded queue
+     * @param alloc Allocator to use for all nodes of this queue
+     * @throws std::runtime_error if the sentinel node cannot be allocated
+     * 
+     * Producers reserve a slot before linking their node: push() spins while the queue
+     * is full, calling std::this_thread::yield() between attempts but never parking the
+     * thread, so a producer that outpaces its consumers keeps a core busy. try_push()
+     * gives up instead. Nodes are still allocated per element.
+     */
+    explicit ConcurrentQueue(size_t capacity, const Alloc& alloc = Alloc());
+
+    ConcurrentQueue(const ConcurrentQueue&) = delete;
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+    /**
+     * @brief Destructor - destroys remaining elements; no other thread may use the queue
+     */
+    ~ConcurrentQueue();
+
+    /**
+     * @brief Add element to the back of the queue (copy semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     *
+     * Spins while a bounded queue is full (see emplace).
+     */
+    void push(const T& value);
+
+    /**
+     * @brief Add element to the back of the queue (move semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     *
+     * Spins while a bounded queue is full (see emplace).
+     */
+    void push(T&& value);
+
+    /**
+     * @brief Construct an element in place at the back of the queue
+     * @param args Arguments forwarded to the T constructor
+     * @throws std::runtime_error if memory allocation fails
+     * 
+     * On a bounded queue that is full this spins, yielding the thread between attempts,
+     * until a consumer frees a slot; it does not sleep on a wait/notify primitive.
+     */
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    /**
+     * @brief Add element to the back of the queue unless it is full (copy semantics)
+     * @param value The value to add
+     * @return True if the element was added, false if a bounded queue was at capacity
+     * @throws std::runtime_error if memory allocation fails
+     */
+    bool try_push(const T& value);
+
+    /**
+     * @brief Add element to the back of the queue unless it is full (move semantics)
+     * @param value The value to add (left untouched if the queue is full)
+     * @return True if the element was added, false if a bounded queue was at capacity
+     * @throws std::runtime_error if memory allocation fails
+     */
+    bool try_push(T&& value);
+
+    /**
+     * @brief Construct an element in place at the back of the queue unless it is full
+     * @param args Arguments forwarded to the T constructor
+     * @return True if the element was added, false if a bounded queue was at capacity
+     * @throws std::runtime_error if memory allocation fails
+     */
+    template<typename... Args>
+    bool try_emplace(Args&&... args);
+
+    /**
+     * @brief Remove the front element if there is one
+     * @param out Receives the removed element
+     * @return True if an element was removed, false if the queue was empty
+     */
+    bool try_pop(T& out);
+
+    /**
+     * @brief Remove the front element if there is one
+     * @return The removed element, or std::nullopt if the queue was empty
+     */
+    std::optional<T> try_pop();
+
+    /**
+     * @brief Remove and return the front element
+     * @return The removed element
+     * @throws std::runtime_error if queue is empty
+     */
+    T pop();
+
+    /**
+     * @brief Check if queue is empty at the moment of the call
+     * @return True if queue is empty, false otherwise
+     */
+    bool is_empty() const;
+
+    /**
+     * @brief Checks if the queue is empty at the moment of the call
+     * @return true if queue is empty, false otherwise
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the approximate number of elements in queue
+     * @return Size of the queue; exact only while no other thread is pushing or popping
+     */
+    size_t size() const;
+
+    /**
+     * @brief Get the maximum number of elements the queue may hold
+     * @return Capacity given at construction, or 0 if the queue is unbounded
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Returns a copy of the allocator associated with the queue
+     * @return Allocator rebound back to the element type
+     */
+    Alloc get_allocator() const;
+
+private:
+    struct node {
+        std::atomic<node*> next{nullptr};               ///< Next node towards the tail
+        alignas(T) unsigned char storage[sizeof(T)];    ///< Element storage (empty for the sentinel)
+
+        node() noexcept {}
+
+        T* value() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    struct reclaimer {
+        NodeAllocator* alloc; ///< Allocator the nodes came from
+
+        void operator()(node* n) const noexcept { destroy_node(*alloc, n); }
+    };
+
+    using Domain = HazardDomain<node, reclaimer>;
+
+    static constexpr size_t cache_line = 64;
+
+    /**
+     * @brief Allocate a node, construct the element and link it (slot already reserved)
+     * @param args Arguments forwarded to the T constructor
+     */
+    template<typename... Args>
+    void publish(Args&&... args);
+
+    /**
+     * @brief Claim one slot of a bounded queue
+     * @return True if a slot was claimed, false if the queue was full
+     */
+    bool reserve_slot() noexcept;
+
+    /**
+     * @brief Give back a slot claimed by reserve_slot (no-op when unbounded)
+     */
+    void release_slot() noexcept;
+
+    /**
+     * @brief Link a node holding a constructed element behind the current tail
+     * @param n Node to publish
+     * @param tailGuard Guard used to protect the tail while linking
+     */
+    void enqueue(node* n, typename Domain::guard& tailGuard) noexcept;
+
+    /**
+     * @brief Unlink the current sentinel, making its successor the new sentinel
+     * @param headGuard Guard used to protect the sentinel while unlinking
+     * @param nextGuard Guard left protecting the returned node
+     * @return Node holding the dequeued element (now owned by the caller), or nullptr if empty
+     * 
+     * The old sentinel is retired. The caller must destroy the element in the returned
+     * node before releasing nextGuard; the node itself is reclaimed once it is dequeued
+     * past in turn.
+     */
+    node* dequeue(typename Domain::guard& headGuard, typename Domain::guard& nextGuard) noexcept;
+
+    alignas(cache_line) std::atomic<node*> head; ///< Sentinel; its successor holds the front element
+    std::atomic<size_t> popCount;                ///< Number of completed pops
+    alignas(cache_line) std::atomic<node*> tail; ///< Last node (or one behind it while a push completes)
+    std::atomic<size_t> pushCount;               ///< Number of completed pushes
+    alignas(cache_line) std::atomic<size_t> occupied; ///< Slots reserved by producers and not yet freed by pops
+    size_t queueCapacity;                             ///< Maximum number of elements, 0 if unbounded
+    alignas(cache_line) NodeAllocator nodeAlloc; ///< Allocator providing storage for the nodes
+    mutable Domain hazards;                      ///< Reclaims dequeued sentinels
+};
+
+#include "concurrent_queue.ipp"
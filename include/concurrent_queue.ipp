@@ -0,0 +1,244 @@
+#include "concurrent_queue.h"
+
+// ConcurrentQueue constructors
+template<typename T, typename Alloc>
+ConcurrentQueue<T, Alloc>::ConcurrentQueue() : ConcurrentQueue(Alloc()) {}
+
+template<typename T, typename Alloc>
+ConcurrentQueue<T, Alloc>::ConcurrentQueue(const Alloc& alloc) : ConcurrentQueue(0, alloc) {}
+
+template<typename T, typename Alloc>
+ConcurrentQueue<T, Alloc>::ConcurrentQueue(size_t capacity, const Alloc& alloc)
+    : head(nullptr), popCount(0), tail(nullptr), pushCount(0), occupied(0), queueCapacity(capacity),
+      nodeAlloc(alloc), hazards(reclaimer{&nodeAlloc}) {
+    try {
+        node* sentinel = create_node(nodeAlloc);
+        head.store(sentinel, std::memory_order_relaxed);
+        tail.store(sentinel, std::memory_order_relaxed);
+    }
+    catch (std::bad_alloc& e) {
+        throw std::runtime_error("Failed to allocate memory for queue sentinel: " + std::string(e.what()));
+    }
+}
+
+template<typename T, typename Alloc>
+ConcurrentQueue<T, Alloc>::~ConcurrentQueue() {
+    node* sentinel = head.load(std::memory_order_acquire);
+    node* current = sentinel->next.load(std::memory_order_relaxed);
+    destroy_node(nodeAlloc, sentinel);
+
+    while (current != nullptr) {
+        node* next = current->next.load(std::memory_order_relaxed);
+        current->value()->~T();
+        destroy_node(nodeAlloc, current);
+        current = next;
+    }
+}
+
+// Producers
+template<typename T, typename Alloc>
+void ConcurrentQueue<T, Alloc>::push(const T& value) {
+    emplace(value);
+}
+
+template<typename T, typename Alloc>
+void ConcurrentQueue<T, Alloc>::push(T&& value) {
+    emplace(std::move(value));
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+void ConcurrentQueue<T, Alloc>::emplace(Args&&... args) {
+    // Busy-wait for a slot: consumers free slots without any notification to sleep on
+    while (!reserve_slot()) std::this_thread::yield();
+    try {
+        publish(std::forward<Args>(args)...);
+    }
+    catch (...) {
+        release_slot();
+        throw;
+    }
+}
+
+template<typename T, typename Alloc>
+bool ConcurrentQueue<T, Alloc>::try_push(const T& value) {
+    return try_emplace(value);
+}
+
+template<typename T, typename Alloc>
+bool ConcurrentQueue<T, Alloc>::try_push(T&& value) {
+    return try_emplace(std::move(value));
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+bool ConcurrentQueue<T, Alloc>::try_emplace(Args&&... args) {
+    if (!reserve_slot()) return false;
+    try {
+        publish(std::forward<Args>(args)...);
+    }
+    catch (...) {
+        release_slot();
+        throw;
+    }
+    return true;
+}
+
+template<typename T, typename Alloc>
+bool ConcurrentQueue<T, Alloc>::reserve_slot() noexcept {
+    if (queueCapacity == 0) return true;
+
+    size_t current = occupied.load(std::memory_order_relaxed);
+    do {
+        if (current >= queueCapacity) return false;
+    } while (!occupied.compare_exchange_weak(current, current + 1, std::memory_order_acquire, std::memory_order_relaxed));
+    return true;
+}
+
+template<typename T, typename Alloc>
+void ConcurrentQueue<T, Alloc>::release_slot() noexcept {
+    if (queueCapacity != 0) occupied.fetch_sub(1, std::memory_order_release);
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+void ConcurrentQueue<T, Alloc>::publish(Args&&... args) {
+    node* n = nullptr;
+    try {
+        typename Domain::guard tailGuard(hazards);
+        n = create_node(nodeAlloc);
+        ::new (static_cast<void*>(n->storage)) T(std::forward<Args>(args)...);
+        enqueue(n, tailGuard);
+    }
+    catch (std::bad_alloc& e) {
+        if (n) destroy_node(nodeAlloc, n);
+        throw std::runtime_error("Failed to allocate memory for new queue element: " + std::string(e.what()));
+    }
+    catch (...) {
+        if (n) destroy_node(nodeAlloc, n);
+        throw;
+    }
+}
+
+template<typename T, typename Alloc>
+void ConcurrentQueue<T, Alloc>::enqueue(node* n, typename Domain::guard& tailGuard) noexcept {
+    while (true) {
+        node* last = tailGuard.protect(tail);
+        node* next = last->next.load(std::memory_order_acquire);
+        if (last != tail.load(std::memory_order_acquire)) continue;
+
+        if (next == nullptr) {
+            if (last->next.compare_exchange_weak(next, n, std::memory_order_release, std::memory_order_relaxed)) {
+                // Swing the tail; if this fails another thread already helped
+                tail.compare_exchange_strong(last, n, std::memory_order_release, std::memory_order_relaxed);
+                break;
+            }
+        } else {
+            // Tail is lagging behind a finished push; help it forward
+            tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+        }
+    }
+    pushCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Consumers
+template<typename T, typename Alloc>
+auto ConcurrentQueue<T, Alloc>::dequeue(typename Domain::guard& headGuard, typename Domain::guard& nextGuard) noexcept -> node* {
+    while (true) {
+        node* first = headGuard.protect(head);
+        node* last = tail.load(std::memory_order_acquire);
+        node* next = nextGuard.protect(first->next);
+        if (first != head.load(std::memory_order_acquire)) continue;
+
+        if (next == nullptr) return nullptr;
+
+        if (first == last) {
+            tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (head.compare_exchange_strong(first, next)) {
+            headGuard.reset();
+            headGuard.retire(first);
+            popCount.fetch_add(1, std::memory_order_relaxed);
+            return next;
+        }
+    }
+}
+
+template<typename T, typename Alloc>
+bool ConcurrentQueue<T, Alloc>::try_pop(T& out) {
+    typename Domain::guard headGuard(hazards);
+    typename Domain::guard nextGuard(hazards);
+    node* front = dequeue(headGuard, nextGuard);
+    if (front == nullptr) return false;
+    release_slot();
+
+    T* element = front->value();
+    try {
+        out = std::move(*element);
+    }
+    catch (...) {
+        element->~T();
+        throw;
+    }
+    element->~T();
+    return true;
+}
+
+template<typename T, typename Alloc>
+std::optional<T> ConcurrentQueue<T, Alloc>::try_pop() {
+    typename Domain::guard headGuard(hazards);
+    typename Domain::guard nextGuard(hazards);
+    node* front = dequeue(headGuard, nextGuard);
+    if (front == nullptr) return std::nullopt;
+    release_slot();
+
+    T* element = front->value();
+    try {
+        std::optional<T> result(std::move(*element));
+        element->~T();
+        return result;
+    }
+    catch (...) {
+        element->~T();
+        throw;
+    }
+}
+
+template<typename T, typename Alloc>
+T ConcurrentQueue<T, Alloc>::pop() {
+    std::optional<T> value = try_pop();
+    if (!value) throw std::runtime_error("Cannot pop: ConcurrentQueue is empty");
+    return std::move(*value);
+}
+
+// Observers
+template<typename T, typename Alloc>
+bool ConcurrentQueue<T, Alloc>::is_empty() const {
+    typename Domain::guard headGuard(hazards);
+    node* first = headGuard.protect(head);
+    return first->next.load(std::memory_order_acquire) == nullptr;
+}
+
+template<typename T, typename Alloc>
+bool ConcurrentQueue<T, Alloc>::empty() const {
+    return is_empty();
+}
+
+template<typename T, typename Alloc>
+size_t ConcurrentQueue<T, Alloc>::size() const {
+    size_t popped = popCount.load(std::memory_order_relaxed);
+    size_t pushed = pushCount.load(std::memory_order_relaxed);
+    return pushed > popped ? pushed - popped : 0;
+}
+
+template<typename T, typename Alloc>
+size_t ConcurrentQueue<T, Alloc>::capacity() const {
+    return queueCapacity;
+}
+
+template<typename T, typename Alloc>
+Alloc ConcurrentQueue<T, Alloc>::get_allocator() const {
+    return Alloc(nodeAlloc);
+}
@@ -0,0 +1,154 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+#include "Node.h"
+#include "stack.h"
+#include "hazard_pointer.h"
+
+/**
+ * @brief Lock-free multi-producer/multi-consumer LIFO stack
+ * @tparam T The type of elements stored in the stack
+ * @tparam Alloc Allocator for the elements, rebound internally to Node<T> (default: std::allocator<T>).
+ *               Nodes are freed by whichever thread reclaims them, so the allocator must be thread-safe.
+ *
+ * Treiber stack: push and pop are a single compare-and-swap on the top pointer. Popped
+ * nodes are reclaimed through hazard pointers, which also rules out ABA on the top
+ * pointer, because a node cannot be reused while a thread still holds its address.
+ * Nodes are plain Node<T>, so pop_all() can hand the whole chain to a Stack<T, Alloc>
+ * without copying. As with ConcurrentQueue, references to elements and iteration are
+ * not offered.
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+class ConcurrentStack {
+public:
+    using allocator_type = Alloc;
+
+    /**
+     * @brief Default constructor - creates an empty stack
+     */
+    ConcurrentStack();
+
+    /**
+     * @brief Creates an empty stack that allocates its nodes through the given allocator
+     * @param alloc Allocator to use for all nodes of this stack
+     */
+    explicit ConcurrentStack(const Alloc& alloc);
+
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+    /**
+     * @brief Destructor - destroys remaining elements; no other thread may use the stack
+     */
+    ~ConcurrentStack();
+
+    /**
+     * @brief Push element onto the top of the stack (copy semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     */
+    void push(const T& value);
+
+    /**
+     * @brief Push element onto the top of the stack (move semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     */
+    void push(T&& value);
+
+    /**
+     * @brief Construct an element in place on the top of the stack
+     * @param args Arguments forwarded to the T constructor
+     * @throws std::runtime_error if memory allocation fails
+     */
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    /**
+     * @brief Remove the top element if there is one
+     * @param out Receives the removed element
+     * @return True if an element was removed, false if the stack was empty
+     */
+    bool try_pop(T& out);
+
+    /**
+     * @brief Remove the top element if there is one
+     * @return The removed element, or std::nullopt if the stack was empty
+     */
+    std::optional<T> try_pop();
+
+    /**
+     * @brief Remove and return the top element
+     * @return The removed element
+     * @throws std::runtime_error if stack is empty
+     */
+    T pop();
+
+    /**
+     * @brief Atomically detach every element into a plain stack
+     * @return Stack holding all elements that were present, top element first
+     *
+     * The chain is taken in one exchange of the top pointer and adopted as is. Before
+     * returning, the call waits until no concurrent pop still holds a hazard pointer to
+     * one of the detached nodes.
+     */
+    Stack<T, Alloc> pop_all();
+
+    /**
+     * @brief Check if stack is empty at the moment of the call
+     * @return True if stack is empty, false otherwise
+     */
+    bool is_empty() const;
+
+    /**
+     * @brief Checks if the stack is empty at the moment of the call
+     * @return true if stack is empty, false otherwise
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the approximate number of elements in stack
+     * @return Size of the stack; exact only while no other thread is pushing or popping
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns a copy of the allocator associated with the stack
+     * @return Allocator rebound back to the element type
+     */
+    Alloc get_allocator() const;
+
+private:
+    using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node<T>>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    struct reclaimer {
+        NodeAllocator* alloc; ///< Allocator the nodes came from
+
+        void operator()(Node<T>* n) const noexcept { destroy_node(*alloc, n); }
+    };
+
+    using Domain = HazardDomain<Node<T>, reclaimer>;
+
+    static constexpr size_t cache_line = 64;
+
+    /**
+     * @brief Unlink the current top node
+     * @param topGuard Guard left protecting the returned node
+     * @return Detached node (owned by the caller, to be retired through topGuard), or nullptr if empty
+     */
+    Node<T>* unlink_top(typename Domain::guard& topGuard) noexcept;
+
+    alignas(cache_line) std::atomic<Node<T>*> topNode; ///< Pointer to the top node of the stack
+    std::atomic<size_t> pushCount;                     ///< Number of completed pushes
+    std::atomic<size_t> popCount;                      ///< Number of elements removed by pop or pop_all
+    alignas(cache_line) NodeAllocator nodeAlloc;       ///< Allocator providing storage for the nodes
+    Domain hazards;                                    ///< Reclaims popped nodes
+};
+
+#include "concurrent_stack.ipp"
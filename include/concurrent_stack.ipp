@@ -0,0 +1,140 @@
+#include "concurrent_stack.h"
+
+// ConcurrentStack constructors
+template<typename T, typename Alloc>
+ConcurrentStack<T, Alloc>::ConcurrentStack() : ConcurrentStack(Alloc()) {}
+
+template<typename T, typename Alloc>
+ConcurrentStack<T, Alloc>::ConcurrentStack(const Alloc& alloc)
+    : topNode(nullptr), pushCount(0), popCount(0), nodeAlloc(alloc), hazards(reclaimer{&nodeAlloc}) {}
+
+template<typename T, typename Alloc>
+ConcurrentStack<T, Alloc>::~ConcurrentStack() {
+    destroy_chain(nodeAlloc, topNode.load(std::memory_order_acquire));
+}
+
+// Producers
+template<typename T, typename Alloc>
+void ConcurrentStack<T, Alloc>::push(const T& value) {
+    emplace(value);
+}
+
+template<typename T, typename Alloc>
+void ConcurrentStack<T, Alloc>::push(T&& value) {
+    emplace(std::move(value));
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+void ConcurrentStack<T, Alloc>::emplace(Args&&... args) {
+    Node<T>* newNode = nullptr;
+    try {
+        newNode = create_node(nodeAlloc, std::in_place, nullptr, std::forward<Args>(args)...);
+    }
+    catch (std::bad_alloc& e) {
+        throw std::runtime_error("Failed to allocate memory for new stack element: " + std::string(e.what()));
+    }
+
+    // The new node is private until the exchange succeeds, so no hazard is needed here
+    Node<T>* head = topNode.load(std::memory_order_relaxed);
+    do {
+        newNode->next = head;
+    } while (!topNode.compare_exchange_weak(head, newNode, std::memory_order_release, std::memory_order_relaxed));
+    pushCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Consumers
+template<typename T, typename Alloc>
+Node<T>* ConcurrentStack<T, Alloc>::unlink_top(typename Domain::guard& topGuard) noexcept {
+    while (true) {
+        Node<T>* head = topGuard.protect(topNode);
+        if (head == nullptr) return nullptr;
+
+        Node<T>* next = head->next;
+        if (topNode.compare_exchange_weak(head, next)) {
+            popCount.fetch_add(1, std::memory_order_relaxed);
+            return head;
+        }
+    }
+}
+
+template<typename T, typename Alloc>
+bool ConcurrentStack<T, Alloc>::try_pop(T& out) {
+    typename Domain::guard topGuard(hazards);
+    Node<T>* head = unlink_top(topGuard);
+    if (head == nullptr) return false;
+
+    topGuard.reset();
+    try {
+        out = std::move(head->data);
+    }
+    catch (...) {
+        topGuard.retire(head);
+        throw;
+    }
+    topGuard.retire(head);
+    return true;
+}
+
+template<typename T, typename Alloc>
+std::optional<T> ConcurrentStack<T, Alloc>::try_pop() {
+    typename Domain::guard topGuard(hazards);
+    Node<T>* head = unlink_top(topGuard);
+    if (head == nullptr) return std::nullopt;
+
+    topGuard.reset();
+    try {
+        std::optional<T> result(std::move(head->data));
+        topGuard.retire(head);
+        return result;
+    }
+    catch (...) {
+        topGuard.retire(head);
+        throw;
+    }
+}
+
+template<typename T, typename Alloc>
+T ConcurrentStack<T, Alloc>::pop() {
+    std::optional<T> value = try_pop();
+    if (!value) throw std::runtime_error("Cannot pop: ConcurrentStack is empty");
+    return std::move(*value);
+}
+
+template<typename T, typename Alloc>
+Stack<T, Alloc> ConcurrentStack<T, Alloc>::pop_all() {
+    Node<T>* chain = topNode.exchange(nullptr, std::memory_order_acq_rel);
+
+    // A pop that read one of these nodes before the exchange may still dereference it;
+    // none can start protecting them any more, so wait for the published ones to clear
+    size_t count = 0;
+    for (Node<T>* current = chain; current != nullptr; current = current->next) {
+        while (hazards.is_protected(current)) std::this_thread::yield();
+        ++count;
+    }
+    popCount.fetch_add(count, std::memory_order_relaxed);
+    return Stack<T, Alloc>(chain, count, nodeAlloc);
+}
+
+// Observers
+template<typename T, typename Alloc>
+bool ConcurrentStack<T, Alloc>::is_empty() const {
+    return topNode.load(std::memory_order_acquire) == nullptr;
+}
+
+template<typename T, typename Alloc>
+bool ConcurrentStack<T, Alloc>::empty() const {
+    return is_empty();
+}
+
+template<typename T, typename Alloc>
+size_t ConcurrentStack<T, Alloc>::size() const {
+    size_t popped = popCount.load(std::memory_order_relaxed);
+    size_t pushed = pushCount.load(std::memory_order_relaxed);
+    return pushed > popped ? pushed - popped : 0;
+}
+
+template<typename T, typename Alloc>
+Alloc ConcurrentStack<T, Alloc>::get_allocator() const {
+    return Alloc(nodeAlloc);
+}
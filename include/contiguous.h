@@ -0,0 +1,19 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+
+/**
+ * @brief Storage policy tag selecting a contiguous, vector-like buffer for Stack
+ * @tparam InlineCapacity Number of elements stored inside the stack object itself before
+ *         the buffer moves to the heap (default: 0, always heap-allocated)
+ * @tparam Alloc Allocator, rebound internally to the element type (default: std::allocator<void>)
+ *
+ * Used in place of the allocator parameter: Stack<int, ContiguousStorage<32>> keeps its
+ * first 32 elements inline and grows a single heap buffer by doubling after that, so
+ * push and pop touch one array instead of allocating a node per element.
+ */
+template<size_t InlineCapacity = 0, typename Alloc = std::allocator<void>>
+struct ContiguousStorage {
+    static constexpr size_t inline_capacity = InlineCapacity; ///< Elements stored without allocating
+    using allocator_type = Alloc;                              ///< Allocator the heap buffer is drawn from
+};
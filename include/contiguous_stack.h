@@ -0,0 +1,629 @@
+#pragma once
+#include <iostream>
+#include <memory>
+#include <exception>
+#include <sstream>
+#include <vector>
+
+#include "contiguous.h"
+#include "stack.h"
+
+/**
+ * @brief Stack implementation using one contiguous, growable buffer
+ * @tparam T Type of elements stored in the stack
+ * @tparam N Number of elements stored inline before the first heap allocation
+ * @tparam Alloc Allocator, rebound internally to T
+ *
+ * Elements live bottom-up in an array; the top is the last constructed slot. The
+ * buffer starts in the stack object itself (when N > 0) and doubles on the heap
+ * once it fills. Popping never shrinks it, so a stack that keeps going up and down
+ * stops allocating. Iteration still runs from the top down, like Stack<T>.
+ */
+template<typename T, size_t N, typename Alloc>
+class Stack<T, ContiguousStorage<N, Alloc>> final : public fwd_container<T> {
+public:
+    /**
+     * @brief Iterator implementation for contiguous Stack (non-const version)
+     */
+    class contiguous_stack_iterator {
+    private:
+        T* base;      ///< Start of the element buffer
+        size_t index; ///< Number of elements from the bottom up to and including the current one (0 at the end)
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = T*;
+        using reference         = T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        contiguous_stack_iterator() : base(nullptr), index(0) {}
+
+        /**
+         * @brief Constructor
+         * @param b Start of the element buffer
+         * @param i One past the slot of the element to point at
+         */
+        contiguous_stack_iterator(T* b, size_t i) : base(b), index(i) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Reference to the current element
+         */
+        T& operator*() const {
+            return base[index - 1];
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Pointer to the current element
+         */
+        T* operator->() const {
+            return base + (index - 1);
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        contiguous_stack_iterator& operator++() {
+            --index;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        contiguous_stack_iterator operator++(int) {
+            contiguous_stack_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Advance by several elements, in constant time
+         * @param n Number of elements to skip (at most the distance to the end)
+         * @return Reference to this iterator
+         */
+        contiguous_stack_iterator& skip(size_t n) {
+            index -= n;
+            return *this;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same slot
+         */
+        friend bool operator==(const contiguous_stack_iterator& lhs, const contiguous_stack_iterator& rhs) {
+            return lhs.base == rhs.base && lhs.index == rhs.index;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different slots
+         */
+        friend bool operator!=(const contiguous_stack_iterator& lhs, const contiguous_stack_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the element buffer
+         * @return Pointer to the bottom slot
+         */
+        T* get_base() const { return base; }
+
+        /**
+         * @brief Get the current position
+         * @return One past the slot of the current element
+         */
+        size_t get_index() const { return index; }
+    };
+
+    /**
+     * @brief Const iterator implementation for contiguous Stack
+     */
+    class contiguous_stack_const_iterator {
+    private:
+        const T* base; ///< Start of the element buffer
+        size_t index;  ///< Number of elements from the bottom up to and including the current one (0 at the end)
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = const T*;
+        using reference         = const T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        contiguous_stack_const_iterator() : base(nullptr), index(0) {}
+
+        /**
+         * @brief Constructor
+         * @param b Start of the element buffer
+         * @param i One past the slot of the element to point at
+         */
+        contiguous_stack_const_iterator(const T* b, size_t i) : base(b), index(i) {}
+
+        /**
+         * @brief Constructor from non-const iterator
+         * @param other Iterator to convert from
+         */
+        contiguous_stack_const_iterator(const contiguous_stack_iterator& other) : base(other.get_base()), index(other.get_index()) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Const reference to the current element
+         */
+        const T& operator*() const {
+            return base[index - 1];
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Const pointer to the current element
+         */
+        const T* operator->() const {
+            return base + (index - 1);
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        contiguous_stack_const_iterator& operator++() {
+            --index;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        contiguous_stack_const_iterator operator++(int) {
+            contiguous_stack_const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Advance by several elements, in constant time
+         * @param n Number of elements to skip (at most the distance to the end)
+         * @return Reference to this iterator
+         */
+        contiguous_stack_const_iterator& skip(size_t n) {
+            index -= n;
+            return *this;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same slot
+         */
+        friend bool operator==(const contiguous_stack_const_iterator& lhs, const contiguous_stack_const_iterator& rhs) {
+            return lhs.base == rhs.base && lhs.index == rhs.index;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different slots
+         */
+        friend bool operator!=(const contiguous_stack_const_iterator& lhs, const contiguous_stack_const_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the element buffer
+         * @return Const pointer to the bottom slot
+         */
+        const T* get_base() const { return base; }
+
+        /**
+         * @brief Get the current position
+         * @return One past the slot of the current element
+         */
+        size_t get_index() const { return index; }
+    };
+
+    using iterator = contiguous_stack_iterator;
+    using const_iterator = contiguous_stack_const_iterator;
+    using allocator_type = Alloc;
+
+    static constexpr size_t inline_capacity = N; ///< Elements stored without allocating
+
+    /**
+     * @brief Default constructor - creates an empty stack
+     */
+    Stack();
+
+    /**
+     * @brief Creates an empty stack that allocates its heap buffer through the given allocator
+     * @param alloc Allocator to use for the buffer of this stack
+     */
+    explicit Stack(const Alloc& alloc);
+
+    /**
+     * @brief Copy constructor - creates a deep copy of another stack
+     * @param other Stack to copy from
+     * @throws std::runtime_error if memory allocation fails during copying
+     */
+    Stack(const Stack& other);
+
+    /**
+     * @brief Move constructor - transfers ownership from another stack
+     * @param other Stack to move from (will be left in valid but empty state)
+     *
+     * A heap buffer is taken over as is; inline elements are moved one by one.
+     */
+    Stack(Stack&& other);
+
+    /**
+     * @brief Copy assignment operator
+     * @param other Stack to copy from
+     * @return Reference to this stack
+     * @throws std::runtime_error if memory allocation fails during copying
+     */
+    Stack& operator=(const Stack& other);
+
+    /**
+     * @brief Move assignment operator
+     * @param other Stack to move from
+     * @return Reference to this stack
+     */
+    Stack& operator=(Stack&& other);
+
+    /**
+     * @brief Virtual destructor
+     */
+    ~Stack();
+
+    // fwd_container interface implementation
+    /**
+     * @brief Add element to the top of the stack (copy semantics)
+     * @param value The value to add
+     */
+    void push(const T& value) override;
+
+    /**
+     * @brief Add element to the top of the stack (move semantics)
+     * @param value The value to add
+     */
+    void push(T&& value) override;
+
+    /**
+     * @brief Construct an element in place on the top of the stack
+     * @param args Arguments forwarded to the T constructor (may refer to elements of this stack)
+     * @return Reference to the new element
+     * @throws std::runtime_error if memory allocation fails
+     */
+    template<typename... Args>
+    T& emplace(Args&&... args);
+
+    /**
+     * @brief Remove and return element from the top of the stack
+     * @return The removed element from top
+     * @throws std::runtime_error if stack is empty
+     */
+    T pop() override;
+
+    /**
+     * @brief Get reference to the top element
+     * @return Reference to the top element
+     * @throws std::runtime_error if stack is empty
+     */
+    T& get_front() override;
+
+    /**
+     * @brief Get const reference to the top element
+     * @return Const reference to the top element
+     * @throws std::runtime_error if stack is empty
+     */
+    const T& get_front() const override;
+
+    /**
+     * @brief Remove the top element if there is one; never throws on empty
+     * @param out Receives the removed element
+     * @return True if an element was removed, false if the stack was empty
+     */
+    bool try_pop(T& out) override;
+
+    /**
+     * @brief Remove the top element if there is one; never throws on empty
+     * @return The removed element, or std::nullopt if the stack was empty
+     */
+    std::optional<T> try_pop() override;
+
+    /**
+     * @brief Get pointer to the top element
+     * @return Pointer to the top element, or nullptr if the stack is empty
+     */
+    T* try_front() noexcept override;
+
+    /**
+     * @brief Get const pointer to the top element
+     * @return Const pointer to the top element, or nullptr if the stack is empty
+     */
+    const T* try_front() const noexcept override;
+
+    /**
+     * @brief Check if stack is empty
+     * @return True if stack is empty, false otherwise
+     */
+    bool is_empty() const override;
+
+    /**
+     * @brief Get the number of elements in stack
+     * @return Size of the stack
+     */
+    size_t size() const override;
+
+    /**
+     * @brief Write the stack in the binary format, top element first
+     * @param os Output stream (should be opened in binary mode)
+     * @return Reference to the output stream
+     * @throws std::runtime_error if an element cannot be encoded or the stream fails
+     */
+    std::ostream& save(std::ostream& os) const override;
+
+    /**
+     * @brief Place the elements stored by save() on top of the stack
+     * @param is Input stream (should be opened in binary mode)
+     * @return Reference to the input stream
+     * @throws std::runtime_error if the data is malformed or memory allocation fails
+     *
+     * The stream lists the top element first, so the decoded elements are staged and
+     * pushed bottom-up; on failure the pushed elements are popped again.
+     */
+    std::istream& load(std::istream& is) override;
+
+    /**
+     * @brief Assignment from any fwd_container
+     * @param other Container to copy from
+     * @return Reference to this stack
+     * @throws std::bad_cast if other is not a contiguous stack of the same type
+     */
+    Stack& operator=(const fwd_container<T>& other) override;
+
+    /**
+     * @brief Get iterator to the beginning of the stack
+     * @return Iterator to the first element (top of stack)
+     */
+    iterator begin();
+
+    /**
+     * @brief Get iterator to the end of the stack
+     * @return Iterator to the position after the last element
+     */
+    iterator end();
+
+    /**
+     * @brief Get const iterator to the beginning of the stack
+     * @return Const iterator to the first element (top of stack)
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Get const iterator to the end of the stack
+     * @return Const iterator to the position after the last element
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief Get const iterator to the beginning of the stack
+     * @return Const iterator to the first element (top of stack)
+     */
+    const_iterator cbegin() const;
+
+    /**
+     * @brief Get const iterator to the end of the stack
+     * @return Const iterator to the position after the last element
+     */
+    const_iterator cend() const;
+
+    /**
+     * @brief Returns the number of elements in the stack
+     * @return Current size of the stack
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Returns the number of elements the current buffer holds without growing
+     * @return Buffer capacity in elements
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Grows the buffer so that at least count elements fit without reallocating
+     * @param count Minimum capacity in elements
+     * @throws std::runtime_error if memory allocation fails; the stack is unchanged
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Checks whether the elements currently live in the inline buffer
+     * @return True if no heap buffer is in use
+     */
+    bool is_inline() const;
+
+    /**
+     * @brief Returns a reference to the top element (non-const version)
+     * @return Reference to the top element
+     * @throws std::runtime_error if stack is empty
+     */
+    T& top();
+
+    /**
+     * @brief Returns a reference to top element (const version)
+     * @return Const reference to top element
+     * @throws std::runtime_error if stack is empty
+     */
+    const T& top() const;
+
+    /**
+     * @brief Removes all elements from the stack, keeping the buffer for reuse
+     */
+    void clear();
+
+    /**
+     * @brief Checks if the stack is empty
+     * @return true if stack is empty, false otherwise
+     */
+    bool empty() const;
+
+    static constexpr bool reversed_spans = true; ///< Addresses inside a for_each_span() run descend in iteration order
+
+    /**
+     * @brief Visit the elements as runs of contiguous memory
+     * @param f Callable taking (const T* first, const T* last) and returning false to stop early
+     *
+     * A single run from the bottom element to the top one, the reverse of iteration order;
+     * nothing is visited when the stack is empty.
+     */
+    template<typename F>
+    void for_each_span(F&& f) const;
+
+    /**
+     * @brief Visit the elements as runs of contiguous, modifiable memory
+     * @param f Callable taking (T* first, T* last) and returning false to stop early
+     */
+    template<typename F>
+    void for_each_span(F&& f);
+
+    /**
+     * @brief Returns a copy of the allocator associated with the stack
+     * @return Allocator rebound back to the policy's allocator type
+     */
+    Alloc get_allocator() const;
+
+protected:
+    /**
+     * @brief Create a polymorphic iterator to the beginning of the stack
+     * @return Type-erased iterator to the first element
+     */
+    typename fwd_container<T>::iterator make_begin() override;
+
+    /**
+     * @brief Create a polymorphic iterator to the end of the stack
+     * @return Type-erased iterator to the position after the last element
+     */
+    typename fwd_container<T>::iterator make_end() override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the beginning of the stack
+     * @return Type-erased const iterator to the first element
+     */
+    typename fwd_container<T>::const_iterator make_begin() const override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the end of the stack
+     * @return Type-erased const iterator to the position after the last element
+     */
+    typename fwd_container<T>::const_iterator make_end() const override;
+
+    /**
+     * @brief Print stack contents to output stream
+     * @param os Output stream
+     * @return Reference to the output stream
+     */
+    virtual std::ostream& print(std::ostream& os) const override;
+
+    /**
+     * @brief Read stack contents from input stream
+     * @param is Input stream
+     * @return Reference to the input stream
+     */
+    virtual std::istream& read(std::istream& is) override;
+
+private:
+    using ElementAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+    using ElementTraits = std::allocator_traits<ElementAllocator>;
+
+    /**
+     * @brief Returns the inline buffer as an element array
+     * @return Pointer to the first inline slot, or nullptr when N is 0
+     */
+    T* inline_slots() noexcept;
+
+    /**
+     * @brief Capacity to grow to when the buffer is full
+     * @return Twice the current capacity, and at least a few elements
+     */
+    size_t grown_capacity() const;
+
+    /**
+     * @brief Allocates a heap buffer
+     * @param count Capacity of the buffer in elements
+     * @return Pointer to uninitialized storage
+     * @throws std::runtime_error if memory allocation fails
+     */
+    T* allocate_buffer(size_t count);
+
+    /**
+     * @brief Move-constructs (or copies, if moving may throw) all elements into another buffer
+     * @param destination Uninitialized storage for at least stackSize elements
+     * @throws Whatever the element constructor throws; destination is left empty and the elements untouched
+     */
+    void transfer_elements(T* destination);
+
+    /**
+     * @brief Switches to a buffer already holding the elements, releasing the current one
+     * @param buffer Heap buffer filled by transfer_elements()
+     * @param count Capacity of the new buffer
+     */
+    void adopt_buffer(T* buffer, size_t count) noexcept;
+
+    /**
+     * @brief Returns a heap buffer (if any) to the allocator and falls back to the inline slots (stack must be empty)
+     */
+    void release_buffer() noexcept;
+
+    /**
+     * @brief Copies the elements of another stack onto this (empty) stack
+     * @param other Stack to copy from
+     * @throws std::runtime_error if memory allocation fails; the stack is left empty
+     */
+    void copy_elements(const Stack& other);
+
+    /**
+     * @brief Moves the elements of another stack one by one onto this (empty) stack and clears the source
+     * @param other Stack to move from
+     */
+    void move_elements_from(Stack& other);
+
+    /**
+     * @brief Destroys the top element (stack must not be empty)
+     */
+    void drop_top() noexcept;
+
+    /**
+     * @brief Grows the buffer and constructs the new top element in it
+     * @param args Arguments forwarded to the T constructor
+     * @return Reference to the new element
+     *
+     * The element is constructed before the old buffer is released, so the arguments
+     * may refer to elements of this stack.
+     */
+    template<typename... Args>
+    T& emplace_grow(Args&&... args);
+
+    T* elements;                   ///< Bottom of the current buffer (inline or heap)
+    size_t stackSize;              ///< Number of elements in the stack
+    size_t stackCapacity;          ///< Number of slots in the current buffer
+    ElementAllocator elementAlloc; ///< Allocator providing the heap buffer
+    alignas(T) unsigned char inlineStorage[N > 0 ? N * sizeof(T) : 1]; ///< Raw storage for the inline elements
+};
+
+#include "contiguous_stack.ipp"
@@ -0,0 +1,559 @@
+#include "contiguous_stack.h"
+#include <cstring>
+
+// Contiguous Stack constructors and operators
+template<typename T, size_t N, typename Alloc>
+Stack<T, ContiguousStorage<N, Alloc>>::Stack()
+    : elements(inline_slots()), stackSize(0), stackCapacity(N), elementAlloc() {}
+
+template<typename T, size_t N, typename Alloc>
+Stack<T, ContiguousStorage<N, Alloc>>::Stack(const Alloc& alloc)
+    : elements(inline_slots()), stackSize(0), stackCapacity(N), elementAlloc(alloc) {}
+
+template<typename T, size_t N, typename Alloc>
+Stack<T, ContiguousStorage<N, Alloc>>::Stack(const Stack& other)
+    : elements(inline_slots()), stackSize(0), stackCapacity(N),
+      elementAlloc(ElementTraits::select_on_container_copy_construction(other.elementAlloc)) {
+    try {
+        copy_elements(other);
+    }
+    catch (...) {
+        release_buffer();
+        throw;
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+Stack<T, ContiguousStorage<N, Alloc>>::Stack(Stack&& other)
+    : elements(inline_slots()), stackSize(0), stackCapacity(N), elementAlloc(std::move(other.elementAlloc)) {
+    if (other.is_inline()) {
+        move_elements_from(other);
+        return;
+    }
+    elements = other.elements;
+    stackSize = other.stackSize;
+    stackCapacity = other.stackCapacity;
+
+    other.elements = other.inline_slots();
+    other.stackSize = 0;
+    other.stackCapacity = N;
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, ContiguousStorage<N, Alloc>>::operator=(const Stack& other) -> Stack& {
+    if (this != &other) {
+        clear();
+        if constexpr (ElementTraits::propagate_on_container_copy_assignment::value) {
+            // The buffer belongs to the allocator being replaced
+            if (elementAlloc != other.elementAlloc) release_buffer();
+            elementAlloc = other.elementAlloc;
+        }
+        copy_elements(other);
+    }
+    return *this;
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, ContiguousStorage<N, Alloc>>::operator=(Stack&& other) -> Stack& {
+    if (this != &other) {
+        clear();
+        bool adopt = !other.is_inline();
+        if constexpr (ElementTraits::propagate_on_container_move_assignment::value) {
+            release_buffer();
+            elementAlloc = std::move(other.elementAlloc);
+        }
+        else {
+            // A buffer owned by a foreign allocator cannot be adopted; move the elements over instead
+            if (elementAlloc != other.elementAlloc) adopt = false;
+        }
+
+        if (!adopt) {
+            move_elements_from(other);
+            return *this;
+        }
+
+        release_buffer();
+        elements = other.elements;
+        stackSize = other.stackSize;
+        stackCapacity = other.stackCapacity;
+
+        other.elements = other.inline_slots();
+        other.stackSize = 0;
+        other.stackCapacity = N;
+    }
+    return *this;
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, ContiguousStorage<N, Alloc>>::operator=(const fwd_container<T>& other) -> Stack& {
+    const Stack* derived = dynamic_cast<const Stack*>(&other);
+    if (!derived) {
+        throw std::bad_cast();
+    }
+    return *this = *derived;
+}
+
+template<typename T, size_t N, typename Alloc>
+Stack<T, ContiguousStorage<N, Alloc>>::~Stack() {
+    clear();
+    release_buffer();
+}
+
+// Buffer management
+template<typename T, size_t N, typename Alloc>
+T* Stack<T, ContiguousStorage<N, Alloc>>::inline_slots() noexcept {
+    if constexpr (N > 0) {
+        return reinterpret_cast<T*>(inlineStorage);
+    } else {
+        return nullptr;
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+size_t Stack<T, ContiguousStorage<N, Alloc>>::grown_capacity() const {
+    if (stackCapacity > ElementTraits::max_size(elementAlloc) / 2) {
+        throw std::runtime_error("Cannot push: Stack has reached its maximum size");
+    }
+    return stackCapacity < 4 ? 8 : stackCapacity * 2;
+}
+
+template<typename T, size_t N, typename Alloc>
+T* Stack<T, ContiguousStorage<N, Alloc>>::allocate_buffer(size_t count) {
+    try {
+        return ElementTraits::allocate(elementAlloc, count);
+    }
+    catch (const std::bad_alloc& e) {
+        throw std::runtime_error("Failed to allocate memory for stack buffer: " + std::string(e.what()));
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, ContiguousStorage<N, Alloc>>::transfer_elements(T* destination) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (stackSize > 0) std::memcpy(static_cast<void*>(destination), elements, stackSize * sizeof(T));
+    } else {
+        size_t done = 0;
+        try {
+            for (; done < stackSize; ++done) {
+                ::new (static_cast<void*>(destination + done)) T(std::move_if_noexcept(elements[done]));
+            }
+        }
+        catch (...) {
+            while (done > 0) destination[--done].~T();
+            throw;
+        }
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, ContiguousStorage<N, Alloc>>::adopt_buffer(T* buffer, size_t count) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (size_t i = 0; i < stackSize; ++i) elements[i].~T();
+    }
+    if (!is_inline()) ElementTraits::deallocate(elementAlloc, elements, stackCapacity);
+    elements = buffer;
+    stackCapacity = count;
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, ContiguousStorage<N, Alloc>>::release_buffer() noexcept {
+    if (!is_inline()) ElementTraits::deallocate(elementAlloc, elements, stackCapacity);
+    elements = inline_slots();
+    stackCapacity = N;
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, ContiguousStorage<N, Alloc>>::copy_elements(const Stack& other) {
+    try {
+        reserve(other.stackSize);
+        for (; stackSize < other.stackSize; ++stackSize) {
+            ::new (static_cast<void*>(elements + stackSize)) T(other.elements[stackSize]);
+        }
+    }
+    catch (const std::bad_alloc& e) {
+        clear();
+        throw std::runtime_error("Memory allocation failed during stack copy: " + std::string(e.what()));
+    }
+    catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, ContiguousStorage<N, Alloc>>::move_elements_from(Stack& other) {
+    reserve(other.stackSize);
+    for (; stackSize < other.stackSize; ++stackSize) {
+        ::new (static_cast<void*>(elements + stackSize)) T(std::move(other.elements[stackSize]));
+    }
+    other.clear();
+}
+
+// fwd_container interface implementation
+template<typename T, size_t N, typename Alloc>
+void Stack<T, ContiguousStorage<N, Alloc>>::push(const T& value) {
+    emplace(value);
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, ContiguousStorage<N, Alloc>>::push(T&& value) {
+    emplace(std::move(value));
+}
+
+template<typename T, size_t N, typename Alloc>
+template<typename... Args>
+T& Stack<T, ContiguousStorage<N, Alloc>>::emplace(Args&&... args) {
+    try {
+        if (stackSize == stackCapacity) return emplace_grow(std::forward<Args>(args)...);
+
+        T* element = ::new (static_cast<void*>(elements + stackSize)) T(std::forward<Args>(args)...);
+        ++stackSize;
+        return *element;
+    }
+    catch (std::bad_alloc& e) {
+        throw std::runtime_error("Failed to allocate memory for new stack element: " + std::string(e.what()));
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+template<typename... Args>
+T& Stack<T, ContiguousStorage<N, Alloc>>::emplace_grow(Args&&... args) {
+    size_t newCapacity = grown_capacity();
+    T* buffer = allocate_buffer(newCapacity);
+
+    T* element = nullptr;
+    try {
+        element = ::new (static_cast<void*>(buffer + stackSize)) T(std::forward<Args>(args)...);
+        transfer_elements(buffer);
+    }
+    catch (...) {
+        if (element) element->~T();
+        ElementTraits::deallocate(elementAlloc, buffer, newCapacity);
+        throw;
+    }
+
+    adopt_buffer(buffer, newCapacity);
+    ++stackSize;
+    return *element;
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, ContiguousStorage<N, Alloc>>::drop_top() noexcept {
+    --stackSize;
+    elements[stackSize].~T();
+}
+
+template<typename T, size_t N, typename Alloc>
+T Stack<T, ContiguousStorage<N, Alloc>>::pop() {
+    if (is_empty()) throw std::runtime_error("Cannot pop: Stack is empty");
+
+    T value = std::move(elements[stackSize - 1]);
+    drop_top();
+    return value;
+}
+
+template<typename T, size_t N, typename Alloc>
+bool Stack<T, ContiguousStorage<N, Alloc>>::try_pop(T& out) {
+    if (is_empty()) return false;
+
+    out = std::move(elements[stackSize - 1]);
+    drop_top();
+    return true;
+}
+
+template<typename T, size_t N, typename Alloc>
+std::optional<T> Stack<T, ContiguousStorage<N, Alloc>>::try_pop() {
+    if (is_empty()) return std::nullopt;
+
+    std::optional<T> value(std::move(elements[stackSize - 1]));
+    drop_top();
+    return value;
+}
+
+template<typename T, size_t N, typename Alloc>
+T* Stack<T, ContiguousStorage<N, Alloc>>::try_front() noexcept {
+    return is_empty() ? nullptr : elements + (stackSize - 1);
+}
+
+template<typename T, size_t N, typename Alloc>
+const T* Stack<T, ContiguousStorage<N, Alloc>>::try_front() const noexcept {
+    return is_empty() ? nullptr : elements + (stackSize - 1);
+}
+
+template<typename T, size_t N, typename Alloc>
+T& Stack<T, ContiguousStorage<N, Alloc>>::get_front() {
+    if (is_empty()) throw std::runtime_error("Cannot get top data: Stack is empty");
+    return elements[stackSize - 1];
+}
+
+template<typename T, size_t N, typename Alloc>
+const T& Stack<T, ContiguousStorage<N, Alloc>>::get_front() const {
+    if (is_empty()) throw std::runtime_error("Cannot get top data: Stack is empty");
+    return elements[stackSize - 1];
+}
+
+template<typename T, size_t N, typename Alloc>
+bool Stack<T, ContiguousStorage<N, Alloc>>::is_empty() const {
+    return stackSize == 0;
+}
+
+template<typename T, size_t N, typename Alloc>
+size_t Stack<T, ContiguousStorage<N, Alloc>>::size() const {
+    return stackSize;
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, ContiguousStorage<N, Alloc>>::begin() -> iterator {
+    return iterator(elements, stackSize);
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, ContiguousStorage<N, Alloc>>::end() -> iterator {
+    return iterator(elements, 0);
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, ContiguousStorage<N, Alloc>>::begin() const -> const_iterator {
+    return const_iterator(elements, stackSize);
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, ContiguousStorage<N, Alloc>>::end() const -> const_iterator {
+    return const_iterator(elements, 0);
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, ContiguousStorage<N, Alloc>>::cbegin() const -> const_iterator {
+    return begin();
+}
+
+template<typename T, size_t N, typename Alloc>
+auto Stack<T, ContiguousStorage<N, Alloc>>::cend() const -> const_iterator {
+    return end();
+}
+
+// Polymorphic iterators for access through fwd_container<T>
+template<typename T, size_t N, typename Alloc>
+typename fwd_container<T>::iterator Stack<T, ContiguousStorage<N, Alloc>>::make_begin() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(begin());
+}
+
+template<typename T, size_t N, typename Alloc>
+typename fwd_container<T>::iterator Stack<T, ContiguousStorage<N, Alloc>>::make_end() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(end());
+}
+
+template<typename T, size_t N, typename Alloc>
+typename fwd_container<T>::const_iterator Stack<T, ContiguousStorage<N, Alloc>>::make_begin() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(begin());
+}
+
+template<typename T, size_t N, typename Alloc>
+typename fwd_container<T>::const_iterator Stack<T, ContiguousStorage<N, Alloc>>::make_end() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(end());
+}
+
+// Additional methods
+template<typename T, size_t N, typename Alloc>
+size_t Stack<T, ContiguousStorage<N, Alloc>>::getSize() const {
+    return stackSize;
+}
+
+template<typename T, size_t N, typename Alloc>
+size_t Stack<T, ContiguousStorage<N, Alloc>>::capacity() const {
+    return stackCapacity;
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, ContiguousStorage<N, Alloc>>::reserve(size_t count) {
+    if (count <= stackCapacity) return;
+
+    T* buffer = allocate_buffer(count);
+    try {
+        transfer_elements(buffer);
+    }
+    catch (...) {
+        ElementTraits::deallocate(elementAlloc, buffer, count);
+        throw;
+    }
+    adopt_buffer(buffer, count);
+}
+
+template<typename T, size_t N, typename Alloc>
+bool Stack<T, ContiguousStorage<N, Alloc>>::is_inline() const {
+    // A heap buffer is only ever allocated to hold more than the inline slots
+    return stackCapacity <= N;
+}
+
+template<typename T, size_t N, typename Alloc>
+T& Stack<T, ContiguousStorage<N, Alloc>>::top() {
+    return get_front();
+}
+
+template<typename T, size_t N, typename Alloc>
+const T& Stack<T, ContiguousStorage<N, Alloc>>::top() const {
+    return get_front();
+}
+
+template<typename T, size_t N, typename Alloc>
+void Stack<T, ContiguousStorage<N, Alloc>>::clear() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (size_t i = 0; i < stackSize; ++i) elements[i].~T();
+    }
+    stackSize = 0;
+}
+
+template<typename T, size_t N, typename Alloc>
+bool Stack<T, ContiguousStorage<N, Alloc>>::empty() const {
+    return is_empty();
+}
+
+template<typename T, size_t N, typename Alloc>
+template<typename F>
+void Stack<T, ContiguousStorage<N, Alloc>>::for_each_span(F&& f) const {
+    if (stackSize != 0) f(static_cast<const T*>(elements), static_cast<const T*>(elements + stackSize));
+}
+
+template<typename T, size_t N, typename Alloc>
+template<typename F>
+void Stack<T, ContiguousStorage<N, Alloc>>::for_each_span(F&& f) {
+    if (stackSize != 0) f(elements, elements + stackSize);
+}
+
+template<typename T, size_t N, typename Alloc>
+Alloc Stack<T, ContiguousStorage<N, Alloc>>::get_allocator() const {
+    return Alloc(elementAlloc);
+}
+
+// Protected methods for stream operations
+template<typename T, size_t N, typename Alloc>
+std::ostream& Stack<T, ContiguousStorage<N, Alloc>>::print(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+
+        for (size_t i = stackSize; i-- > 0;) {
+            if (i + 1 != stackSize) {
+                os << " ";
+            }
+
+            if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+
+            os << elements[i];
+        }
+
+        if (!os.good()) throw std::runtime_error("Output stream failed after serialization");
+
+        return os;
+
+    } catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Stack serialization failed: ") + e.what());
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+std::istream& Stack<T, ContiguousStorage<N, Alloc>>::read(std::istream& is) {
+    try {
+        if (!is.good()) {
+            throw std::runtime_error("Input stream is in bad state");
+        }
+
+        // Everything read goes on top, so rolling back only pops it again
+        size_t oldSize = stackSize;
+
+        if constexpr (is_fast_parsable_v<T>) {
+            if (fast_parse_applies(is)) {
+                try {
+                    parse_text_elements<T>(is, [this](T value) { emplace(value); });
+                }
+                catch (...) {
+                    while (stackSize > oldSize) drop_top();
+                    throw;
+                }
+                return is;
+            }
+        }
+
+        try {
+            T value;
+            while (is >> value) {
+                try {
+                    this->push(value);
+                }
+                catch (const std::bad_alloc& e) {
+                    throw std::runtime_error("Memory allocation failed during input: " + std::string(e.what()));
+                }
+                catch (const std::exception& e) {
+                    throw std::runtime_error("Push operation failed during input: " + std::string(e.what()));
+                }
+
+                if (!is.good() && !is.eof()) {
+                    throw std::runtime_error("Input stream failed during data reading");
+                }
+            }
+
+            if (is.eof()) {
+                is.clear();
+            }
+
+            if (is.fail() && !is.eof()) {
+                throw std::runtime_error("Failed to parse input data");
+            }
+
+            return is;
+
+        }
+        catch (...) {
+            while (stackSize > oldSize) drop_top();
+            throw;
+        }
+
+    }
+    catch (const std::exception& e)
+    {
+        is.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Stack input failed: ") + e.what());
+    }
+}
+
+// Binary serialization
+template<typename T, size_t N, typename Alloc>
+std::ostream& Stack<T, ContiguousStorage<N, Alloc>>::save(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+        binary_write_header<T>(os, stackSize);
+        binary_write_elements<T>(os, begin(), end());
+        if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+        return os;
+    }
+    catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Stack save failed: ") + e.what());
+    }
+}
+
+template<typename T, size_t N, typename Alloc>
+std::istream& Stack<T, ContiguousStorage<N, Alloc>>::load(std::istream& is) {
+    try {
+        if (!is.good()) throw std::runtime_error("Input stream is in bad state");
+        binary_header header = binary_read_header<T>(is);
+
+        std::vector<T> staged;
+        binary_read_elements<T>(is, header.count, [&staged](T&& value) { staged.push_back(std::move(value)); });
+
+        size_t oldSize = stackSize;
+        try {
+            reserve(oldSize + staged.size());
+            for (size_t i = staged.size(); i > 0; --i) emplace(std::move(staged[i - 1]));
+        }
+        catch (...) {
+            while (stackSize > oldSize) drop_top();
+            throw;
+        }
+        return is;
+    }
+    catch (const std::exception& e) {
+        is.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Stack load failed: ") + e.what());
+    }
+}
@@ -0,0 +1,676 @@
+#pragma once
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <exception>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+#include "fwd_container.h"
+#include "stream_parse.h"
+
+/**
+ * @brief Double-ended queue stored in fixed-size blocks, like std::deque
+ * @tparam T Type of elements stored in the deque
+ * @tparam Alloc Allocator, rebound internally to T for the blocks and to T* for the block map
+ *
+ * Elements sit contiguously in blocks of block_capacity slots; a map of block pointers
+ * keeps the blocks in order with room to spare at both ends, so pushing and popping at
+ * either end is O(1) and iteration walks whole blocks. Used as a fwd_container<T> it
+ * behaves like Queue: push() appends at the back and pop()/get_front() work at the front.
+ * One emptied block is kept as a spare so a deque hovering around a block boundary does
+ * not allocate on every push. Pushing may rebuild the block map, which invalidates
+ * iterators but never moves elements, so references stay valid.
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+class Deque final : public fwd_container<T> {
+public:
+    static constexpr size_t block_capacity = sizeof(T) < 32 ? 512 / sizeof(T) : 16; ///< Elements per block
+
+    /**
+     * @brief Bidirectional iterator implementation for Deque (non-const version)
+     */
+    class deque_iterator {
+    private:
+        T** blocks;  ///< Block map of the deque
+        size_t slot; ///< Absolute slot index across the block map
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = T*;
+        using reference         = T&;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        deque_iterator() : blocks(nullptr), slot(0) {}
+
+        /**
+         * @brief Constructor
+         * @param map Block map of the deque
+         * @param s Absolute slot of the element to point at
+         */
+        deque_iterator(T** map, size_t s) : blocks(map), slot(s) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Reference to the current element
+         */
+        T& operator*() const {
+            return blocks[slot / block_capacity][slot % block_capacity];
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Pointer to the current element
+         */
+        T* operator->() const {
+            return &**this;
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        deque_iterator& operator++() {
+            ++slot;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        deque_iterator operator++(int) {
+            deque_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Advance by several elements, in constant time
+         * @param n Number of elements to skip (at most the distance to the end)
+         * @return Reference to this iterator
+         */
+        deque_iterator& skip(size_t n) {
+            slot += n;
+            return *this;
+        }
+
+        /**
+         * @brief Prefix decrement operator
+         * @return Reference to this iterator
+         */
+        deque_iterator& operator--() {
+            --slot;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix decrement operator
+         * @return Copy of iterator before decrement
+         */
+        deque_iterator operator--(int) {
+            deque_iterator temp = *this;
+            --(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same slot
+         */
+        friend bool operator==(const deque_iterator& lhs, const deque_iterator& rhs) {
+            return lhs.blocks == rhs.blocks && lhs.slot == rhs.slot;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different slots
+         */
+        friend bool operator!=(const deque_iterator& lhs, const deque_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the block map
+         * @return Block map the iterator walks
+         */
+        T** get_blocks() const { return blocks; }
+
+        /**
+         * @brief Get the current slot
+         * @return Absolute slot index
+         */
+        size_t get_slot() const { return slot; }
+    };
+
+    /**
+     * @brief Bidirectional const iterator implementation for Deque
+     */
+    class deque_const_iterator {
+    private:
+        T* const* blocks; ///< Block map of the deque
+        size_t slot;      ///< Absolute slot index across the block map
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = const T*;
+        using reference         = const T&;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        deque_const_iterator() : blocks(nullptr), slot(0) {}
+
+        /**
+         * @brief Constructor
+         * @param map Block map of the deque
+         * @param s Absolute slot of the element to point at
+         */
+        deque_const_iterator(T* const* map, size_t s) : blocks(map), slot(s) {}
+
+        /**
+         * @brief Constructor from non-const iterator
+         * @param other Iterator to convert from
+         */
+        deque_const_iterator(const deque_iterator& other) : blocks(other.get_blocks()), slot(other.get_slot()) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Const reference to the current element
+         */
+        const T& operator*() const {
+            return blocks[slot / block_capacity][slot % block_capacity];
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Const pointer to the current element
+         */
+        const T* operator->() const {
+            return &**this;
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        deque_const_iterator& operator++() {
+            ++slot;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        deque_const_iterator operator++(int) {
+            deque_const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Advance by several elements, in constant time
+         * @param n Number of elements to skip (at most the distance to the end)
+         * @return Reference to this iterator
+         */
+        deque_const_iterator& skip(size_t n) {
+            slot += n;
+            return *this;
+        }
+
+        /**
+         * @brief Prefix decrement operator
+         * @return Reference to this iterator
+         */
+        deque_const_iterator& operator--() {
+            --slot;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix decrement operator
+         * @return Copy of iterator before decrement
+         */
+        deque_const_iterator operator--(int) {
+            deque_const_iterator temp = *this;
+            --(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same slot
+         */
+        friend bool operator==(const deque_const_iterator& lhs, const deque_const_iterator& rhs) {
+            return lhs.blocks == rhs.blocks && lhs.slot == rhs.slot;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different slots
+         */
+        friend bool operator!=(const deque_const_iterator& lhs, const deque_const_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the block map
+         * @return Block map the iterator walks
+         */
+        T* const* get_blocks() const { return blocks; }
+
+        /**
+         * @brief Get the current slot
+         * @return Absolute slot index
+         */
+        size_t get_slot() const { return slot; }
+    };
+
+    using iterator = deque_iterator;
+    using const_iterator = deque_const_iterator;
+    using allocator_type = Alloc;
+
+    /**
+     * @brief Default constructor - creates an empty deque
+     */
+    Deque();
+
+    /**
+     * @brief Creates an empty deque that allocates its blocks through the given allocator
+     * @param alloc Allocator to use for the blocks and the block map
+     */
+    explicit Deque(const Alloc& alloc);
+
+    /**
+     * @brief Copy constructor - creates a deep copy of another deque
+     * @param other Deque to copy from
+     * @throws std::runtime_error if memory allocation fails during copying
+     */
+    Deque(const Deque& other);
+
+    /**
+     * @brief Move constructor - transfers ownership from another deque
+     * @param other Deque to move from (will be left in valid but empty state)
+     */
+    Deque(Deque&& other);
+
+    /**
+     * @brief Copy assignment operator
+     * @param other Deque to copy from
+     * @return Reference to this deque
+     * @throws std::runtime_error if memory allocation fails during copying
+     */
+    Deque& operator=(const Deque& other);
+
+    /**
+     * @brief Move assignment operator
+     * @param other Deque to move from
+     * @return Reference to this deque
+     */
+    Deque& operator=(Deque&& other);
+
+    /**
+     * @brief Virtual destructor
+     */
+    ~Deque();
+
+    // fwd_container interface implementation
+    /**
+     * @brief Add element to the back of the deque (copy semantics)
+     * @param value The value to add
+     */
+    void push(const T& value) override;
+
+    /**
+     * @brief Add element to the back of the deque (move semantics)
+     * @param value The value to add
+     */
+    void push(T&& value) override;
+
+    /**
+     * @brief Remove and return element from the front of the deque
+     * @return The removed element
+     * @throws std::runtime_error if deque is empty
+     */
+    T pop() override;
+
+    /**
+     * @brief Get reference to the front element
+     * @return Reference to the front element
+     * @throws std::runtime_error if deque is empty
+     */
+    T& get_front() override;
+
+    /**
+     * @brief Get const reference to the front element
+     * @return Const reference to the front element
+     * @throws std::runtime_error if deque is empty
+     */
+    const T& get_front() const override;
+
+    /**
+     * @brief Remove the front element if there is one; never throws on empty
+     * @param out Receives the removed element
+     * @return True if an element was removed, false if the deque was empty
+     */
+    bool try_pop(T& out) override;
+
+    /**
+     * @brief Remove the front element if there is one; never throws on empty
+     * @return The removed element, or std::nullopt if the deque was empty
+     */
+    std::optional<T> try_pop() override;
+
+    /**
+     * @brief Get pointer to the front element
+     * @return Pointer to the front element, or nullptr if the deque is empty
+     */
+    T* try_front() noexcept override;
+
+    /**
+     * @brief Get const pointer to the front element
+     * @return Const pointer to the front element, or nullptr if the deque is empty
+     */
+    const T* try_front() const noexcept override;
+
+    /**
+     * @brief Check if deque is empty
+     * @return True if deque is empty, false otherwise
+     */
+    bool is_empty() const override;
+
+    /**
+     * @brief Get the number of elements in deque
+     * @return Size of the deque
+     */
+    size_t size() const override;
+
+    /**
+     * @brief Append the elements stored by save() at the back of the deque
+     * @param is Input stream (should be opened in binary mode)
+     * @return Reference to the input stream
+     * @throws std::runtime_error if the data is malformed or memory allocation fails
+     *
+     * On failure the appended elements are popped again, leaving the deque as it was.
+     */
+    std::istream& load(std::istream& is) override;
+
+    /**
+     * @brief Assignment from any fwd_container
+     * @param other Container to copy from
+     * @return Reference to this deque
+     * @throws std::bad_cast if other is not a Deque of the same type
+     */
+    Deque& operator=(const fwd_container<T>& other) override;
+
+    /**
+     * @brief Add element to the front of the deque (copy semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     */
+    void push_front(const T& value);
+
+    /**
+     * @brief Add element to the front of the deque (move semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     */
+    void push_front(T&& value);
+
+    /**
+     * @brief Add element to the back of the deque (copy semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     */
+    void push_back(const T& value);
+
+    /**
+     * @brief Add element to the back of the deque (move semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     */
+    void push_back(T&& value);
+
+    /**
+     * @brief Construct an element in place at the front of the deque
+     * @param args Arguments forwarded to the T constructor
+     * @return Reference to the new element
+     * @throws std::runtime_error if memory allocation fails
+     */
+    template<typename... Args>
+    T& emplace_front(Args&&... args);
+
+    /**
+     * @brief Construct an element in place at the back of the deque
+     * @param args Arguments forwarded to the T constructor
+     * @return Reference to the new element
+     * @throws std::runtime_error if memory allocation fails
+     */
+    template<typename... Args>
+    T& emplace_back(Args&&... args);
+
+    /**
+     * @brief Remove and return element from the front of the deque
+     * @return The removed element
+     * @throws std::runtime_error if deque is empty
+     */
+    T pop_front();
+
+    /**
+     * @brief Remove and return element from the back of the deque
+     * @return The removed element
+     * @throws std::runtime_error if deque is empty
+     */
+    T pop_back();
+
+    /**
+     * @brief Returns a reference to the front element (non-const version)
+     * @return Reference to the front element
+     * @throws std::runtime_error if deque is empty
+     */
+    T& front();
+
+    /**
+     * @brief Returns a reference to the front element (const version)
+     * @return Const reference to the front element
+     * @throws std::runtime_error if deque is empty
+     */
+    const T& front() const;
+
+    /**
+     * @brief Returns a reference to the back element (non-const version)
+     * @return Reference to the back element
+     * @throws std::runtime_error if deque is empty
+     */
+    T& back();
+
+    /**
+     * @brief Returns a reference to the back element (const version)
+     * @return Const reference to the back element
+     * @throws std::runtime_error if deque is empty
+     */
+    const T& back() const;
+
+    /**
+     * @brief Get iterator to the beginning of the deque
+     * @return Iterator to the front element
+     */
+    iterator begin();
+
+    /**
+     * @brief Get iterator to the end of the deque
+     * @return Iterator to the position after the back element
+     */
+    iterator end();
+
+    /**
+     * @brief Get const iterator to the beginning of the deque
+     * @return Const iterator to the front element
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Get const iterator to the end of the deque
+     * @return Const iterator to the position after the back element
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief Get const iterator to the beginning of the deque
+     * @return Const iterator to the front element
+     */
+    const_iterator cbegin() const;
+
+    /**
+     * @brief Get const iterator to the end of the deque
+     * @return Const iterator to the position after the back element
+     */
+    const_iterator cend() const;
+
+    /**
+     * @brief Removes all elements from the deque
+     */
+    void clear();
+
+    /**
+     * @brief Checks if the deque is empty
+     * @return true if deque is empty, false otherwise
+     */
+    bool empty() const;
+
+    static constexpr bool reversed_spans = false; ///< Addresses inside a for_each_span() run descend in iteration order
+
+    /**
+     * @brief Visit the elements as runs of contiguous memory
+     * @param f Callable taking (const T* first, const T* last) and returning false to stop early
+     *
+     * One run per block, front block first; inside a run the addresses ascend in iteration
+     * order.
+     */
+    template<typename F>
+    void for_each_span(F&& f) const;
+
+    /**
+     * @brief Visit the elements as runs of contiguous, modifiable memory
+     * @param f Callable taking (T* first, T* last) and returning false to stop early
+     */
+    template<typename F>
+    void for_each_span(F&& f);
+
+    /**
+     * @brief Returns a copy of the allocator associated with the deque
+     * @return Allocator rebound back to the element type
+     */
+    Alloc get_allocator() const;
+
+protected:
+    /**
+     * @brief Create a polymorphic iterator to the beginning of the deque
+     * @return Type-erased iterator to the first element
+     */
+    typename fwd_container<T>::iterator make_begin() override;
+
+    /**
+     * @brief Create a polymorphic iterator to the end of the deque
+     * @return Type-erased iterator to the position after the last element
+     */
+    typename fwd_container<T>::iterator make_end() override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the beginning of the deque
+     * @return Type-erased const iterator to the first element
+     */
+    typename fwd_container<T>::const_iterator make_begin() const override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the end of the deque
+     * @return Type-erased const iterator to the position after the last element
+     */
+    typename fwd_container<T>::const_iterator make_end() const override;
+
+    /**
+     * @brief Print deque contents to output stream, front first
+     * @param os Output stream
+     * @return Reference to the output stream
+     */
+    virtual std::ostream& print(std::ostream& os) const override;
+
+    /**
+     * @brief Append the elements read from the input stream at the back of the deque
+     * @param is Input stream
+     * @return Reference to the input stream
+     */
+    virtual std::istream& read(std::istream& is) override;
+
+private:
+    using ElementAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+    using ElementTraits = std::allocator_traits<ElementAllocator>;
+    using MapAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<T*>;
+    using MapTraits = std::allocator_traits<MapAllocator>;
+
+    /**
+     * @brief Returns the slot at the given absolute index
+     * @param index Absolute slot index (its block must be allocated)
+     * @return Pointer to the slot storage
+     */
+    T* slot(size_t index) const noexcept;
+
+    /**
+     * @brief Makes sure the block holding the given slot exists, taking the spare or allocating one
+     * @param index Absolute slot index
+     * @return True if the block was installed by this call
+     */
+    bool acquire_block(size_t index);
+
+    /**
+     * @brief Takes the block at the given map position out of the map, keeping it as the spare if there is none
+     * @param block Map position of an allocated block that holds no element
+     */
+    void release_block(size_t block) noexcept;
+
+    /**
+     * @brief Rebuilds the block map so that free block positions exist at both ends
+     * @throws std::runtime_error if memory allocation fails; the deque is unchanged
+     */
+    void recenter();
+
+    /**
+     * @brief Destroys the front element and retires its block once drained (deque must not be empty)
+     */
+    void drop_front() noexcept;
+
+    /**
+     * @brief Destroys the back element and retires its block once drained (deque must not be empty)
+     */
+    void drop_back() noexcept;
+
+    /**
+     * @brief Returns every block and the map to the allocator (deque must be empty)
+     */
+    void release_storage() noexcept;
+
+    T** blockMap;                  ///< Block pointers in order; unused positions are nullptr
+    size_t mapSize;                ///< Number of positions in the block map
+    size_t startSlot;              ///< Absolute slot index of the front element
+    size_t dequeSize;              ///< Number of elements in the deque
+    T* spareBlock;                 ///< Emptied block kept for reuse (may be nullptr)
+    ElementAllocator elementAlloc; ///< Allocator providing blocks and (rebound) the block map
+};
+
+#include "deque.ipp"
@@ -0,0 +1,602 @@
+#include "deque.h"
+
+#include <algorithm>
+
+// Deque constructors and operators
+template<typename T, typename Alloc>
+Deque<T, Alloc>::Deque()
+    : blockMap(nullptr), mapSize(0), startSlot(0), dequeSize(0), spareBlock(nullptr), elementAlloc() {}
+
+template<typename T, typename Alloc>
+Deque<T, Alloc>::Deque(const Alloc& alloc)
+    : blockMap(nullptr), mapSize(0), startSlot(0), dequeSize(0), spareBlock(nullptr), elementAlloc(alloc) {}
+
+template<typename T, typename Alloc>
+Deque<T, Alloc>::Deque(const Deque& other)
+    : blockMap(nullptr), mapSize(0), startSlot(0), dequeSize(0), spareBlock(nullptr),
+      elementAlloc(ElementTraits::select_on_container_copy_construction(other.elementAlloc)) {
+    try {
+        for (const T& value : other) {
+            push_back(value);
+        }
+    }
+    catch (...) {
+        clear();
+        release_storage();
+        throw;
+    }
+}
+
+template<typename T, typename Alloc>
+Deque<T, Alloc>::Deque(Deque&& other)
+    : blockMap(other.blockMap), mapSize(other.mapSize), startSlot(other.startSlot), dequeSize(other.dequeSize),
+      spareBlock(other.spareBlock), elementAlloc(std::move(other.elementAlloc)) {
+    other.blockMap = nullptr;
+    other.mapSize = 0;
+    other.startSlot = 0;
+    other.dequeSize = 0;
+    other.spareBlock = nullptr;
+}
+
+template<typename T, typename Alloc>
+auto Deque<T, Alloc>::operator=(const Deque& other) -> Deque& {
+    if (this != &other) {
+        clear();
+        if constexpr (ElementTraits::propagate_on_container_copy_assignment::value) {
+            // Blocks and map came from the old allocator and must go back to it
+            if (elementAlloc != other.elementAlloc) release_storage();
+            elementAlloc = other.elementAlloc;
+        }
+
+        for (const T& value : other) {
+            push_back(value);
+        }
+    }
+    return *this;
+}
+
+template<typename T, typename Alloc>
+auto Deque<T, Alloc>::operator=(Deque&& other) -> Deque& {
+    if (this != &other) {
+        clear();
+        release_storage();
+        if constexpr (!ElementTraits::propagate_on_container_move_assignment::value) {
+            // Blocks owned by a foreign allocator cannot be adopted; copy them and release the source
+            if (elementAlloc != other.elementAlloc) {
+                *this = static_cast<const Deque&>(other);
+                other.clear();
+                return *this;
+            }
+        }
+        else {
+            elementAlloc = std::move(other.elementAlloc);
+        }
+        blockMap = other.blockMap;
+        mapSize = other.mapSize;
+        startSlot = other.startSlot;
+        dequeSize = other.dequeSize;
+        spareBlock = other.spareBlock;
+
+        other.blockMap = nullptr;
+        other.mapSize = 0;
+        other.startSlot = 0;
+        other.dequeSize = 0;
+        other.spareBlock = nullptr;
+    }
+    return *this;
+}
+
+template<typename T, typename Alloc>
+auto Deque<T, Alloc>::operator=(const fwd_container<T>& other) -> Deque& {
+    const Deque* derived = dynamic_cast<const Deque*>(&other);
+    if (!derived) {
+        throw std::bad_cast();
+    }
+    return *this = *derived; // Use same-type assignment operator
+}
+
+template<typename T, typename Alloc>
+Deque<T, Alloc>::~Deque() {
+    clear();
+    release_storage();
+}
+
+// Block management
+template<typename T, typename Alloc>
+T* Deque<T, Alloc>::slot(size_t index) const noexcept {
+    return blockMap[index / block_capacity] + index % block_capacity;
+}
+
+template<typename T, typename Alloc>
+bool Deque<T, Alloc>::acquire_block(size_t index) {
+    T*& block = blockMap[index / block_capacity];
+    if (block != nullptr) return false;
+
+    if (spareBlock != nullptr) {
+        block = spareBlock;
+        spareBlock = nullptr;
+    } else {
+        block = ElementTraits::allocate(elementAlloc, block_capacity);
+    }
+    return true;
+}
+
+template<typename T, typename Alloc>
+void Deque<T, Alloc>::release_block(size_t block) noexcept {
+    T* released = blockMap[block];
+    blockMap[block] = nullptr;
+    if (spareBlock == nullptr) {
+        spareBlock = released;
+    } else {
+        ElementTraits::deallocate(elementAlloc, released, block_capacity);
+    }
+}
+
+template<typename T, typename Alloc>
+void Deque<T, Alloc>::recenter() {
+    const size_t firstBlock = startSlot / block_capacity;
+    const size_t usedBlocks = dequeSize == 0 ? 0 : (startSlot + dequeSize - 1) / block_capacity - firstBlock + 1;
+    const size_t needed = usedBlocks + 1;
+
+    if (mapSize >= 2 * needed) {
+        // Plenty of room, it is just all on one side (a deque used as a queue drifts
+        // towards the back): slide the block pointers to the middle of the map
+        const size_t newFirst = (mapSize - usedBlocks) / 2;
+        if (newFirst < firstBlock) {
+            std::move(blockMap + firstBlock, blockMap + firstBlock + usedBlocks, blockMap + newFirst);
+        } else {
+            std::move_backward(blockMap + firstBlock, blockMap + firstBlock + usedBlocks, blockMap + newFirst + usedBlocks);
+        }
+        std::fill(blockMap, blockMap + newFirst, static_cast<T*>(nullptr));
+        std::fill(blockMap + newFirst + usedBlocks, blockMap + mapSize, static_cast<T*>(nullptr));
+        startSlot = newFirst * block_capacity + startSlot % block_capacity;
+        return;
+    }
+
+    MapAllocator mapAlloc(elementAlloc);
+    const size_t newSize = std::max<size_t>(8, 2 * needed);
+    T** newMap = MapTraits::allocate(mapAlloc, newSize);
+    const size_t newFirst = (newSize - usedBlocks) / 2;
+
+    std::fill(newMap, newMap + newSize, static_cast<T*>(nullptr));
+    if (blockMap != nullptr) {
+        std::copy(blockMap + firstBlock, blockMap + firstBlock + usedBlocks, newMap + newFirst);
+        MapTraits::deallocate(mapAlloc, blockMap, mapSize);
+    }
+
+    blockMap = newMap;
+    mapSize = newSize;
+    startSlot = newFirst * block_capacity + startSlot % block_capacity;
+}
+
+template<typename T, typename Alloc>
+void Deque<T, Alloc>::drop_front() noexcept {
+    const size_t block = startSlot / block_capacity;
+    slot(startSlot)->~T();
+    ++startSlot;
+    --dequeSize;
+
+    if (dequeSize == 0) {
+        release_block(block);
+        startSlot = (mapSize / 2) * block_capacity;
+    } else if (startSlot % block_capacity == 0) {
+        release_block(block);
+    }
+}
+
+template<typename T, typename Alloc>
+void Deque<T, Alloc>::drop_back() noexcept {
+    const size_t last = startSlot + dequeSize - 1;
+    slot(last)->~T();
+    --dequeSize;
+
+    if (dequeSize == 0) {
+        release_block(last / block_capacity);
+        startSlot = (mapSize / 2) * block_capacity;
+    } else if (last % block_capacity == 0) {
+        release_block(last / block_capacity);
+    }
+}
+
+template<typename T, typename Alloc>
+void Deque<T, Alloc>::release_storage() noexcept {
+    if (spareBlock != nullptr) {
+        ElementTraits::deallocate(elementAlloc, spareBlock, block_capacity);
+        spareBlock = nullptr;
+    }
+    if (blockMap != nullptr) {
+        MapAllocator mapAlloc(elementAlloc);
+        MapTraits::deallocate(mapAlloc, blockMap, mapSize);
+        blockMap = nullptr;
+    }
+    mapSize = 0;
+    startSlot = 0;
+}
+
+// fwd_container interface implementation
+template<typename T, typename Alloc>
+void Deque<T, Alloc>::push(const T& value) {
+    emplace_back(value);
+}
+
+template<typename T, typename Alloc>
+void Deque<T, Alloc>::push(T&& value) {
+    emplace_back(std::move(value));
+}
+
+template<typename T, typename Alloc>
+T Deque<T, Alloc>::pop() {
+    return pop_front();
+}
+
+template<typename T, typename Alloc>
+bool Deque<T, Alloc>::try_pop(T& out) {
+    if (is_empty()) return false;
+
+    out = std::move(*slot(startSlot));
+    drop_front();
+    return true;
+}
+
+template<typename T, typename Alloc>
+std::optional<T> Deque<T, Alloc>::try_pop() {
+    if (is_empty()) return std::nullopt;
+
+    std::optional<T> value(std::move(*slot(startSlot)));
+    drop_front();
+    return value;
+}
+
+template<typename T, typename Alloc>
+T* Deque<T, Alloc>::try_front() noexcept {
+    return is_empty() ? nullptr : slot(startSlot);
+}
+
+template<typename T, typename Alloc>
+const T* Deque<T, Alloc>::try_front() const noexcept {
+    return is_empty() ? nullptr : slot(startSlot);
+}
+
+template<typename T, typename Alloc>
+T& Deque<T, Alloc>::get_front() {
+    if (is_empty()) throw std::runtime_error("Cannot get front data: Deque is empty");
+    return *slot(startSlot);
+}
+
+template<typename T, typename Alloc>
+const T& Deque<T, Alloc>::get_front() const {
+    if (is_empty()) throw std::runtime_error("Cannot get front data: Deque is empty");
+    return *slot(startSlot);
+}
+
+template<typename T, typename Alloc>
+bool Deque<T, Alloc>::is_empty() const {
+    return dequeSize == 0;
+}
+
+template<typename T, typename Alloc>
+size_t Deque<T, Alloc>::size() const {
+    return dequeSize;
+}
+
+// Operations at both ends
+template<typename T, typename Alloc>
+void Deque<T, Alloc>::push_front(const T& value) {
+    emplace_front(value);
+}
+
+template<typename T, typename Alloc>
+void Deque<T, Alloc>::push_front(T&& value) {
+    emplace_front(std::move(value));
+}
+
+template<typename T, typename Alloc>
+void Deque<T, Alloc>::push_back(const T& value) {
+    emplace_back(value);
+}
+
+template<typename T, typename Alloc>
+void Deque<T, Alloc>::push_back(T&& value) {
+    emplace_back(std::move(value));
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+T& Deque<T, Alloc>::emplace_front(Args&&... args) {
+    bool acquired = false;
+    try {
+        if (startSlot == 0) recenter();
+
+        const size_t index = startSlot - 1;
+        acquired = acquire_block(index);
+        T* element = ::new (static_cast<void*>(slot(index))) T(std::forward<Args>(args)...);
+        startSlot = index;
+        ++dequeSize;
+        return *element;
+    }
+    catch (std::bad_alloc& e) {
+        if (acquired) release_block((startSlot - 1) / block_capacity);
+        throw std::runtime_error("Failed to allocate memory for new deque element: " + std::string(e.what()));
+    }
+    catch (...) {
+        if (acquired) release_block((startSlot - 1) / block_capacity);
+        throw;
+    }
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+T& Deque<T, Alloc>::emplace_back(Args&&... args) {
+    bool acquired = false;
+    try {
+        if (startSlot + dequeSize == mapSize * block_capacity) recenter();
+
+        const size_t index = startSlot + dequeSize;
+        acquired = acquire_block(index);
+        T* element = ::new (static_cast<void*>(slot(index))) T(std::forward<Args>(args)...);
+        ++dequeSize;
+        return *element;
+    }
+    catch (std::bad_alloc& e) {
+        if (acquired) release_block((startSlot + dequeSize) / block_capacity);
+        throw std::runtime_error("Failed to allocate memory for new deque element: " + std::string(e.what()));
+    }
+    catch (...) {
+        if (acquired) release_block((startSlot + dequeSize) / block_capacity);
+        throw;
+    }
+}
+
+template<typename T, typename Alloc>
+T Deque<T, Alloc>::pop_front() {
+    if (is_empty()) throw std::runtime_error("Cannot pop: Deque is empty");
+
+    T value = std::move(*slot(startSlot));
+    drop_front();
+    return value;
+}
+
+template<typename T, typename Alloc>
+T Deque<T, Alloc>::pop_back() {
+    if (is_empty()) throw std::runtime_error("Cannot pop back: Deque is empty");
+
+    T value = std::move(*slot(startSlot + dequeSize - 1));
+    drop_back();
+    return value;
+}
+
+template<typename T, typename Alloc>
+T& Deque<T, Alloc>::front() {
+    return get_front();
+}
+
+template<typename T, typename Alloc>
+const T& Deque<T, Alloc>::front() const {
+    return get_front();
+}
+
+template<typename T, typename Alloc>
+T& Deque<T, Alloc>::back() {
+    if (is_empty()) throw std::runtime_error("Cannot get back data: Deque is empty");
+    return *slot(startSlot + dequeSize - 1);
+}
+
+template<typename T, typename Alloc>
+const T& Deque<T, Alloc>::back() const {
+    if (is_empty()) throw std::runtime_error("Cannot get back data: Deque is empty");
+    return *slot(startSlot + dequeSize - 1);
+}
+
+// Iterators
+template<typename T, typename Alloc>
+auto Deque<T, Alloc>::begin() -> iterator {
+    return iterator(blockMap, startSlot);
+}
+
+template<typename T, typename Alloc>
+auto Deque<T, Alloc>::end() -> iterator {
+    return iterator(blockMap, startSlot + dequeSize);
+}
+
+template<typename T, typename Alloc>
+auto Deque<T, Alloc>::begin() const -> const_iterator {
+    return const_iterator(blockMap, startSlot);
+}
+
+template<typename T, typename Alloc>
+auto Deque<T, Alloc>::end() const -> const_iterator {
+    return const_iterator(blockMap, startSlot + dequeSize);
+}
+
+template<typename T, typename Alloc>
+auto Deque<T, Alloc>::cbegin() const -> const_iterator {
+    return begin();
+}
+
+template<typename T, typename Alloc>
+auto Deque<T, Alloc>::cend() const -> const_iterator {
+    return end();
+}
+
+// Polymorphic iterators for access through fwd_container<T>
+template<typename T, typename Alloc>
+typename fwd_container<T>::iterator Deque<T, Alloc>::make_begin() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(begin());
+}
+
+template<typename T, typename Alloc>
+typename fwd_container<T>::iterator Deque<T, Alloc>::make_end() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(end());
+}
+
+template<typename T, typename Alloc>
+typename fwd_container<T>::const_iterator Deque<T, Alloc>::make_begin() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(begin());
+}
+
+template<typename T, typename Alloc>
+typename fwd_container<T>::const_iterator Deque<T, Alloc>::make_end() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(end());
+}
+
+// Additional methods
+template<typename T, typename Alloc>
+void Deque<T, Alloc>::clear() {
+    if (dequeSize == 0) return;
+
+    const size_t firstBlock = startSlot / block_capacity;
+    const size_t lastBlock = (startSlot + dequeSize - 1) / block_capacity;
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (size_t i = startSlot; i < startSlot + dequeSize; ++i) {
+            slot(i)->~T();
+        }
+    }
+    for (size_t block = firstBlock; block <= lastBlock; ++block) {
+        release_block(block);
+    }
+
+    dequeSize = 0;
+    startSlot = (mapSize / 2) * block_capacity;
+}
+
+template<typename T, typename Alloc>
+bool Deque<T, Alloc>::empty() const {
+    return is_empty();
+}
+
+template<typename T, typename Alloc>
+template<typename F>
+void Deque<T, Alloc>::for_each_span(F&& f) const {
+    const size_t last = startSlot + dequeSize;
+    for (size_t index = startSlot; index < last;) {
+        const size_t blockEnd = std::min(last, (index / block_capacity + 1) * block_capacity);
+        const T* first = slot(index);
+        if (!f(first, first + (blockEnd - index))) return;
+        index = blockEnd;
+    }
+}
+
+template<typename T, typename Alloc>
+template<typename F>
+void Deque<T, Alloc>::for_each_span(F&& f) {
+    const size_t last = startSlot + dequeSize;
+    for (size_t index = startSlot; index < last;) {
+        const size_t blockEnd = std::min(last, (index / block_capacity + 1) * block_capacity);
+        T* first = slot(index);
+        if (!f(first, first + (blockEnd - index))) return;
+        index = blockEnd;
+    }
+}
+
+template<typename T, typename Alloc>
+Alloc Deque<T, Alloc>::get_allocator() const {
+    return Alloc(elementAlloc);
+}
+
+// Protected methods for stream operations
+template<typename T, typename Alloc>
+std::ostream& Deque<T, Alloc>::print(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+
+        bool first = true;
+        for (const T& value : *this) {
+            if (!first) {
+                os << " ";
+            }
+
+            if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+
+            os << value;
+            first = false;
+        }
+
+        if (!os.good()) throw std::runtime_error("Output stream failed after serialization");
+
+        return os;
+
+    } catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Deque serialization failed: ") + e.what());
+    }
+}
+
+template<typename T, typename Alloc>
+std::istream& Deque<T, Alloc>::read(std::istream& is) {
+    try {
+        if (!is.good()) {
+            throw std::runtime_error("Input stream is in bad state");
+        }
+
+        // Everything read is appended at the back, so rolling back pops the back again
+        const size_t oldSize = dequeSize;
+
+        try {
+            bool parsed = false;
+            if constexpr (is_fast_parsable_v<T>) {
+                if (fast_parse_applies(is)) {
+                    parse_text_elements<T>(is, [this](T value) { emplace_back(value); });
+                    parsed = true;
+                }
+            }
+            if (!parsed) {
+                T value;
+                while (is >> value) {
+                    try {
+                        push_back(value);
+                    }
+                    catch (const std::exception& e) {
+                        throw std::runtime_error("Push operation failed during input: " + std::string(e.what()));
+                    }
+
+                    if (!is.good() && !is.eof()) {
+                        throw std::runtime_error("Input stream failed during data reading");
+                    }
+                }
+
+                if (is.eof()) {
+                    is.clear();
+                }
+
+                if (is.fail() && !is.eof()) {
+                    throw std::runtime_error("Failed to parse input data");
+                }
+            }
+        }
+        catch (...) {
+            while (dequeSize > oldSize) drop_back();
+            throw;
+        }
+
+        return is;
+
+    }
+    catch (const std::exception& e)
+    {
+        is.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Deque input failed: ") + e.what());
+    }
+}
+
+// Binary serialization
+template<typename T, typename Alloc>
+std::istream& Deque<T, Alloc>::load(std::istream& is) {
+    try {
+        if (!is.good()) throw std::runtime_error("Input stream is in bad state");
+        binary_header header = binary_read_header<T>(is);
+
+        const size_t oldSize = dequeSize;
+        try {
+            binary_read_elements<T>(is, header.count, [this](T&& value) { emplace_back(std::move(value)); });
+        }
+        catch (...) {
+            while (dequeSize > oldSize) drop_back();
+            throw;
+        }
+        return is;
+    }
+    catch (const std::exception& e) {
+        is.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Deque load failed: ") + e.what());
+    }
+}
@@ -0,0 +1,288 @@
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include "fwd_container.h"
+
+/**
+ * @brief Element type of a forward container, as seen through get_front()
+ * @tparam C Container type
+ */
+template<typename C>
+using forward_container_value_t = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<C&>().get_front())>>;
+
+/**
+ * @brief Detects containers that link the caller's objects instead of storing values
+ * @tparam C Candidate container type
+ *
+ * Set by a static constexpr bool is_intrusive member (IntrusiveStack, IntrusiveQueue).
+ * Such containers cannot push a value, so they are not forward containers.
+ */
+template<typename C, typename = void>
+struct is_intrusive_container : std::false_type {};
+
+template<typename C>
+struct is_intrusive_container<C, std::enable_if_t<C::is_intrusive>> : std::true_type {};
+
+/**
+ * @brief Detects the operations generic code may use on a forward container
+ * @tparam C Candidate container type
+ *
+ * Satisfied by every owning container of this library (and by any other type with the
+ * same members): push(const T&), pop(), get_front(), is_empty(), size() and begin()/end()
+ * returning C::iterator. Generic code templated on such a C calls the members of the
+ * concrete class directly; the containers are final, so none of those calls goes
+ * through the vtable of fwd_container<T> and all of them can be inlined.
+ */
+template<typename C, typename = void>
+struct is_forward_container : std::false_type {};
+
+template<typename C>
+struct is_forward_container<C, std::void_t<
+    typename C::iterator,
+    typename C::const_iterator,
+    forward_container_value_t<C>,
+    decltype(std::declval<C&>().push(std::declval<const forward_container_value_t<C>&>())),
+    decltype(std::declval<C&>().pop()),
+    decltype(std::declval<const C&>().is_empty()),
+    decltype(std::declval<const C&>().size()),
+    decltype(std::declval<C&>().begin() != std::declval<C&>().end())>> : std::bool_constant<!is_intrusive_container<C>::value> {};
+
+/**
+ * @brief True if C provides the forward container operations (see is_forward_container)
+ * @tparam C Candidate container type
+ */
+template<typename C>
+inline constexpr bool is_forward_container_v = is_forward_container<C>::value;
+
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+/**
+ * @brief Concept form of is_forward_container_v for code built as C++20
+ * @tparam C Candidate container type
+ */
+template<typename C>
+concept ForwardContainer = is_forward_container_v<C>;
+#endif
+
+/**
+ * @brief Pops every element of one container and pushes it onto another
+ * @tparam Source Forward container to drain
+ * @tparam Sink Forward container receiving the elements
+ * @param from Container to take the elements from (left empty)
+ * @param to Container receiving the elements in pop() order
+ * @return Number of elements moved
+ *
+ * Both containers are used through their concrete types, so the loop compiles down to
+ * the inlined pop and push of the two classes.
+ */
+template<typename Source, typename Sink>
+std::enable_if_t<is_forward_container_v<Source> && is_forward_container_v<Sink>, size_t>
+forward_all(Source& from, Sink& to) {
+    size_t moved = 0;
+    while (!from.is_empty()) {
+        to.push(from.pop());
+        ++moved;
+    }
+    return moved;
+}
+
+/**
+ * @brief Type-erased view of a forward container through the virtual fwd_container interface
+ * @tparam C Wrapped container type (must satisfy is_forward_container_v)
+ *
+ * The opt-in counterpart of templating on the concrete type: code that needs one
+ * signature for many container types takes a fwd_container<T>&, and containers that do
+ * not derive from fwd_container<T> are passed as an adapter. The adapter does not own
+ * the container, which must outlive it.
+ */
+template<typename C>
+class fwd_container_adapter final : public fwd_container<forward_container_value_t<C>> {
+    static_assert(is_forward_container_v<C>, "fwd_container_adapter needs a forward container");
+
+public:
+    using value_type = forward_container_value_t<C>;
+    using base_type = fwd_container<value_type>;
+
+    /**
+     * @brief Constructor
+     * @param wrapped Container to expose (must outlive the adapter)
+     */
+    explicit fwd_container_adapter(C& wrapped) : container(wrapped) {}
+
+    /**
+     * @brief Get the wrapped container
+     * @return Reference to the wrapped container
+     */
+    C& get() const noexcept { return container; }
+
+    /**
+     * @brief Add element to the wrapped container (copy semantics)
+     * @param value The value to add
+     */
+    void push(const value_type& value) override { container.push(value); }
+
+    /**
+     * @brief Add element to the wrapped container (move semantics)
+     * @param value The value to add
+     */
+    void push(value_type&& value) override { container.push(std::move(value)); }
+
+    /**
+     * @brief Remove and return the next element of the wrapped container
+     * @return The removed element
+     * @throws Whatever the wrapped container throws when empty
+     */
+    value_type pop() override { return container.pop(); }
+
+    /**
+     * @brief Get reference to the next element of the wrapped container
+     * @return Reference to the element pop() would return
+     */
+    value_type& get_front() override { return container.get_front(); }
+
+    /**
+     * @brief Get const reference to the next element of the wrapped container
+     * @return Const reference to the element pop() would return
+     */
+    const value_type& get_front() const override { return static_cast<const C&>(container).get_front(); }
+
+    /**
+     * @brief Check if the wrapped container is empty
+     * @return True if it holds no elements
+     */
+    bool is_empty() const override { return container.is_empty(); }
+
+    /**
+     * @brief Get the number of elements in the wrapped container
+     * @return Size of the wrapped container
+     */
+    size_t size() const override { return container.size(); }
+
+    /**
+     * @brief Assign the contents of another adapter of the same type
+     * @param other Container to copy from
+     * @return Reference to this adapter
+     * @throws std::bad_cast if other is not an adapter of the same type or C cannot be copy-assigned
+     */
+    fwd_container_adapter& operator=(const base_type& other) override {
+        const fwd_container_adapter* derived = dynamic_cast<const fwd_container_adapter*>(&other);
+        if constexpr (std::is_copy_assignable_v<C>) {
+            if (derived) {
+                if (derived != this) container = derived->container;
+                return *this;
+            }
+        }
+        throw std::bad_cast();
+    }
+
+protected:
+    /**
+     * @brief Create a polymorphic iterator to the beginning of the wrapped container
+     * @return Type-erased iterator to the first element
+     */
+    typename base_type::iterator make_begin() override {
+        return base_type::template wrap_iterator<typename C::iterator, typename C::const_iterator>(container.begin());
+    }
+
+    /**
+     * @brief Create a polymorphic iterator to the end of the wrapped container
+     * @return Type-erased iterator to the position after the last element
+     */
+    typename base_type::iterator make_end() override {
+        return base_type::template wrap_iterator<typename C::iterator, typename C::const_iterator>(container.end());
+    }
+
+    /**
+     * @brief Create a polymorphic const iterator to the beginning of the wrapped container
+     * @return Type-erased const iterator to the first element
+     */
+    typename base_type::const_iterator make_begin() const override {
+        return base_type::template wrap_const_iterator<typename C::const_iterator, typename C::iterator>(
+            static_cast<const C&>(container).begin());
+    }
+
+    /**
+     * @brief Create a polymorphic const iterator to the end of the wrapped container
+     * @return Type-erased const iterator to the position after the last element
+     */
+    typename base_type::const_iterator make_end() const override {
+        return base_type::template wrap_const_iterator<typename C::const_iterator, typename C::iterator>(
+            static_cast<const C&>(container).end());
+    }
+
+    /**
+     * @brief Print the wrapped container's elements in iteration order, separated by spaces
+     * @param os Output stream
+     * @return Reference to the output stream
+     */
+    std::ostream& print(std::ostream& os) const override {
+        try {
+            if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+
+            bool first = true;
+            for (const value_type& value : static_cast<const C&>(container)) {
+                if (!first) {
+                    os << " ";
+                }
+
+                if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+
+                os << value;
+                first = false;
+            }
+
+            if (!os.good()) throw std::runtime_error("Output stream failed after serialization");
+
+            return os;
+
+        } catch (const std::exception& e) {
+            os.setstate(std::ios::failbit);
+            throw std::runtime_error(std::string("Container serialization failed: ") + e.what());
+        }
+    }
+
+    /**
+     * @brief Push whitespace-separated elements read from the stream onto the wrapped container
+     * @param is Input stream
+     * @return Reference to the input stream
+     *
+     * The wrapped container offers no way to undo pushes, so on failure the elements
+     * read so far stay in it.
+     */
+    std::istream& read(std::istream& is) override {
+        try {
+            if (!is.good()) {
+                throw std::runtime_error("Input stream is in bad state");
+            }
+
+            value_type value;
+            while (is >> value) {
+                container.push(value);
+            }
+
+            if (is.eof()) {
+                is.clear();
+            }
+
+            if (is.fail() && !is.eof()) {
+                throw std::runtime_error("Failed to parse input data");
+            }
+
+            return is;
+        }
+        catch (const std::exception& e)
+        {
+            is.setstate(std::ios::failbit);
+            throw std::runtime_error(std::string("Container input failed: ") + e.what());
+        }
+    }
+
+private:
+    C& container; ///< Wrapped container
+};
@@ -1,29 +1,86 @@
 #pragma once
+#include <cstddef>
 #include <iostream>
 #include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "binary_io.h"
 
 /**
  * @brief A forward container interface with iterator support
  * @tparam T The type of elements stored in the container
  * 
  * This abstract class defines the interface for forward containers
- * that support iteration and basic container operations.
+ * that support iteration and basic container operations. Generic code that
+ * does not need type erasure can template on the concrete container instead
+ * (see is_forward_container in forward_container.h).
  */
 template<typename T>
 class fwd_container {
 public:
+    /**
+     * @brief Size of the inline buffer in iterator/const_iterator
+     * 
+     * Iterator implementations up to this size (a vtable pointer plus a few words
+     * of state) are constructed in place and copied without heap allocation.
+     */
+    static constexpr size_t inline_iterator_size = 4 * sizeof(void*);
 
     class iterator_base;
     class const_iterator_base;
     class iterator;
     class const_iterator;
+    template<typename It, typename ConstIt> class iterator_adapter;
+    template<typename ConstIt, typename It> class const_iterator_adapter;
+
+private:
+    /**
+     * @brief One tag object per concrete iterator/const iterator pair
+     * @tparam It Concrete iterator type
+     * @tparam ConstIt Matching concrete const iterator type
+     *
+     * Both adapters of a pair report the address of the same tag, so comparing two
+     * type-erased iterators only downcasts when they wrap the very same concrete types,
+     * whatever container instantiation (allocator, comparator, ...) produced them.
+     */
+    template<typename It, typename ConstIt>
+    struct iterator_identity {
+        static constexpr char tag = 0;
+    };
+
+    /**
+     * @brief Construct an iterator implementation in the given buffer, or on the heap if it does not fit
+     * @tparam Impl Implementation type to construct
+     * @param storage Inline buffer (aligned to std::max_align_t)
+     * @param capacity Size of the inline buffer in bytes
+     * @param args Arguments forwarded to the Impl constructor
+     * @return Pointer to the new implementation
+     */
+    template<typename Impl, typename... Args>
+    static Impl* construct_iterator(void* storage, size_t capacity, Args&&... args) {
+        if (sizeof(Impl) <= capacity && alignof(Impl) <= alignof(std::max_align_t)) {
+            return ::new (storage) Impl(std::forward<Args>(args)...);
+        }
+        return new Impl(std::forward<Args>(args)...);
+    }
+
+public:
 
     /**
      * @brief Base abstract iterator class for non-const iteration
      */
     class iterator_base {
     public:
-        virtual int get_iterator_kind() const noexcept = 0;
+        /**
+         * @brief Identity of the concrete iterator type behind this object
+         * @return Address unique to the wrapped iterator/const iterator pair; equal only
+         *         for iterators that can be compared with each other
+         */
+        virtual const void* get_iterator_identity() const noexcept = 0;
         
         virtual ~iterator_base() = default;
 
@@ -75,16 +132,20 @@ public:
 
         /**
          * @brief Create a const version of this iterator
-         * @return Pointer to new const_iterator_base
+         * @param storage Inline buffer to construct the copy in if it fits
+         * @param capacity Size of the inline buffer in bytes
+         * @return Pointer to new const_iterator_base (inside storage, or heap-allocated)
          */
-        virtual const_iterator_base* create_const() const = 0;
+        virtual const_iterator_base* create_const(void* storage, size_t capacity) const = 0;
 
     protected:
         /**
          * @brief Clone this iterator
-         * @return Pointer to new cloned iterator_base
+         * @param storage Inline buffer to construct the clone in if it fits
+         * @param capacity Size of the inline buffer in bytes
+         * @return Pointer to new cloned iterator_base (inside storage, or heap-allocated)
          */
-        virtual iterator_base* clone() const = 0;
+        virtual iterator_base* clone(void* storage, size_t capacity) const = 0;
 
         friend class iterator;
         friend class const_iterator;
@@ -95,7 +156,12 @@ public:
      */
     class const_iterator_base {
     public:
-        virtual int get_iterator_kind() const noexcept = 0;
+        /**
+         * @brief Identity of the concrete iterator type behind this object
+         * @return Address unique to the wrapped iterator/const iterator pair; equal only
+         *         for iterators that can be compared with each other
+         */
+        virtual const void* get_iterator_identity() const noexcept = 0;
 
         virtual ~const_iterator_base() = default;
 
@@ -148,9 +214,11 @@ public:
     protected:
         /**
          * @brief Clone this iterator
-         * @return Pointer to new cloned const_iterator_base
+         * @param storage Inline buffer to construct the clone in if it fits
+         * @param capacity Size of the inline buffer in bytes
+         * @return Pointer to new cloned const_iterator_base (inside storage, or heap-allocated)
          */
-        virtual const_iterator_base* clone() const = 0;
+        virtual const_iterator_base* clone(void* storage, size_t capacity) const = 0;
 
         friend class iterator;
         friend class const_iterator;
@@ -161,7 +229,32 @@ public:
      */
     class iterator {
     private:
-        iterator_base* ptr; ///< Pointer to the base iterator implementation
+        alignas(std::max_align_t) unsigned char buffer[inline_iterator_size]; ///< Inline storage for small implementations
+        iterator_base* ptr;  ///< Pointer to the iterator implementation (may point into buffer)
+        bool inlined; ///< True if *ptr lives in buffer rather than on the heap
+
+        /**
+         * @brief Destroy the current implementation and become singular
+         */
+        void reset() noexcept {
+            if (ptr == nullptr) return;
+            if (inlined) {
+                ptr->~iterator_base();
+            } else {
+                delete ptr;
+            }
+            ptr = nullptr;
+            inlined = false;
+        }
+
+        /**
+         * @brief Take a copy of another implementation, in the inline buffer when it fits
+         * @param src Implementation to copy (may be nullptr)
+         */
+        void assign_clone(const iterator_base* src) {
+            ptr = src ? src->clone(buffer, inline_iterator_size) : nullptr;
+            inlined = ptr != nullptr && dynamic_cast<const void*>(ptr) == static_cast<const void*>(buffer);
+        }
 
     public:
         using difference_type   = ptrdiff_t;
@@ -173,39 +266,57 @@ public:
         /**
          * @brief Default constructor
          */
-        iterator() : ptr(nullptr) {}
+        iterator() : ptr(nullptr), inlined(false) {}
         
         /**
          * @brief Constructor from base iterator pointer
-         * @param p Pointer to iterator_base implementation
+         * @param p Pointer to heap-allocated iterator_base implementation (ownership is taken)
+         */
+        iterator(iterator_base* p) : ptr(p), inlined(false) {}
+
+        /**
+         * @brief Constructs the implementation in place, without heap allocation when it fits
+         * @tparam Impl Concrete iterator_base implementation
+         * @param args Arguments forwarded to the Impl constructor
          */
-        iterator(iterator_base* p) : ptr(p) {}
+        template<typename Impl, typename... Args>
+        explicit iterator(std::in_place_type_t<Impl>, Args&&... args) : ptr(nullptr), inlined(false) {
+            ptr = construct_iterator<Impl>(buffer, inline_iterator_size, std::forward<Args>(args)...);
+            inlined = dynamic_cast<const void*>(ptr) == static_cast<const void*>(buffer);
+        }
         
         /**
          * @brief Copy constructor
          * @param other Iterator to copy from
          */
-        iterator(const iterator& other) : ptr(other.ptr ? other.ptr->clone() : nullptr) {}
+        iterator(const iterator& other) : ptr(nullptr), inlined(false) {
+            assign_clone(other.ptr);
+        }
         
         /**
          * @brief Move constructor
          * @param other Iterator to move from
          */
-        iterator(iterator&& other) noexcept : ptr(other.ptr) {
-            other.ptr = nullptr;
+        iterator(iterator&& other) noexcept : ptr(nullptr), inlined(false) {
+            if (other.inlined) {
+                assign_clone(other.ptr);
+            } else {
+                ptr = other.ptr;
+                other.ptr = nullptr;
+            }
         }
         
         /**
          * @brief Constructor from const_iterator
          * @param other Const iterator to convert from
          */
-        iterator(const const_iterator& other) : ptr(nullptr) {}
+        iterator(const const_iterator& other) : ptr(nullptr), inlined(false) {}
         
         /**
          * @brief Destructor
          */
         ~iterator() {
-            delete ptr;
+            reset();
         }
         
         /**
@@ -214,8 +325,10 @@ public:
          * @return Reference to this iterator
          */
         iterator& operator=(const iterator& other) {
-            delete ptr;
-            ptr = other.ptr ? other.ptr->clone() : nullptr;
+            if (this != &other) {
+                reset();
+                assign_clone(other.ptr);
+            }
             return *this;
         }
         
@@ -225,9 +338,15 @@ public:
          * @return Reference to this iterator
          */
         iterator& operator=(iterator&& other) noexcept {
-            delete ptr;
-            ptr = other.ptr;
-            other.ptr = nullptr;
+            if (this != &other) {
+                reset();
+                if (other.inlined) {
+                    assign_clone(other.ptr);
+                } else {
+                    ptr = other.ptr;
+                    other.ptr = nullptr;
+                }
+            }
             return *this;
         }
         
@@ -237,8 +356,7 @@ public:
          * @return Reference to this iterator
          */
         iterator& operator=(const const_iterator& other) {
-            delete ptr;
-            ptr = nullptr;
+            reset();
             return *this;
         }
         
@@ -321,7 +439,41 @@ public:
      */
     class const_iterator {
     private:
-        const_iterator_base* ptr; ///< Pointer to the base const iterator implementation
+        alignas(std::max_align_t) unsigned char buffer[inline_iterator_size]; ///< Inline storage for small implementations
+        const_iterator_base* ptr;  ///< Pointer to the const iterator implementation (may point into buffer)
+        bool inlined; ///< True if *ptr lives in buffer rather than on the heap
+
+        /**
+         * @brief Destroy the current implementation and become singular
+         */
+        void reset() noexcept {
+            if (ptr == nullptr) return;
+            if (inlined) {
+                ptr->~const_iterator_base();
+            } else {
+                delete ptr;
+            }
+            ptr = nullptr;
+            inlined = false;
+        }
+
+        /**
+         * @brief Take a copy of another implementation, in the inline buffer when it fits
+         * @param src Implementation to copy (may be nullptr)
+         */
+        void assign_clone(const const_iterator_base* src) {
+            ptr = src ? src->clone(buffer, inline_iterator_size) : nullptr;
+            inlined = ptr != nullptr && dynamic_cast<const void*>(ptr) == static_cast<const void*>(buffer);
+        }
+
+        /**
+         * @brief Take a const copy of a non-const implementation, in the inline buffer when it fits
+         * @param src Implementation to convert (may be nullptr)
+         */
+        void assign_const(const iterator_base* src) {
+            ptr = src ? src->create_const(buffer, inline_iterator_size) : nullptr;
+            inlined = ptr != nullptr && dynamic_cast<const void*>(ptr) == static_cast<const void*>(buffer);
+        }
 
     public:
         using difference_type   = ptrdiff_t;
@@ -333,41 +485,59 @@ public:
         /**
          * @brief Default constructor
          */
-        const_iterator() : ptr(nullptr) {}
+        const_iterator() : ptr(nullptr), inlined(false) {}
         
         /**
          * @brief Constructor from base const iterator pointer
-         * @param p Pointer to const_iterator_base implementation
+         * @param p Pointer to heap-allocated const_iterator_base implementation (ownership is taken)
+         */
+        const_iterator(const_iterator_base* p) : ptr(p), inlined(false) {}
+
+        /**
+         * @brief Constructs the implementation in place, without heap allocation when it fits
+         * @tparam Impl Concrete const_iterator_base implementation
+         * @param args Arguments forwarded to the Impl constructor
          */
-        const_iterator(const_iterator_base* p) : ptr(p) {}
+        template<typename Impl, typename... Args>
+        explicit const_iterator(std::in_place_type_t<Impl>, Args&&... args) : ptr(nullptr), inlined(false) {
+            ptr = construct_iterator<Impl>(buffer, inline_iterator_size, std::forward<Args>(args)...);
+            inlined = dynamic_cast<const void*>(ptr) == static_cast<const void*>(buffer);
+        }
         
         /**
          * @brief Copy constructor
          * @param other Const iterator to copy from
          */
-        const_iterator(const const_iterator& other) : ptr(other.ptr ? other.ptr->clone() : nullptr) {}
+        const_iterator(const const_iterator& other) : ptr(nullptr), inlined(false) {
+            assign_clone(other.ptr);
+        }
         
         /**
          * @brief Move constructor
          * @param other Const iterator to move from
          */
-        const_iterator(const_iterator&& other) noexcept : ptr(other.ptr) {
-            other.ptr = nullptr;
+        const_iterator(const_iterator&& other) noexcept : ptr(nullptr), inlined(false) {
+            if (other.inlined) {
+                assign_clone(other.ptr);
+            } else {
+                ptr = other.ptr;
+                other.ptr = nullptr;
+            }
         }
         
         /**
          * @brief Constructor from non-const iterator
          * @param other Iterator to convert from
          */
-        const_iterator(const iterator& other) : ptr(nullptr) {
-            ptr = other.ptr->create_const();
+        const_iterator(const iterator& other) : ptr(nullptr), inlined(false) {
+            assign_const(other.ptr);
         }
         
         /**
          * @brief Destructor
          */
         ~const_iterator() {
-            delete ptr;
+            reset();
         }
         
         /**
@@ -376,8 +546,10 @@ public:
          * @return Reference to this iterator
          */
         const_iterator& operator=(const const_iterator& other) {
-            delete ptr;
-            ptr = other.ptr ? other.ptr->clone() : nullptr;
+            if (this != &other) {
+                reset();
+                assign_clone(other.ptr);
+            }
             return *this;
         }
         
@@ -387,9 +559,15 @@ public:
          * @return Reference to this iterator
          */
         const_iterator& operator=(const_iterator&& other) noexcept {
-                delete ptr;
-                ptr = other.ptr;
-                other.ptr = nullptr;
+            if (this != &other) {
+                reset();
+                if (other.inlined) {
+                    assign_clone(other.ptr);
+                } else {
+                    ptr = other.ptr;
+                    other.ptr = nullptr;
+                }
+            }
             return *this;
         }
         
@@ -399,8 +577,8 @@ public:
          * @return Reference to this iterator
          */
         const_iterator& operator=(const iterator& other) {
-            delete ptr;
-            ptr = other.ptr ? other.ptr->create_const() : nullptr;
+            reset();
+            assign_const(other.ptr);
             return *this;
         }
         
@@ -478,6 +656,221 @@ public:
         friend class iterator;
     };
 
+    /**
+     * @brief Adapts a concrete, non-virtual iterator to the polymorphic iterator_base interface
+     * @tparam It Concrete iterator type
+     * @tparam ConstIt Matching concrete const iterator type, constructible from It
+     * 
+     * Containers implement their iterators once as plain value types and use this
+     * adapter to serve callers that only hold a fwd_container<T> reference.
+     */
+    template<typename It, typename ConstIt>
+    class iterator_adapter : public iterator_base {
+    private:
+        It it; ///< Wrapped concrete iterator
+
+    public:
+        const void* get_iterator_identity() const noexcept override {
+            return &iterator_identity<It, ConstIt>::tag;
+        }
+
+        /**
+         * @brief Constructor
+         * @param i Concrete iterator to wrap
+         */
+        explicit iterator_adapter(const It& i) : it(i) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Reference to the current element
+         */
+        T& operator*() override {
+            return *it;
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Pointer to the current element
+         */
+        T* operator->() override {
+            return &(*it);
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        iterator_adapter& operator++() override {
+            ++it;
+            return *this;
+        }
+
+        /**
+         * @brief Equality comparison with iterator_base
+         * @param other The iterator to compare with
+         * @return True if iterators are equal
+         */
+        bool operator==(const iterator_base& other) const override {
+            if (this->get_iterator_identity() != other.get_iterator_identity()) return false;
+            return it == static_cast<const iterator_adapter&>(other).it;
+        }
+
+        /**
+         * @brief Inequality comparison with iterator_base
+         * @param other The iterator to compare with
+         * @return True if iterators are not equal
+         */
+        bool operator!=(const iterator_base& other) const override {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Equality comparison with const_iterator_base
+         * @param other The const iterator to compare with
+         * @return True if iterators are equal
+         */
+        bool operator==(const const_iterator_base& other) const override {
+            if (this->get_iterator_identity() != other.get_iterator_identity()) return false;
+            return ConstIt(it) == static_cast<const const_iterator_adapter<ConstIt, It>&>(other).base();
+        }
+
+        /**
+         * @brief Inequality comparison with const_iterator_base
+         * @param other The const iterator to compare with
+         * @return True if iterators are not equal
+         */
+        bool operator!=(const const_iterator_base& other) const override {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Create a const version of this iterator
+         * @return Pointer to new const_iterator_base
+         */
+        const_iterator_base* create_const(void* storage, size_t capacity) const override {
+            return construct_iterator<const_iterator_adapter<ConstIt, It>>(storage, capacity, ConstIt(it));
+        }
+
+        /**
+         * @brief Get the wrapped concrete iterator
+         * @return Const reference to the concrete iterator
+         */
+        const It& base() const noexcept { return it; }
+
+    protected:
+        /**
+         * @brief Clone this iterator
+         * @param storage Inline buffer to construct the clone in if it fits
+         * @param capacity Size of the inline buffer in bytes
+         * @return Pointer to new cloned iterator
+         */
+        iterator_adapter* clone(void* storage, size_t capacity) const override {
+            return construct_iterator<iterator_adapter>(storage, capacity, it);
+        }
+    };
+
+    /**
+     * @brief Adapts a concrete, non-virtual const iterator to the polymorphic const_iterator_base interface
+     * @tparam ConstIt Concrete const iterator type
+     * @tparam It Matching concrete non-const iterator type
+     */
+    template<typename ConstIt, typename It>
+    class const_iterator_adapter : public const_iterator_base {
+    private:
+        ConstIt it; ///< Wrapped concrete const iterator
+
+    public:
+        const void* get_iterator_identity() const noexcept override {
+            return &iterator_identity<It, ConstIt>::tag;
+        }
+
+        /**
+         * @brief Constructor
+         * @param i Concrete const iterator to wrap
+         */
+        explicit const_iterator_adapter(const ConstIt& i) : it(i) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Const reference to the current element
+         */
+        const T& operator*() const override {
+            return *it;
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Const pointer to the current element
+         */
+        const T* operator->() const override {
+            return &(*it);
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        const_iterator_adapter& operator++() override {
+            ++it;
+            return *this;
+        }
+
+        /**
+         * @brief Equality comparison with const_iterator_base
+         * @param other The const iterator to compare with
+         * @return True if iterators are equal
+         */
+        bool operator==(const const_iterator_base& other) const override {
+            if (this->get_iterator_identity() != other.get_iterator_identity()) return false;
+            return it == static_cast<const const_iterator_adapter&>(other).it;
+        }
+
+        /**
+         * @brief Inequality comparison with const_iterator_base
+         * @param other The const iterator to compare with
+         * @return True if iterators are not equal
+         */
+        bool operator!=(const const_iterator_base& other) const override {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Equality comparison with iterator_base
+         * @param other The iterator to compare with
+         * @return True if iterators are equal
+         */
+        bool operator==(const iterator_base& other) const override {
+            if (this->get_iterator_identity() != other.get_iterator_identity()) return false;
+            return it == ConstIt(static_cast<const iterator_adapter<It, ConstIt>&>(other).base());
+        }
+
+        /**
+         * @brief Inequality comparison with iterator_base
+         * @param other The iterator to compare with
+         * @return True if iterators are not equal
+         */
+        bool operator!=(const iterator_base& other) const override {
+            return !(*this == other);
+        }
+
+        /**
+         * @brief Get the wrapped concrete const iterator
+         * @return Const reference to the concrete const iterator
+         */
+        const ConstIt& base() const noexcept { return it; }
+
+    protected:
+        /**
+         * @brief Clone this iterator
+         * @param storage Inline buffer to construct the clone in if it fits
+         * @param capacity Size of the inline buffer in bytes
+         * @return Pointer to new cloned const iterator
+         */
+        const_iterator_adapter* clone(void* storage, size_t capacity) const override {
+            return construct_iterator<const_iterator_adapter>(storage, capacity, it);
+        }
+    };
+
     /**
      * @brief Add element to the container (copy semantics)
      * @param value The value to add
@@ -507,6 +900,42 @@ public:
      * @return Const reference to the front element
      */
     virtual const T& get_front() const = 0;
+
+    /**
+     * @brief Remove the front element if there is one, without throwing on empty
+     * @param out Receives the removed element
+     * @return True if an element was removed, false if the container was empty
+     */
+    virtual bool try_pop(T& out) {
+        if (is_empty()) return false;
+        out = pop();
+        return true;
+    }
+
+    /**
+     * @brief Remove the front element if there is one, without throwing on empty
+     * @return The removed element, or std::nullopt if the container was empty
+     */
+    virtual std::optional<T> try_pop() {
+        if (is_empty()) return std::nullopt;
+        return std::optional<T>(pop());
+    }
+
+    /**
+     * @brief Get pointer to the front element, without throwing on empty
+     * @return Pointer to the front element, or nullptr if the container is empty
+     */
+    virtual T* try_front() noexcept {
+        return is_empty() ? nullptr : &get_front();
+    }
+
+    /**
+     * @brief Get const pointer to the front element, without throwing on empty
+     * @return Const pointer to the front element, or nullptr if the container is empty
+     */
+    virtual const T* try_front() const noexcept {
+        return is_empty() ? nullptr : &get_front();
+    }
     
     /**
      * @brief Check if container is empty
@@ -519,42 +948,128 @@ public:
      * @return Size of the container
      */
     virtual size_t size() const = 0;
+
+    /**
+     * @brief Add a range of elements in order, as if by push() for each of them
+     * @param first Pointer to the first element to add
+     * @param last Pointer past the last element to add
+     * 
+     * The default implementation pushes one element at a time and only gives the basic
+     * guarantee; Stack and Queue override it to link the whole range before attaching it,
+     * so either every element is added or the container is left unchanged.
+     */
+    virtual void push_range(const T* first, const T* last) {
+        for (; first != last; ++first) push(*first);
+    }
+
+    /**
+     * @brief Remove n elements, writing them in pop() order to out
+     * @param n Number of elements to remove
+     * @param out Destination for the removed elements
+     * @return Pointer past the last element written
+     * @throws std::runtime_error if the container holds fewer than n elements
+     */
+    virtual T* pop_n(size_t n, T* out) {
+        if (n > size()) throw std::runtime_error("Cannot pop_n: not enough elements in container");
+        for (; n > 0; --n) *out++ = pop();
+        return out;
+    }
+
+    /**
+     * @brief Remove every element, writing them in pop() order to out
+     * @param out Destination for the removed elements (must have room for size() elements)
+     * @return Pointer past the last element written
+     */
+    virtual T* drain_into(T* out) {
+        return pop_n(size(), out);
+    }
+    
+    /**
+     * @brief Write the contents in the binary format
+     * @param os Output stream (should be opened in binary mode)
+     * @return Reference to the output stream
+     * @throws std::runtime_error if an element cannot be encoded or the stream fails; failbit is set
+     * 
+     * A versioned header carrying the element count is followed by the elements in
+     * iteration order. Trivially copyable elements are written as raw bytes in batches,
+     * std::string as length and characters, and other types as length-prefixed text
+     * from operator<< (see binary_codec).
+     */
+    virtual std::ostream& save(std::ostream& os) const {
+        try {
+            if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+            binary_write_header<T>(os, size());
+            binary_write_elements<T>(os, begin(), end());
+            if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+            return os;
+        }
+        catch (const std::exception& e) {
+            os.setstate(std::ios::failbit);
+            throw std::runtime_error(std::string("Container save failed: ") + e.what());
+        }
+    }
+
+    /**
+     * @brief Add the elements stored by save()
+     * @param is Input stream (should be opened in binary mode)
+     * @return Reference to the input stream
+     * @throws std::runtime_error if the data is malformed or was saved for another element type; failbit is set
+     * 
+     * The loaded elements keep their saved iteration order and come before (Stack) or
+     * after (Queue) the existing ones, and a failed load leaves the container as it was.
+     * This default decodes everything into a buffer before pushing, so malformed data
+     * never reaches the container; implementations override it to skip the buffer.
+     */
+    virtual std::istream& load(std::istream& is) {
+        try {
+            if (!is.good()) throw std::runtime_error("Input stream is in bad state");
+            binary_header header = binary_read_header<T>(is);
+            std::vector<T> staged;
+            binary_read_elements<T>(is, header.count, [&staged](T&& value) { staged.push_back(std::move(value)); });
+            for (T& value : staged) push(std::move(value));
+            return is;
+        }
+        catch (const std::exception& e) {
+            is.setstate(std::ios::failbit);
+            throw std::runtime_error(std::string("Container load failed: ") + e.what());
+        }
+    }
     
     /**
      * @brief Get iterator to the beginning
      * @return Iterator to the first element
      */
-    virtual iterator begin() = 0;
+    iterator begin() { return make_begin(); }
     
     /**
      * @brief Get iterator to the end
      * @return Iterator to the position after the last element
      */
-    virtual iterator end() = 0;
+    iterator end() { return make_end(); }
     
     /**
      * @brief Get const iterator to the beginning
      * @return Const iterator to the first element
      */
-    virtual const_iterator begin() const = 0;
+    const_iterator begin() const { return make_begin(); }
     
     /**
      * @brief Get const iterator to the end
      * @return Const iterator to the position after the last element
      */
-    virtual const_iterator end() const = 0;
+    const_iterator end() const { return make_end(); }
     
     /**
      * @brief Get const iterator to the beginning
      * @return Const iterator to the first element
      */
-    virtual const_iterator cbegin() const = 0;
+    const_iterator cbegin() const { return make_begin(); }
     
     /**
      * @brief Get const iterator to the end
      * @return Const iterator to the position after the last element
      */
-    virtual const_iterator cend() const = 0;
+    const_iterator cend() const { return make_end(); }
 
     /**
      * @brief Assignment operator
@@ -601,6 +1116,56 @@ public:
     }
 
 protected:
+    /**
+     * @brief Create a polymorphic iterator to the first element
+     * @return Iterator to the first element
+     * 
+     * Implementations usually return wrap_iterator() applied to their concrete begin().
+     */
+    virtual iterator make_begin() = 0;
+
+    /**
+     * @brief Create a polymorphic iterator to the position after the last element
+     * @return Iterator to the end
+     */
+    virtual iterator make_end() = 0;
+
+    /**
+     * @brief Create a polymorphic const iterator to the first element
+     * @return Const iterator to the first element
+     */
+    virtual const_iterator make_begin() const = 0;
+
+    /**
+     * @brief Create a polymorphic const iterator to the position after the last element
+     * @return Const iterator to the end
+     */
+    virtual const_iterator make_end() const = 0;
+
+    /**
+     * @brief Wrap a concrete iterator into the polymorphic iterator
+     * @tparam It Concrete iterator type
+     * @tparam ConstIt Matching concrete const iterator type
+     * @param it Concrete iterator to wrap
+     * @return Polymorphic iterator positioned like it
+     */
+    template<typename It, typename ConstIt>
+    static iterator wrap_iterator(const It& it) {
+        return iterator(std::in_place_type<iterator_adapter<It, ConstIt>>, it);
+    }
+
+    /**
+     * @brief Wrap a concrete const iterator into the polymorphic const iterator
+     * @tparam ConstIt Concrete const iterator type
+     * @tparam It Matching concrete non-const iterator type
+     * @param it Concrete const iterator to wrap
+     * @return Polymorphic const iterator positioned like it
+     */
+    template<typename ConstIt, typename It>
+    static const_iterator wrap_const_iterator(const ConstIt& it) {
+        return const_iterator(std::in_place_type<const_iterator_adapter<ConstIt, It>>, it);
+    }
+
     /**
      * @brief Print container contents to output stream
      * @param os Output stream
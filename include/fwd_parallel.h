@@ -0,0 +1,134 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "forward_container.h"
+#include "thread_pool.h"
+
+/**
+ * @brief Detects iterators offering skip(n), a faster way to advance than n increments
+ * @tparam It Iterator type
+ *
+ * Chunked iterators skip whole chunks at a time; iterators over contiguous storage or
+ * the Deque block map skip in constant time.
+ */
+template<typename It, typename = void>
+struct has_iterator_skip : std::false_type {};
+
+template<typename It>
+struct has_iterator_skip<It, std::void_t<decltype(std::declval<It&>().skip(size_t()))>> : std::true_type {};
+
+template<typename It>
+inline constexpr bool has_iterator_skip_v = has_iterator_skip<It>::value;
+
+/**
+ * @brief Parallel algorithms over the contents of a forward container
+ *
+ * Every algorithm cuts the container into balanced segments of consecutive elements
+ * using size(), runs the segments on a ThreadPool and waits for all of them. The
+ * calling thread finds the segment boundaries and then processes the last segment
+ * itself. Each segment is handed to the pool as soon as its end is found, so workers
+ * start while the caller is still looking for the later boundaries. Finding a boundary
+ * costs one increment per element on a linked Stack or Queue, one step per chunk on
+ * chunked storage and nothing on contiguous storage or a Deque (see has_iterator_skip).
+ * Containers below 2 * min_segment elements, and calls made from a worker of the same
+ * pool, are processed on the calling thread.
+ *
+ * The container must not be modified by any thread while an algorithm runs. The
+ * function objects are shared by all segments and must be safe to call concurrently.
+ * If one of them throws, the remaining segments still finish and the first exception
+ * is rethrown.
+ */
+struct fwd_parallel {
+    static constexpr size_t min_segment = 4096; ///< Smallest segment worth handing to another thread
+
+    /**
+     * @brief Pool used when no pool is passed: one worker per hardware thread, created on first use
+     * @return Reference to the shared pool
+     */
+    static ThreadPool& default_pool();
+
+    /**
+     * @brief Call a function on every element
+     * @tparam C Forward container type (may be const)
+     * @tparam F Callable taking an element reference
+     * @param container Container to process
+     * @param f Function to call; its result is ignored
+     * @param pool Pool running the segments
+     */
+    template<typename C, typename F>
+    static void for_each(C& container, F f, ThreadPool& pool = default_pool());
+
+    /**
+     * @brief Count the elements satisfying a predicate
+     * @tparam C Forward container type (may be const)
+     * @tparam Predicate Callable taking a const element reference and returning bool
+     * @param container Container to process
+     * @param pred Predicate to test
+     * @param pool Pool running the segments
+     * @return Number of elements for which pred returned true
+     */
+    template<typename C, typename Predicate>
+    static size_t count_if(C& container, Predicate pred, ThreadPool& pool = default_pool());
+
+    /**
+     * @brief Fold the elements with an associative and commutative operation, like std::reduce
+     * @tparam C Forward container type (may be const)
+     * @tparam T Result type
+     * @tparam BinaryOp Callable combining two values into a T
+     * @param container Container to process
+     * @param init Initial value, folded in once
+     * @param op Operation; segments are folded separately and their results combined in order
+     * @param pool Pool running the segments
+     * @return init combined with every element
+     */
+    template<typename C, typename T, typename BinaryOp = std::plus<>>
+    static T reduce(C& container, T init, BinaryOp op = BinaryOp(), ThreadPool& pool = default_pool());
+
+    /**
+     * @brief Replace every element by the result of a function applied to it
+     * @tparam C Forward container type
+     * @tparam F Callable taking a const element reference and returning the new value
+     * @param container Container to process
+     * @param f Transformation to apply
+     * @param pool Pool running the segments
+     */
+    template<typename C, typename F>
+    static void transform_inplace(C& container, F f, ThreadPool& pool = default_pool());
+
+    /**
+     * @brief Advance an iterator, using skip(n) when the iterator offers it
+     * @tparam It Iterator type
+     * @param it Iterator to advance
+     * @param n Number of positions (at most the distance to the end)
+     */
+    template<typename It>
+    static void advance(It& it, size_t n);
+
+private:
+    /**
+     * @brief Number of segments to cut a container into
+     * @param count Number of elements
+     * @param pool Pool that will run the segments
+     * @return Segment count (1 means process on the calling thread)
+     */
+    static size_t segment_count(size_t count, const ThreadPool& pool) noexcept;
+
+    /**
+     * @brief Cut the container into segments and run them on the pool and the calling thread
+     * @tparam C Forward container type
+     * @tparam SegmentFn Callable taking (segment index, first iterator, last iterator)
+     * @param container Container to process
+     * @param parts Number of segments, from segment_count
+     * @param pool Pool running all segments but the last
+     * @param segment Work to do on each segment
+     * @throws The first exception thrown by segment, once every segment has finished
+     */
+    template<typename C, typename SegmentFn>
+    static void run_segments(C& container, size_t parts, ThreadPool& pool, SegmentFn& segment);
+};
+
+#include "fwd_parallel.ipp"
@@ -0,0 +1,166 @@
+#include "fwd_parallel.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+// Scheduling
+inline ThreadPool& fwd_parallel::default_pool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+inline size_t fwd_parallel::segment_count(size_t count, const ThreadPool& pool) noexcept {
+    if (count < 2 * min_segment || pool.is_worker()) return 1;
+
+    // Workers plus the calling thread, with no segment shorter than min_segment
+    size_t parts = pool.thread_count() + 1;
+    if (parts > count / min_segment) parts = count / min_segment;
+    return parts;
+}
+
+template<typename It>
+void fwd_parallel::advance(It& it, size_t n) {
+    if constexpr (has_iterator_skip_v<It>) {
+        it.skip(n);
+    } else if constexpr (std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>) {
+        it += static_cast<typename std::iterator_traits<It>::difference_type>(n);
+    } else {
+        for (; n > 0; --n) ++it;
+    }
+}
+
+template<typename C, typename SegmentFn>
+void fwd_parallel::run_segments(C& container, size_t parts, ThreadPool& pool, SegmentFn& segment) {
+    using It = decltype(container.begin());
+
+    if (parts <= 1) {
+        segment(size_t(0), container.begin(), container.end());
+        return;
+    }
+
+    // The segments borrow this frame, so it is left only once every submitted one is done
+    struct completion {
+        std::mutex mutex;
+        std::condition_variable done;
+        size_t pending = 0;
+        std::exception_ptr failure;
+
+        void fail(std::exception_ptr e) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!failure) failure = e;
+        }
+
+        void finish() {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pending == 0) done.notify_all();
+        }
+    } group;
+
+    const size_t total = container.size();
+    const size_t length = total / parts;
+    const size_t longer = total % parts;
+
+    try {
+        It first = container.begin();
+        for (size_t k = 0; k + 1 < parts; ++k) {
+            It last = first;
+            advance(last, length + (k < longer ? 1 : 0));
+            {
+                std::lock_guard<std::mutex> lock(group.mutex);
+                ++group.pending;
+            }
+            try {
+                pool.submit([&group, &segment, k, first, last] {
+                    try {
+                        segment(k, first, last);
+                    }
+                    catch (...) {
+                        group.fail(std::current_exception());
+                    }
+                    group.finish();
+                });
+            }
+            catch (...) {
+                group.finish();
+                throw;
+            }
+            first = last;
+        }
+        segment(parts - 1, first, container.end());
+    }
+    catch (...) {
+        group.fail(std::current_exception());
+    }
+
+    std::unique_lock<std::mutex> lock(group.mutex);
+    group.done.wait(lock, [&group] { return group.pending == 0; });
+    if (group.failure) std::rethrow_exception(group.failure);
+}
+
+// Algorithms
+template<typename C, typename F>
+void fwd_parallel::for_each(C& container, F f, ThreadPool& pool) {
+    static_assert(is_forward_container_v<std::remove_const_t<C>>, "fwd_parallel needs a forward container");
+
+    auto segment = [&f](size_t, auto first, auto last) {
+        for (; first != last; ++first) f(*first);
+    };
+    run_segments(container, segment_count(container.size(), pool), pool, segment);
+}
+
+template<typename C, typename Predicate>
+size_t fwd_parallel::count_if(C& container, Predicate pred, ThreadPool& pool) {
+    static_assert(is_forward_container_v<std::remove_const_t<C>>, "fwd_parallel needs a forward container");
+
+    const size_t parts = segment_count(container.size(), pool);
+    std::vector<size_t> counts(parts, 0);
+    auto segment = [&pred, &counts](size_t index, auto first, auto last) {
+        // Counted locally so the segments do not share a cache line while scanning
+        size_t count = 0;
+        for (; first != last; ++first) {
+            if (pred(*first)) ++count;
+        }
+        counts[index] = count;
+    };
+    run_segments(container, parts, pool, segment);
+
+    size_t total = 0;
+    for (size_t count : counts) total += count;
+    return total;
+}
+
+template<typename C, typename T, typename BinaryOp>
+T fwd_parallel::reduce(C& container, T init, BinaryOp op, ThreadPool& pool) {
+    static_assert(is_forward_container_v<std::remove_const_t<C>>, "fwd_parallel needs a forward container");
+
+    const size_t parts = segment_count(container.size(), pool);
+    std::vector<std::optional<T>> partials(parts);
+    auto segment = [&op, &partials](size_t index, auto first, auto last) {
+        if (first == last) return;
+        T partial(*first);
+        for (++first; first != last; ++first) {
+            partial = op(std::move(partial), *first);
+        }
+        partials[index].emplace(std::move(partial));
+    };
+    run_segments(container, parts, pool, segment);
+
+    for (std::optional<T>& partial : partials) {
+        if (partial) init = op(std::move(init), std::move(*partial));
+    }
+    return init;
+}
+
+template<typename C, typename F>
+void fwd_parallel::transform_inplace(C& container, F f, ThreadPool& pool) {
+    static_assert(is_forward_container_v<C>, "fwd_parallel needs a forward container");
+
+    auto segment = [&f](size_t, auto first, auto last) {
+        for (; first != last; ++first) *first = f(std::as_const(*first));
+    };
+    run_segments(container, segment_count(container.size(), pool), pool, segment);
+}
@@ -0,0 +1,226 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "forward_container.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define FWD_SIMD_X86 1
+#else
+#define FWD_SIMD_X86 0
+#endif
+
+/**
+ * @brief Instruction sets the fwd_simd kernels can run on, from slowest to fastest
+ */
+enum class simd_level {
+    scalar, ///< Plain loops, available everywhere
+    sse2,   ///< 128-bit vectors (baseline on x86-64)
+    avx2    ///< 256-bit vectors, used when the CPU reports AVX2 at run time
+};
+
+/**
+ * @brief True for the element types with vectorized kernels: int, float and double
+ * @tparam T Element type
+ */
+template<typename T>
+inline constexpr bool is_simd_arithmetic_v = std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+/**
+ * @brief Result type of fwd_simd::sum: int is summed in 64 bits, every other type in itself
+ * @tparam T Element type
+ */
+template<typename T>
+using simd_sum_t = std::conditional_t<std::is_same_v<T, int>, long long, T>;
+
+/**
+ * @brief Detects containers exposing their elements as contiguous runs through for_each_span()
+ * @tparam C Container type
+ */
+template<typename C, typename = void>
+struct has_for_each_span : std::false_type {};
+
+template<typename C>
+struct has_for_each_span<C, std::void_t<decltype(std::declval<const C&>().for_each_span(
+    std::declval<bool (*)(const forward_container_value_t<C>*, const forward_container_value_t<C>*)>())),
+    decltype(C::reversed_spans)>> : std::true_type {};
+
+template<typename C>
+inline constexpr bool has_for_each_span_v = has_for_each_span<C>::value;
+
+/**
+ * @brief Vectorized find, count, sum, min/max and replace over contiguous runs of arithmetic elements
+ *
+ * The range kernels work on [first, last) of int, float or double with SSE2 or AVX2,
+ * picked at run time from what the CPU supports (detected_level()), and fall back to
+ * plain loops for other element types and other architectures. The container versions
+ * feed them the runs of chunked Stack/Queue, contiguous Stack and Deque storage through
+ * for_each_span(), so a scan costs one kernel call per chunk instead of one pointer
+ * hop per element. Containers without for_each_span() (the linked Stack and Queue) are
+ * scanned element by element with the same results.
+ *
+ * Equality follows operator== (NaN never matches). Vectorized sums add the elements in
+ * a different order than a sequential loop, so float and double sums may differ from
+ * std::accumulate by rounding; min and max of ranges containing NaN are unspecified.
+ */
+struct fwd_simd {
+    /**
+     * @brief Best instruction set supported by the running CPU
+     * @return simd_level::avx2 or simd_level::sse2 on x86, simd_level::scalar elsewhere
+     */
+    static simd_level detected_level() noexcept;
+
+    /**
+     * @brief Find the first element equal to a value
+     * @param first Start of the range
+     * @param last End of the range
+     * @param value Value to look for (converted to T)
+     * @param level Instruction set to use (lowered to detected_level() if above it)
+     * @return Pointer to the first match, or last if there is none
+     */
+    template<typename T, typename U>
+    static const T* find(const T* first, const T* last, const U& value, simd_level level = detected_level());
+
+    /**
+     * @brief Find the last element equal to a value
+     * @param first Start of the range
+     * @param last End of the range
+     * @param value Value to look for (converted to T)
+     * @param level Instruction set to use (lowered to detected_level() if above it)
+     * @return Pointer to the last match, or last if there is none
+     */
+    template<typename T, typename U>
+    static const T* find_last(const T* first, const T* last, const U& value, simd_level level = detected_level());
+
+    /**
+     * @brief Count the elements equal to a value
+     * @param first Start of the range
+     * @param last End of the range
+     * @param value Value to count (converted to T)
+     * @param level Instruction set to use (lowered to detected_level() if above it)
+     * @return Number of matches
+     */
+    template<typename T, typename U>
+    static size_t count(const T* first, const T* last, const U& value, simd_level level = detected_level());
+
+    /**
+     * @brief Add up the elements
+     * @param first Start of the range
+     * @param last End of the range
+     * @param level Instruction set to use (lowered to detected_level() if above it)
+     * @return Sum of the elements (0 for an empty range)
+     */
+    template<typename T>
+    static simd_sum_t<T> sum(const T* first, const T* last, simd_level level = detected_level());
+
+    /**
+     * @brief Smallest element
+     * @param first Start of the range
+     * @param last End of the range
+     * @param level Instruction set to use (lowered to detected_level() if above it)
+     * @return Value of the smallest element
+     * @throws std::runtime_error if the range is empty
+     */
+    template<typename T>
+    static T min(const T* first, const T* last, simd_level level = detected_level());
+
+    /**
+     * @brief Largest element
+     * @param first Start of the range
+     * @param last End of the range
+     * @param level Instruction set to use (lowered to detected_level() if above it)
+     * @return Value of the largest element
+     * @throws std::runtime_error if the range is empty
+     */
+    template<typename T>
+    static T max(const T* first, const T* last, simd_level level = detected_level());
+
+    /**
+     * @brief Overwrite every element equal to one value with another
+     * @param first Start of the range
+     * @param last End of the range
+     * @param old_value Value to replace (converted to T)
+     * @param new_value Replacement (converted to T)
+     * @param level Instruction set to use (lowered to detected_level() if above it)
+     * @return Number of replaced elements
+     */
+    template<typename T, typename U, typename V>
+    static size_t replace(T* first, T* last, const U& old_value, const V& new_value, simd_level level = detected_level());
+
+    /**
+     * @brief Find the first element, in iteration order, equal to a value
+     * @param container Forward container to search
+     * @param value Value to look for (converted to the element type, whatever the storage)
+     * @return Pointer to the element (const if the container is const), or nullptr if there is none
+     */
+    template<typename C, typename U>
+    static auto find(C& container, const U& value)
+        -> std::conditional_t<std::is_const_v<C>, const forward_container_value_t<C>*, forward_container_value_t<C>*>;
+
+    /**
+     * @brief Count the elements equal to a value
+     * @param container Forward container to scan
+     * @param value Value to count (converted to the element type, whatever the storage)
+     * @return Number of matches
+     */
+    template<typename C, typename U>
+    static size_t count(const C& container, const U& value);
+
+    /**
+     * @brief Add up the elements
+     * @param container Forward container to scan
+     * @return Sum of the elements (0 for an empty container)
+     */
+    template<typename C>
+    static simd_sum_t<forward_container_value_t<C>> sum(const C& container);
+
+    /**
+     * @brief Smallest element
+     * @param container Forward container to scan
+     * @return Value of the smallest element
+     * @throws std::runtime_error if the container is empty
+     */
+    template<typename C>
+    static forward_container_value_t<C> min(const C& container);
+
+    /**
+     * @brief Largest element
+     * @param container Forward container to scan
+     * @return Value of the largest element
+     * @throws std::runtime_error if the container is empty
+     */
+    template<typename C>
+    static forward_container_value_t<C> max(const C& container);
+
+    /**
+     * @brief Overwrite every element equal to one value with another
+     * @param container Forward container to modify
+     * @param old_value Value to replace (converted to the element type, whatever the storage)
+     * @param new_value Replacement (converted to the element type)
+     * @return Number of replaced elements
+     */
+    template<typename C, typename U, typename V>
+    static size_t replace(C& container, const U& old_value, const V& new_value);
+
+private:
+    /**
+     * @brief Clamp a requested level to what the CPU supports
+     * @param level Requested level
+     * @return The lower of level and detected_level()
+     */
+    static simd_level usable(simd_level level) noexcept;
+
+    /**
+     * @brief Shared implementation of the container min and max
+     * @tparam Largest True for max, false for min
+     * @param container Forward container to scan
+     * @return Value of the extreme element
+     * @throws std::runtime_error if the container is empty
+     */
+    template<bool Largest, typename C>
+    static forward_container_value_t<C> extreme(const C& container);
+};
+
+#include "fwd_simd.ipp"
@@ -0,0 +1,589 @@
+#include "fwd_simd.h"
+
+#if FWD_SIMD_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Plain-loop kernels: the fallback for every type and the tail of the vector kernels
+ * @tparam T Element type
+ */
+template<typename T>
+struct simd_scalar_kernels {
+    static const T* find(const T* first, const T* last, T value) noexcept {
+        for (; first != last; ++first) {
+            if (*first == value) return first;
+        }
+        return last;
+    }
+
+    static const T* find_last(const T* first, const T* last, T value) noexcept {
+        for (const T* p = last; p != first;) {
+            if (*--p == value) return p;
+        }
+        return last;
+    }
+
+    static size_t count(const T* first, const T* last, T value) noexcept {
+        size_t total = 0;
+        for (; first != last; ++first) {
+            if (*first == value) ++total;
+        }
+        return total;
+    }
+
+    static simd_sum_t<T> sum(const T* first, const T* last) noexcept {
+        simd_sum_t<T> total = simd_sum_t<T>();
+        for (; first != last; ++first) total += *first;
+        return total;
+    }
+
+    static T min(const T* first, const T* last) noexcept {
+        T best = *first;
+        for (++first; first != last; ++first) {
+            if (*first < best) best = *first;
+        }
+        return best;
+    }
+
+    static T max(const T* first, const T* last) noexcept {
+        T best = *first;
+        for (++first; first != last; ++first) {
+            if (best < *first) best = *first;
+        }
+        return best;
+    }
+
+    static size_t replace(T* first, T* last, T old_value, T new_value) noexcept {
+        size_t replaced = 0;
+        for (; first != last; ++first) {
+            if (*first == old_value) {
+                *first = new_value;
+                ++replaced;
+            }
+        }
+        return replaced;
+    }
+};
+
+#if FWD_SIMD_X86
+
+#define FWD_SIMD_AVX2 __attribute__((target("avx2")))
+#define FWD_SIMD_INLINE __attribute__((always_inline)) inline
+
+// simd_vector_kernels passes 256-bit registers around without being compiled for AVX
+// itself; it is only ever inlined into AVX2 callers, so the ABI note GCC emits is moot
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+/**
+ * @brief Per-type vector operations used by simd_vector_kernels
+ * @tparam T Element type (int, float or double)
+ *
+ * Every specialization provides the register type and lane count, unaligned load and
+ * store, broadcast, lane-wise equality (all bits set where equal), a bit mask with one
+ * bit per lane, a lane select, lane-wise min/max and a sum accumulator.
+ */
+template<typename T>
+struct simd_sse2_ops;
+
+template<>
+struct simd_sse2_ops<int> {
+    using value_type = int;
+    using reg = __m128i;
+    using acc = __m128i; ///< Two 64-bit partial sums
+    static constexpr size_t lanes = 4;
+
+    static reg load(const int* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static void store(int* p, reg v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    static reg set1(int v) noexcept { return _mm_set1_epi32(v); }
+    static reg eq(reg a, reg b) noexcept { return _mm_cmpeq_epi32(a, b); }
+    static unsigned bits(reg mask) noexcept { return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(mask))); }
+    static reg select(reg mask, reg a, reg b) noexcept { return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); }
+    // SSE2 has no 32-bit min/max; select through a comparison instead
+    static reg min(reg a, reg b) noexcept { return select(_mm_cmplt_epi32(a, b), a, b); }
+    static reg max(reg a, reg b) noexcept { return select(_mm_cmpgt_epi32(a, b), a, b); }
+    static acc acc_zero() noexcept { return _mm_setzero_si128(); }
+    static acc acc_add(acc total, reg v) noexcept {
+        const __m128i sign = _mm_srai_epi32(v, 31);
+        return _mm_add_epi64(total, _mm_add_epi64(_mm_unpacklo_epi32(v, sign), _mm_unpackhi_epi32(v, sign)));
+    }
+    static long long acc_total(acc total) noexcept {
+        alignas(16) long long parts[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(parts), total);
+        return parts[0] + parts[1];
+    }
+};
+
+template<>
+struct simd_sse2_ops<float> {
+    using value_type = float;
+    using reg = __m128;
+    using acc = __m128;
+    static constexpr size_t lanes = 4;
+
+    static reg load(const float* p) noexcept { return _mm_loadu_ps(p); }
+    static void store(float* p, reg v) noexcept { _mm_storeu_ps(p, v); }
+    static reg set1(float v) noexcept { return _mm_set1_ps(v); }
+    static reg eq(reg a, reg b) noexcept { return _mm_cmpeq_ps(a, b); }
+    static unsigned bits(reg mask) noexcept { return static_cast<unsigned>(_mm_movemask_ps(mask)); }
+    static reg select(reg mask, reg a, reg b) noexcept { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+    static reg min(reg a, reg b) noexcept { return _mm_min_ps(a, b); }
+    static reg max(reg a, reg b) noexcept { return _mm_max_ps(a, b); }
+    static acc acc_zero() noexcept { return _mm_setzero_ps(); }
+    static acc acc_add(acc total, reg v) noexcept { return _mm_add_ps(total, v); }
+    static float acc_total(acc total) noexcept {
+        alignas(16) float parts[4];
+        _mm_store_ps(parts, total);
+        return (parts[0] + parts[1]) + (parts[2] + parts[3]);
+    }
+};
+
+template<>
+struct simd_sse2_ops<double> {
+    using value_type = double;
+    using reg = __m128d;
+    using acc = __m128d;
+    static constexpr size_t lanes = 2;
+
+    static reg load(const double* p) noexcept { return _mm_loadu_pd(p); }
+    static void store(double* p, reg v) noexcept { _mm_storeu_pd(p, v); }
+    static reg set1(double v) noexcept { return _mm_set1_pd(v); }
+    static reg eq(reg a, reg b) noexcept { return _mm_cmpeq_pd(a, b); }
+    static unsigned bits(reg mask) noexcept { return static_cast<unsigned>(_mm_movemask_pd(mask)); }
+    static reg select(reg mask, reg a, reg b) noexcept { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); }
+    static reg min(reg a, reg b) noexcept { return _mm_min_pd(a, b); }
+    static reg max(reg a, reg b) noexcept { return _mm_max_pd(a, b); }
+    static acc acc_zero() noexcept { return _mm_setzero_pd(); }
+    static acc acc_add(acc total, reg v) noexcept { return _mm_add_pd(total, v); }
+    static double acc_total(acc total) noexcept {
+        alignas(16) double parts[2];
+        _mm_store_pd(parts, total);
+        return parts[0] + parts[1];
+    }
+};
+
+/**
+ * @brief AVX2 counterparts of simd_sse2_ops; only called after detected_level() reported AVX2
+ * @tparam T Element type (int, float or double)
+ */
+template<typename T>
+struct simd_avx2_ops;
+
+template<>
+struct simd_avx2_ops<int> {
+    using value_type = int;
+    using reg = __m256i;
+    using acc = __m256i; ///< Four 64-bit partial sums
+    static constexpr size_t lanes = 8;
+
+    FWD_SIMD_AVX2 static reg load(const int* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    FWD_SIMD_AVX2 static void store(int* p, reg v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    FWD_SIMD_AVX2 static reg set1(int v) noexcept { return _mm256_set1_epi32(v); }
+    FWD_SIMD_AVX2 static reg eq(reg a, reg b) noexcept { return _mm256_cmpeq_epi32(a, b); }
+    FWD_SIMD_AVX2 static unsigned bits(reg mask) noexcept { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(mask))); }
+    FWD_SIMD_AVX2 static reg select(reg mask, reg a, reg b) noexcept { return _mm256_blendv_epi8(b, a, mask); }
+    FWD_SIMD_AVX2 static reg min(reg a, reg b) noexcept { return _mm256_min_epi32(a, b); }
+    FWD_SIMD_AVX2 static reg max(reg a, reg b) noexcept { return _mm256_max_epi32(a, b); }
+    FWD_SIMD_AVX2 static acc acc_zero() noexcept { return _mm256_setzero_si256(); }
+    FWD_SIMD_AVX2 static acc acc_add(acc total, reg v) noexcept {
+        const __m256i low = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v));
+        const __m256i high = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1));
+        return _mm256_add_epi64(total, _mm256_add_epi64(low, high));
+    }
+    FWD_SIMD_AVX2 static long long acc_total(acc total) noexcept {
+        alignas(32) long long parts[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(parts), total);
+        return (parts[0] + parts[1]) + (parts[2] + parts[3]);
+    }
+};
+
+template<>
+struct simd_avx2_ops<float> {
+    using value_type = float;
+    using reg = __m256;
+    using acc = __m256;
+    static constexpr size_t lanes = 8;
+
+    FWD_SIMD_AVX2 static reg load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+    FWD_SIMD_AVX2 static void store(float* p, reg v) noexcept { _mm256_storeu_ps(p, v); }
+    FWD_SIMD_AVX2 static reg set1(float v) noexcept { return _mm256_set1_ps(v); }
+    FWD_SIMD_AVX2 static reg eq(reg a, reg b) noexcept { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    FWD_SIMD_AVX2 static unsigned bits(reg mask) noexcept { return static_cast<unsigned>(_mm256_movemask_ps(mask)); }
+    FWD_SIMD_AVX2 static reg select(reg mask, reg a, reg b) noexcept { return _mm256_blendv_ps(b, a, mask); }
+    FWD_SIMD_AVX2 static reg min(reg a, reg b) noexcept { return _mm256_min_ps(a, b); }
+    FWD_SIMD_AVX2 static reg max(reg a, reg b) noexcept { return _mm256_max_ps(a, b); }
+    FWD_SIMD_AVX2 static acc acc_zero() noexcept { return _mm256_setzero_ps(); }
+    FWD_SIMD_AVX2 static acc acc_add(acc total, reg v) noexcept { return _mm256_add_ps(total, v); }
+    FWD_SIMD_AVX2 static float acc_total(acc total) noexcept {
+        alignas(32) float parts[8];
+        _mm256_store_ps(parts, total);
+        return ((parts[0] + parts[1]) + (parts[2] + parts[3])) + ((parts[4] + parts[5]) + (parts[6] + parts[7]));
+    }
+};
+
+template<>
+struct simd_avx2_ops<double> {
+    using value_type = double;
+    using reg = __m256d;
+    using acc = __m256d;
+    static constexpr size_t lanes = 4;
+
+    FWD_SIMD_AVX2 static reg load(const double* p) noexcept { return _mm256_loadu_pd(p); }
+    FWD_SIMD_AVX2 static void store(double* p, reg v) noexcept { _mm256_storeu_pd(p, v); }
+    FWD_SIMD_AVX2 static reg set1(double v) noexcept { return _mm256_set1_pd(v); }
+    FWD_SIMD_AVX2 static reg eq(reg a, reg b) noexcept { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+    FWD_SIMD_AVX2 static unsigned bits(reg mask) noexcept { return static_cast<unsigned>(_mm256_movemask_pd(mask)); }
+    FWD_SIMD_AVX2 static reg select(reg mask, reg a, reg b) noexcept { return _mm256_blendv_pd(b, a, mask); }
+    FWD_SIMD_AVX2 static reg min(reg a, reg b) noexcept { return _mm256_min_pd(a, b); }
+    FWD_SIMD_AVX2 static reg max(reg a, reg b) noexcept { return _mm256_max_pd(a, b); }
+    FWD_SIMD_AVX2 static acc acc_zero() noexcept { return _mm256_setzero_pd(); }
+    FWD_SIMD_AVX2 static acc acc_add(acc total, reg v) noexcept { return _mm256_add_pd(total, v); }
+    FWD_SIMD_AVX2 static double acc_total(acc total) noexcept {
+        alignas(32) double parts[4];
+        _mm256_store_pd(parts, total);
+        return (parts[0] + parts[1]) + (parts[2] + parts[3]);
+    }
+};
+
+/**
+ * @brief Kernels written once against the operations of simd_sse2_ops / simd_avx2_ops
+ * @tparam Ops Vector operations for one element type and instruction set
+ *
+ * Force-inlined into a caller compiled for the matching instruction set (see
+ * simd_avx2_kernels), so the AVX2 instantiation is emitted as AVX2 code even though
+ * the translation unit is not built with -mavx2. Tails shorter than a vector go
+ * through simd_scalar_kernels.
+ */
+template<typename Ops>
+struct simd_vector_kernels {
+    using T = typename Ops::value_type;
+    using reg = typename Ops::reg;
+    static constexpr size_t lanes = Ops::lanes;
+
+    FWD_SIMD_INLINE static const T* find(const T* first, const T* last, T value) noexcept {
+        const reg needle = Ops::set1(value);
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            const unsigned hits = Ops::bits(Ops::eq(Ops::load(first), needle));
+            if (hits != 0) return first + __builtin_ctz(hits);
+        }
+        return simd_scalar_kernels<T>::find(first, last, value);
+    }
+
+    FWD_SIMD_INLINE static const T* find_last(const T* first, const T* last, T value) noexcept {
+        const reg needle = Ops::set1(value);
+        const T* p = last;
+        for (; static_cast<size_t>(p - first) >= lanes;) {
+            p -= lanes;
+            const unsigned hits = Ops::bits(Ops::eq(Ops::load(p), needle));
+            if (hits != 0) return p + (31 - __builtin_clz(hits));
+        }
+        const T* found = simd_scalar_kernels<T>::find_last(first, p, value);
+        return found != p ? found : last;
+    }
+
+    FWD_SIMD_INLINE static size_t count(const T* first, const T* last, T value) noexcept {
+        const reg needle = Ops::set1(value);
+        size_t total = 0;
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            total += static_cast<size_t>(__builtin_popcount(Ops::bits(Ops::eq(Ops::load(first), needle))));
+        }
+        return total + simd_scalar_kernels<T>::count(first, last, value);
+    }
+
+    FWD_SIMD_INLINE static simd_sum_t<T> sum(const T* first, const T* last) noexcept {
+        typename Ops::acc total = Ops::acc_zero();
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            total = Ops::acc_add(total, Ops::load(first));
+        }
+        return Ops::acc_total(total) + simd_scalar_kernels<T>::sum(first, last);
+    }
+
+    template<bool Largest>
+    FWD_SIMD_INLINE static T extreme(const T* first, const T* last) noexcept {
+        if (static_cast<size_t>(last - first) < lanes) {
+            return Largest ? simd_scalar_kernels<T>::max(first, last) : simd_scalar_kernels<T>::min(first, last);
+        }
+
+        reg best = Ops::load(first);
+        const T* p = first + lanes;
+        for (; static_cast<size_t>(last - p) >= lanes; p += lanes) {
+            best = Largest ? Ops::max(best, Ops::load(p)) : Ops::min(best, Ops::load(p));
+        }
+        // min and max tolerate seeing an element twice, so the tail is one overlapping vector
+        if (p != last) {
+            best = Largest ? Ops::max(best, Ops::load(last - lanes)) : Ops::min(best, Ops::load(last - lanes));
+        }
+
+        T parts[lanes];
+        Ops::store(parts, best);
+        return Largest ? simd_scalar_kernels<T>::max(parts, parts + lanes) : simd_scalar_kernels<T>::min(parts, parts + lanes);
+    }
+
+    FWD_SIMD_INLINE static size_t replace(T* first, T* last, T old_value, T new_value) noexcept {
+        const reg from = Ops::set1(old_value);
+        const reg to = Ops::set1(new_value);
+        size_t replaced = 0;
+        for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+            const reg v = Ops::load(first);
+            const reg mask = Ops::eq(v, from);
+            const unsigned hits = Ops::bits(mask);
+            if (hits != 0) {
+                Ops::store(first, Ops::select(mask, to, v));
+                replaced += static_cast<size_t>(__builtin_popcount(hits));
+            }
+        }
+        return replaced + simd_scalar_kernels<T>::replace(first, last, old_value, new_value);
+    }
+};
+
+/**
+ * @brief Entry points compiled for AVX2 that instantiate simd_vector_kernels with simd_avx2_ops
+ * @tparam T Element type (int, float or double)
+ */
+template<typename T>
+struct simd_avx2_kernels {
+    using kernels = simd_vector_kernels<simd_avx2_ops<T>>;
+
+    FWD_SIMD_AVX2 static const T* find(const T* first, const T* last, T value) noexcept { return kernels::find(first, last, value); }
+    FWD_SIMD_AVX2 static const T* find_last(const T* first, const T* last, T value) noexcept { return kernels::find_last(first, last, value); }
+    FWD_SIMD_AVX2 static size_t count(const T* first, const T* last, T value) noexcept { return kernels::count(first, last, value); }
+    FWD_SIMD_AVX2 static simd_sum_t<T> sum(const T* first, const T* last) noexcept { return kernels::sum(first, last); }
+    FWD_SIMD_AVX2 static T min(const T* first, const T* last) noexcept { return kernels::template extreme<false>(first, last); }
+    FWD_SIMD_AVX2 static T max(const T* first, const T* last) noexcept { return kernels::template extreme<true>(first, last); }
+    FWD_SIMD_AVX2 static size_t replace(T* first, T* last, T old_value, T new_value) noexcept {
+        return kernels::replace(first, last, old_value, new_value);
+    }
+};
+
+/**
+ * @brief Entry points for SSE2, the x86-64 baseline, so they need no target attribute
+ * @tparam T Element type (int, float or double)
+ */
+template<typename T>
+struct simd_sse2_kernels {
+    using kernels = simd_vector_kernels<simd_sse2_ops<T>>;
+
+    static const T* find(const T* first, const T* last, T value) noexcept { return kernels::find(first, last, value); }
+    static const T* find_last(const T* first, const T* last, T value) noexcept { return kernels::find_last(first, last, value); }
+    static size_t count(const T* first, const T* last, T value) noexcept { return kernels::count(first, last, value); }
+    static simd_sum_t<T> sum(const T* first, const T* last) noexcept { return kernels::sum(first, last); }
+    static T min(const T* first, const T* last) noexcept { return kernels::template extreme<false>(first, last); }
+    static T max(const T* first, const T* last) noexcept { return kernels::template extreme<true>(first, last); }
+    static size_t replace(T* first, T* last, T old_value, T new_value) noexcept {
+        return kernels::replace(first, last, old_value, new_value);
+    }
+};
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+// Pick the kernel set for T and level; non-vectorizable types always use the scalar loops
+#define FWD_SIMD_DISPATCH(T, level, call)                                          \
+    do {                                                                           \
+        if constexpr (is_simd_arithmetic_v<T>) {                                   \
+            if ((level) == simd_level::avx2) return simd_avx2_kernels<T>::call;    \
+            if ((level) == simd_level::sse2) return simd_sse2_kernels<T>::call;    \
+        }                                                                          \
+        return simd_scalar_kernels<T>::call;                                       \
+    } while (false)
+
+#else
+
+#define FWD_SIMD_DISPATCH(T, level, call) \
+    do {                                  \
+        (void)(level);                    \
+        return simd_scalar_kernels<T>::call; \
+    } while (false)
+
+#endif
+
+// Level selection
+inline simd_level fwd_simd::detected_level() noexcept {
+#if FWD_SIMD_X86
+    static const simd_level level = __builtin_cpu_supports("avx2") ? simd_level::avx2 : simd_level::sse2;
+    return level;
+#else
+    return simd_level::scalar;
+#endif
+}
+
+inline simd_level fwd_simd::usable(simd_level level) noexcept {
+    const simd_level detected = detected_level();
+    return level > detected ? detected : level;
+}
+
+// Range kernels
+template<typename T, typename U>
+const T* fwd_simd::find(const T* first, const T* last, const U& value, simd_level level) {
+    level = usable(level);
+    FWD_SIMD_DISPATCH(T, level, find(first, last, static_cast<T>(value)));
+}
+
+template<typename T, typename U>
+const T* fwd_simd::find_last(const T* first, const T* last, const U& value, simd_level level) {
+    level = usable(level);
+    FWD_SIMD_DISPATCH(T, level, find_last(first, last, static_cast<T>(value)));
+}
+
+template<typename T, typename U>
+size_t fwd_simd::count(const T* first, const T* last, const U& value, simd_level level) {
+    level = usable(level);
+    FWD_SIMD_DISPATCH(T, level, count(first, last, static_cast<T>(value)));
+}
+
+template<typename T>
+simd_sum_t<T> fwd_simd::sum(const T* first, const T* last, simd_level level) {
+    level = usable(level);
+    FWD_SIMD_DISPATCH(T, level, sum(first, last));
+}
+
+template<typename T>
+T fwd_simd::min(const T* first, const T* last, simd_level level) {
+    if (first == last) throw std::runtime_error("Cannot compute min: range is empty");
+    level = usable(level);
+    FWD_SIMD_DISPATCH(T, level, min(first, last));
+}
+
+template<typename T>
+T fwd_simd::max(const T* first, const T* last, simd_level level) {
+    if (first == last) throw std::runtime_error("Cannot compute max: range is empty");
+    level = usable(level);
+    FWD_SIMD_DISPATCH(T, level, max(first, last));
+}
+
+template<typename T, typename U, typename V>
+size_t fwd_simd::replace(T* first, T* last, const U& old_value, const V& new_value, simd_level level) {
+    level = usable(level);
+    FWD_SIMD_DISPATCH(T, level, replace(first, last, static_cast<T>(old_value), static_cast<T>(new_value)));
+}
+
+#undef FWD_SIMD_DISPATCH
+
+// Container versions
+template<typename C, typename U>
+auto fwd_simd::find(C& container, const U& value)
+    -> std::conditional_t<std::is_const_v<C>, const forward_container_value_t<C>*, forward_container_value_t<C>*> {
+    using T = forward_container_value_t<C>;
+    using result = std::conditional_t<std::is_const_v<C>, const T*, T*>;
+
+    // Converted once, so span and node storage compare against the same value
+    const T needle = static_cast<T>(value);
+    result found = nullptr;
+    if constexpr (has_for_each_span_v<std::remove_const_t<C>>) {
+        container.for_each_span([&found, needle](auto* first, auto* last) {
+            // Spans of a stack run against iteration order, so its first match is the last in memory
+            const T* hit = std::remove_const_t<C>::reversed_spans ? find_last(first, last, needle) : find(first, last, needle);
+            if (hit == last) return true;
+            found = first + (hit - first);
+            return false;
+        });
+    } else {
+        for (auto& element : container) {
+            if (element == needle) {
+                found = &element;
+                break;
+            }
+        }
+    }
+    return found;
+}
+
+template<typename C, typename U>
+size_t fwd_simd::count(const C& container, const U& value) {
+    using T = forward_container_value_t<C>;
+
+    const T needle = static_cast<T>(value);
+    size_t total = 0;
+    if constexpr (has_for_each_span_v<C>) {
+        container.for_each_span([&total, needle](const T* first, const T* last) {
+            total += count(first, last, needle);
+            return true;
+        });
+    } else {
+        for (const T& element : container) {
+            if (element == needle) ++total;
+        }
+    }
+    return total;
+}
+
+template<typename C>
+simd_sum_t<forward_container_value_t<C>> fwd_simd::sum(const C& container) {
+    using T = forward_container_value_t<C>;
+
+    simd_sum_t<T> total = simd_sum_t<T>();
+    if constexpr (has_for_each_span_v<C>) {
+        container.for_each_span([&total](const T* first, const T* last) {
+            total += sum(first, last);
+            return true;
+        });
+    } else {
+        for (const T& element : container) total += element;
+    }
+    return total;
+}
+
+template<bool Largest, typename C>
+forward_container_value_t<C> fwd_simd::extreme(const C& container) {
+    using T = forward_container_value_t<C>;
+
+    if (container.is_empty()) {
+        throw std::runtime_error(Largest ? "Cannot compute max: container is empty" : "Cannot compute min: container is empty");
+    }
+
+    bool seen = false;
+    T bestValue = T();
+    auto consider = [&seen, &bestValue](const T& candidate) {
+        if (!seen || (Largest ? bestValue < candidate : candidate < bestValue)) {
+            bestValue = candidate;
+        }
+        seen = true;
+    };
+
+    if constexpr (has_for_each_span_v<C>) {
+        container.for_each_span([&consider](const T* first, const T* last) {
+            if (first != last) consider(Largest ? max(first, last) : min(first, last));
+            return true;
+        });
+    } else {
+        for (const T& element : container) consider(element);
+    }
+    return bestValue;
+}
+
+template<typename C>
+forward_container_value_t<C> fwd_simd::min(const C& container) {
+    return extreme<false>(container);
+}
+
+template<typename C>
+forward_container_value_t<C> fwd_simd::max(const C& container) {
+    return extreme<true>(container);
+}
+
+template<typename C, typename U, typename V>
+size_t fwd_simd::replace(C& container, const U& old_value, const V& new_value) {
+    using T = forward_container_value_t<C>;
+
+    const T from = static_cast<T>(old_value);
+    const T to = static_cast<T>(new_value);
+    size_t replaced = 0;
+    if constexpr (has_for_each_span_v<C>) {
+        container.for_each_span([&replaced, from, to](T* first, T* last) {
+            replaced += replace(first, last, from, to);
+            return true;
+        });
+    } else {
+        for (T& element : container) {
+            if (element == from) {
+                element = to;
+                ++replaced;
+            }
+        }
+    }
+    return replaced;
+}
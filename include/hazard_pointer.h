@@ -0,0 +1,117 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Hazard pointer domain for safe memory reclamation in lock-free containers
+ * @tparam NodeT Node type protected and reclaimed by the domain
+ * @tparam Reclaim Callable invoked as reclaim(NodeT*) once a retired node is no longer protected
+ *
+ * A thread that is about to dereference a shared node publishes its address through a
+ * guard. Unlinked nodes are retired through a guard rather than freed, and are only
+ * handed to the reclaimer once no guard publishes them. Each hazard slot keeps its own
+ * list of retired nodes, touched only by the guard that currently owns the slot, so
+ * nodes need no extra link field and retiring needs no synchronization. Guards may be
+ * used from any number of threads; the domain itself must outlive every guard and is
+ * destroyed when no thread uses it.
+ */
+template<typename NodeT, typename Reclaim>
+class HazardDomain {
+private:
+    struct record {
+        std::atomic<const void*> hazard{nullptr}; ///< Published address (nullptr if none)
+        std::atomic<bool> active{false};          ///< True while a guard owns this record
+        record* next = nullptr;                   ///< Next record in the domain list
+        std::vector<NodeT*> retired;              ///< Nodes retired through this record (owner only)
+    };
+
+public:
+    /**
+     * @brief Scoped owner of one hazard slot
+     *
+     * Acquires a free record from the domain on construction and gives it back on
+     * destruction. A guard protects at most one node at a time.
+     */
+    class guard {
+    public:
+        /**
+         * @brief Acquires a hazard slot from the domain
+         * @param domain Domain to take the slot from
+         */
+        explicit guard(HazardDomain& domain);
+
+        guard(const guard&) = delete;
+        guard& operator=(const guard&) = delete;
+
+        /**
+         * @brief Clears the published address and returns the slot to the domain
+         */
+        ~guard();
+
+        /**
+         * @brief Loads a shared pointer and publishes it until the next protect() or reset()
+         * @param source Atomic pointer to read
+         * @return Value of source that is guaranteed not to be reclaimed while published
+         */
+        NodeT* protect(const std::atomic<NodeT*>& source) noexcept;
+
+        /**
+         * @brief Stops protecting the current node
+         */
+        void reset() noexcept;
+
+        /**
+         * @brief Hands an unlinked node to the domain for deferred reclamation
+         * @param node Node that is no longer reachable from the shared structure
+         */
+        void retire(NodeT* node) noexcept;
+
+    private:
+        HazardDomain& owner; ///< Domain the slot belongs to
+        record* slot;        ///< Record owned by this guard
+    };
+
+    /**
+     * @brief Creates an empty domain
+     * @param reclaim Callable used to free nodes that are safe to reclaim
+     */
+    explicit HazardDomain(Reclaim reclaim);
+
+    HazardDomain(const HazardDomain&) = delete;
+    HazardDomain& operator=(const HazardDomain&) = delete;
+
+    /**
+     * @brief Reclaims every node still retired and frees all records
+     *
+     * No guard may be alive when the domain is destroyed.
+     */
+    ~HazardDomain();
+
+    /**
+     * @brief Checks whether any guard currently publishes the given address
+     * @param p Address to look for
+     * @return True if p is protected at the moment of the call
+     */
+    bool is_protected(const void* p) const noexcept;
+
+    /**
+     * @brief Returns the number of retired nodes waiting for reclamation
+     * @return Approximate count of pending nodes
+     */
+    size_t retired_count() const noexcept;
+
+private:
+    static constexpr size_t min_scan_threshold = 64; ///< Retired nodes per slot tolerated before a scan
+
+    record* acquire_record();
+    std::vector<const void*> protected_snapshot() const;
+    void scan(record* slot) noexcept;
+
+    std::atomic<record*> records;     ///< Lock-free list of hazard records (never shrinks)
+    std::atomic<size_t> recordCount;  ///< Number of records in the list
+    std::atomic<size_t> retiredTotal; ///< Number of retired nodes across all records
+    Reclaim reclaimer;                ///< Frees nodes that are safe to reclaim
+};
+
+#include "hazard_pointer.ipp"
@@ -0,0 +1,132 @@
+#include "hazard_pointer.h"
+#include <algorithm>
+#include <vector>
+
+// Guard
+template<typename NodeT, typename Reclaim>
+HazardDomain<NodeT, Reclaim>::guard::guard(HazardDomain& domain) : owner(domain), slot(domain.acquire_record()) {}
+
+template<typename NodeT, typename Reclaim>
+HazardDomain<NodeT, Reclaim>::guard::~guard() {
+    slot->hazard.store(nullptr, std::memory_order_release);
+    slot->active.store(false, std::memory_order_release);
+}
+
+template<typename NodeT, typename Reclaim>
+NodeT* HazardDomain<NodeT, Reclaim>::guard::protect(const std::atomic<NodeT*>& source) noexcept {
+    NodeT* p = source.load(std::memory_order_relaxed);
+    while (true) {
+        slot->hazard.store(p, std::memory_order_seq_cst);
+        // Re-read: if source still holds p, p was reachable after it was published
+        NodeT* again = source.load(std::memory_order_seq_cst);
+        if (again == p) return p;
+        p = again;
+    }
+}
+
+template<typename NodeT, typename Reclaim>
+void HazardDomain<NodeT, Reclaim>::guard::reset() noexcept {
+    slot->hazard.store(nullptr, std::memory_order_release);
+}
+
+template<typename NodeT, typename Reclaim>
+void HazardDomain<NodeT, Reclaim>::guard::retire(NodeT* node) noexcept {
+    try {
+        slot->retired.push_back(node);
+    }
+    catch (...) {
+        // No room to defer it: wait until nobody publishes the node and reclaim it now
+        while (owner.is_protected(node)) {}
+        owner.reclaimer(node);
+        return;
+    }
+    owner.retiredTotal.fetch_add(1, std::memory_order_relaxed);
+
+    size_t threshold = 2 * owner.recordCount.load(std::memory_order_relaxed);
+    if (threshold < min_scan_threshold) threshold = min_scan_threshold;
+    if (slot->retired.size() >= threshold) owner.scan(slot);
+}
+
+// Domain
+template<typename NodeT, typename Reclaim>
+HazardDomain<NodeT, Reclaim>::HazardDomain(Reclaim reclaim)
+    : records(nullptr), recordCount(0), retiredTotal(0), reclaimer(std::move(reclaim)) {}
+
+template<typename NodeT, typename Reclaim>
+HazardDomain<NodeT, Reclaim>::~HazardDomain() {
+    record* r = records.load(std::memory_order_acquire);
+    while (r != nullptr) {
+        record* next = r->next;
+        for (NodeT* node : r->retired) reclaimer(node);
+        delete r;
+        r = next;
+    }
+}
+
+template<typename NodeT, typename Reclaim>
+auto HazardDomain<NodeT, Reclaim>::acquire_record() -> record* {
+    for (record* r = records.load(std::memory_order_acquire); r != nullptr; r = r->next) {
+        if (!r->active.load(std::memory_order_relaxed) &&
+            !r->active.exchange(true, std::memory_order_acquire)) {
+            return r;
+        }
+    }
+
+    record* fresh = new record;
+    fresh->active.store(true, std::memory_order_relaxed);
+    record* head = records.load(std::memory_order_relaxed);
+    do {
+        fresh->next = head;
+    } while (!records.compare_exchange_weak(head, fresh, std::memory_order_release, std::memory_order_relaxed));
+    recordCount.fetch_add(1, std::memory_order_relaxed);
+    return fresh;
+}
+
+template<typename NodeT, typename Reclaim>
+bool HazardDomain<NodeT, Reclaim>::is_protected(const void* p) const noexcept {
+    for (record* r = records.load(std::memory_order_acquire); r != nullptr; r = r->next) {
+        if (r->hazard.load(std::memory_order_seq_cst) == p) return true;
+    }
+    return false;
+}
+
+template<typename NodeT, typename Reclaim>
+std::vector<const void*> HazardDomain<NodeT, Reclaim>::protected_snapshot() const {
+    std::vector<const void*> hazards;
+    hazards.reserve(recordCount.load(std::memory_order_relaxed));
+    for (record* r = records.load(std::memory_order_acquire); r != nullptr; r = r->next) {
+        const void* h = r->hazard.load(std::memory_order_seq_cst);
+        if (h != nullptr) hazards.push_back(h);
+    }
+    std::sort(hazards.begin(), hazards.end());
+    return hazards;
+}
+
+template<typename NodeT, typename Reclaim>
+void HazardDomain<NodeT, Reclaim>::scan(record* slot) noexcept {
+    std::vector<const void*> hazards;
+    try {
+        hazards = protected_snapshot();
+    }
+    catch (...) {
+        // Cannot tell which nodes are safe; try again on a later retire
+        return;
+    }
+
+    std::vector<NodeT*>& retired = slot->retired;
+    size_t kept = 0;
+    for (size_t i = 0; i < retired.size(); ++i) {
+        if (std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(retired[i]))) {
+            retired[kept++] = retired[i];
+        } else {
+            reclaimer(retired[i]);
+        }
+    }
+    retiredTotal.fetch_sub(retired.size() - kept, std::memory_order_relaxed);
+    retired.resize(kept);
+}
+
+template<typename NodeT, typename Reclaim>
+size_t HazardDomain<NodeT, Reclaim>::retired_count() const noexcept {
+    return retiredTotal.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,296 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+/**
+ * @brief Log2 histogram of operation latencies in nanoseconds
+ *
+ * Bucket 0 counts samples below 2 ns, bucket i samples in [2^i, 2^(i+1)) ns and the
+ * last bucket everything from 2^(bucket_count - 1) ns up.
+ */
+struct LatencyHistogram {
+    static constexpr size_t bucket_count = 32; ///< Number of buckets
+
+    std::array<uint64_t, bucket_count> buckets{}; ///< Sample count per bucket
+
+    /**
+     * @brief Bucket a latency falls into
+     * @param nanoseconds Measured latency
+     * @return Bucket index in [0, bucket_count)
+     */
+    static constexpr size_t bucket_of(uint64_t nanoseconds) noexcept {
+        size_t bucket = 0;
+        while (nanoseconds > 1 && bucket + 1 < bucket_count) {
+            nanoseconds >>= 1;
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    /**
+     * @brief Total number of samples
+     * @return Sum of all buckets
+     */
+    uint64_t samples() const noexcept {
+        uint64_t total = 0;
+        for (uint64_t count : buckets) total += count;
+        return total;
+    }
+};
+
+/**
+ * @brief Snapshot of the counters kept by an instrumented Stack or Queue
+ *
+ * pushes and pops count elements inserted and removed through the element operations
+ * (push, emplace, push_range, read, load and pop, try_pop, pop_n, drain_into); copies,
+ * splices and clear() change the size without counting as either. The node counters
+ * cover the nodes this container allocated and freed itself, so nodes adopted by a
+ * move or splice show up only as frees.
+ */
+struct ContainerStats {
+    uint64_t pushes = 0;           ///< Elements inserted
+    uint64_t pops = 0;             ///< Elements removed
+    uint64_t node_allocations = 0; ///< Nodes allocated
+    uint64_t node_frees = 0;       ///< Nodes freed
+    size_t peak_size = 0;          ///< Largest size() observed
+    LatencyHistogram push_latency; ///< Sampled single push/emplace latencies (empty unless sampling)
+    LatencyHistogram pop_latency;  ///< Sampled single pop/try_pop latencies (empty unless sampling)
+};
+
+/**
+ * @brief Instrumentation policy that records nothing (the default)
+ *
+ * Every hook is an empty inline function and the policy is an empty base of the
+ * container, so an uninstrumented Stack or Queue has the same size and code as one
+ * without the policy parameter. A custom policy provides the same members.
+ */
+struct Uninstrumented {
+    static constexpr bool enabled = false; ///< Whether stats() is available
+
+    /**
+     * @brief Start of a latency measurement (empty: nothing is measured)
+     */
+    struct sample {};
+
+    /**
+     * @brief Called before a single push or emplace
+     * @return Token passed back to record_push
+     */
+    sample begin_push() noexcept { return {}; }
+
+    /**
+     * @brief Called before a single pop or try_pop of a non-empty container
+     * @return Token passed back to record_pop
+     */
+    sample begin_pop() noexcept { return {}; }
+
+    /**
+     * @brief Called after elements were inserted
+     * @param count Number of elements inserted
+     * @param size Container size afterwards
+     * @param started Token from begin_push, for single pushes
+     */
+    void record_push(size_t count, size_t size, const sample& started = sample()) noexcept {
+        (void)count; (void)size; (void)started;
+    }
+
+    /**
+     * @brief Called after elements were removed
+     * @param count Number of elements removed
+     * @param started Token from begin_pop, for single pops
+     */
+    void record_pop(size_t count, const sample& started = sample()) noexcept {
+        (void)count; (void)started;
+    }
+
+    /**
+     * @brief Called after the size grew other than by pushing (copy, move, splice)
+     * @param size Container size afterwards
+     */
+    void record_size(size_t size) noexcept { (void)size; }
+
+    /**
+     * @brief Called after nodes were allocated
+     * @param count Number of nodes
+     */
+    void record_allocations(size_t count) noexcept { (void)count; }
+
+    /**
+     * @brief Called after nodes were freed
+     * @param count Number of nodes
+     */
+    void record_frees(size_t count) noexcept { (void)count; }
+};
+
+/**
+ * @brief Instrumentation policy counting operations, node traffic and peak size
+ * @tparam LatencySampleRate Time one in this many single pushes and pops (0: no timing)
+ *
+ * Used as the last template parameter: Queue<T, std::allocator<T>, Instrumented<64>>.
+ * Counters are written only by the thread using the container, with plain loads and
+ * stores (no read-modify-write), so another thread may call stats() at any time for
+ * export; each field of the snapshot is then exact but the fields may be from slightly
+ * different moments. Sampled operations read std::chrono::steady_clock twice.
+ *
+ * Counters belong to the container object: copies and moves start from zero and
+ * assignment keeps the target's counters.
+ */
+template<size_t LatencySampleRate = 0>
+class Instrumented {
+public:
+    static constexpr bool enabled = true; ///< Whether stats() is available
+
+    /**
+     * @brief Start of a latency measurement
+     */
+    struct sample {
+        std::chrono::steady_clock::time_point start; ///< Clock reading before the operation
+        bool timed = false;                          ///< False if this operation is not sampled
+    };
+
+    Instrumented() = default;
+    Instrumented(const Instrumented&) noexcept {}
+    Instrumented& operator=(const Instrumented&) noexcept { return *this; }
+
+    /**
+     * @brief Called before a single push or emplace
+     * @return Token passed back to record_push (timed for one in LatencySampleRate calls)
+     */
+    sample begin_push() noexcept { return begin(pushTicks); }
+
+    /**
+     * @brief Called before a single pop or try_pop of a non-empty container
+     * @return Token passed back to record_pop (timed for one in LatencySampleRate calls)
+     */
+    sample begin_pop() noexcept { return begin(popTicks); }
+
+    /**
+     * @brief Called after elements were inserted
+     * @param count Number of elements inserted
+     * @param size Container size afterwards
+     * @param started Token from begin_push, for single pushes
+     */
+    void record_push(size_t count, size_t size, const sample& started = sample()) noexcept {
+        add(pushes, count);
+        record_size(size);
+        finish(pushLatency, started);
+    }
+
+    /**
+     * @brief Called after elements were removed
+     * @param count Number of elements removed
+     * @param started Token from begin_pop, for single pops
+     */
+    void record_pop(size_t count, const sample& started = sample()) noexcept {
+        add(pops, count);
+        finish(popLatency, started);
+    }
+
+    /**
+     * @brief Called after the size grew other than by pushing (copy, move, splice)
+     * @param size Container size afterwards
+     */
+    void record_size(size_t size) noexcept {
+        if (size > peakSize.load(std::memory_order_relaxed)) peakSize.store(size, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Called after nodes were allocated
+     * @param count Number of nodes
+     */
+    void record_allocations(size_t count) noexcept { add(nodeAllocations, count); }
+
+    /**
+     * @brief Called after nodes were freed
+     * @param count Number of nodes
+     */
+    void record_frees(size_t count) noexcept { add(nodeFrees, count); }
+
+    /**
+     * @brief Copy of the current counters
+     * @return Snapshot of every counter and histogram
+     */
+    ContainerStats snapshot() const noexcept {
+        ContainerStats stats;
+        stats.pushes = pushes.load(std::memory_order_relaxed);
+        stats.pops = pops.load(std::memory_order_relaxed);
+        stats.node_allocations = nodeAllocations.load(std::memory_order_relaxed);
+        stats.node_frees = nodeFrees.load(std::memory_order_relaxed);
+        stats.peak_size = peakSize.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < LatencyHistogram::bucket_count; ++i) {
+            stats.push_latency.buckets[i] = pushLatency[i].load(std::memory_order_relaxed);
+            stats.pop_latency.buckets[i] = popLatency[i].load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    /**
+     * @brief Set every counter back to zero (from the thread using the container)
+     * @param size Current container size, the new peak
+     */
+    void reset(size_t size) noexcept {
+        for (std::atomic<uint64_t>* counter : {&pushes, &pops, &nodeAllocations, &nodeFrees}) {
+            counter->store(0, std::memory_order_relaxed);
+        }
+        peakSize.store(size, std::memory_order_relaxed);
+        for (size_t i = 0; i < LatencyHistogram::bucket_count; ++i) {
+            pushLatency[i].store(0, std::memory_order_relaxed);
+            popLatency[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    using buckets = std::array<std::atomic<uint64_t>, LatencyHistogram::bucket_count>;
+
+    /**
+     * @brief Add to a counter only this thread writes
+     * @param counter Counter to update
+     * @param count Amount to add
+     */
+    static void add(std::atomic<uint64_t>& counter, uint64_t count) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Read the clock if this operation is sampled
+     * @param ticks Operations of this kind so far
+     * @return Timed token for every LatencySampleRate-th operation, untimed otherwise
+     */
+    sample begin(size_t& ticks) noexcept {
+        if constexpr (LatencySampleRate > 0) {
+            if (++ticks == LatencySampleRate) {
+                ticks = 0;
+                return sample{std::chrono::steady_clock::now(), true};
+            }
+        }
+        return sample{};
+    }
+
+    /**
+     * @brief Record the latency of a timed operation
+     * @param histogram Histogram of the operation kind
+     * @param started Token from begin; untimed tokens are ignored
+     */
+    static void finish(buckets& histogram, const sample& started) noexcept {
+        if constexpr (LatencySampleRate > 0) {
+            if (!started.timed) return;
+            auto elapsed = std::chrono::steady_clock::now() - started.start;
+            uint64_t ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            add(histogram[LatencyHistogram::bucket_of(ns)], 1);
+        }
+    }
+
+    std::atomic<uint64_t> pushes{0};          ///< Elements inserted
+    std::atomic<uint64_t> pops{0};            ///< Elements removed
+    std::atomic<uint64_t> nodeAllocations{0}; ///< Nodes allocated
+    std::atomic<uint64_t> nodeFrees{0};       ///< Nodes freed
+    std::atomic<size_t> peakSize{0};          ///< Largest size observed
+    buckets pushLatency{};                    ///< Sampled push latencies
+    buckets popLatency{};                     ///< Sampled pop latencies
+    size_t pushTicks = 0;                     ///< Pushes since the last timed one
+    size_t popTicks = 0;                      ///< Pops since the last timed one
+};
@@ -0,0 +1,212 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+
+/**
+ * @brief Link embedded in a user type so it can sit in an IntrusiveStack or IntrusiveQueue
+ * @tparam T Type that contains the hook
+ *
+ * The link is only meaningful while the object is in a container; linking always
+ * overwrites it, so the hook needs no cleanup when the object leaves. An object can be
+ * in as many intrusive containers at once as it has hooks. Copying an object never
+ * copies its link, so copies made by pop() or assigned over a linked object leave
+ * every container intact.
+ */
+template<typename T>
+struct IntrusiveHook {
+    T* next; ///< Next object in the container this hook is linked into
+
+    /**
+     * @brief Creates an unlinked hook
+     */
+    IntrusiveHook() noexcept : next(nullptr) {}
+
+    /**
+     * @brief Copying an object yields an unlinked hook
+     */
+    IntrusiveHook(const IntrusiveHook&) noexcept : next(nullptr) {}
+
+    /**
+     * @brief Assigning to an object keeps its own link
+     * @return Reference to this hook
+     */
+    IntrusiveHook& operator=(const IntrusiveHook&) noexcept { return *this; }
+};
+
+/**
+ * @brief Iterator over a chain of objects linked through an IntrusiveHook (non-const version)
+ * @tparam T Element type
+ * @tparam Hook Pointer to the hook member of T
+ *
+ * Shared by IntrusiveStack and IntrusiveQueue; both walk the chain in pop() order.
+ */
+template<typename T, IntrusiveHook<T> T::*Hook>
+class intrusive_iterator {
+private:
+    T* current; ///< Current object (nullptr at the end)
+
+public:
+    using difference_type   = ptrdiff_t;
+    using value_type        = T;
+    using pointer           = T*;
+    using reference         = T&;
+    using iterator_category = std::forward_iterator_tag;
+
+    /**
+     * @brief Constructor
+     * @param element Starting object for iteration (default: nullptr)
+     */
+    intrusive_iterator(T* element = nullptr) : current(element) {}
+
+    /**
+     * @brief Dereference operator
+     * @return Reference to the current object
+     */
+    T& operator*() const {
+        return *current;
+    }
+
+    /**
+     * @brief Member access operator
+     * @return Pointer to the current object
+     */
+    T* operator->() const {
+        return current;
+    }
+
+    /**
+     * @brief Prefix increment operator
+     * @return Reference to this iterator
+     */
+    intrusive_iterator& operator++() {
+        current = (current->*Hook).next;
+        return *this;
+    }
+
+    /**
+     * @brief Postfix increment operator
+     * @return Copy of iterator before increment
+     */
+    intrusive_iterator operator++(int) {
+        intrusive_iterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    /**
+     * @brief Equality comparison
+     * @param lhs First iterator
+     * @param rhs Second iterator
+     * @return True if both iterators point to the same object
+     */
+    friend bool operator==(const intrusive_iterator& lhs, const intrusive_iterator& rhs) {
+        return lhs.current == rhs.current;
+    }
+
+    /**
+     * @brief Inequality comparison
+     * @param lhs First iterator
+     * @param rhs Second iterator
+     * @return True if iterators point to different objects
+     */
+    friend bool operator!=(const intrusive_iterator& lhs, const intrusive_iterator& rhs) {
+        return !(lhs == rhs);
+    }
+
+    /**
+     * @brief Get the current object
+     * @return Pointer to the current object
+     */
+    T* get_element() const { return current; }
+};
+
+/**
+ * @brief Iterator over a chain of objects linked through an IntrusiveHook (const version)
+ * @tparam T Element type
+ * @tparam Hook Pointer to the hook member of T
+ */
+template<typename T, IntrusiveHook<T> T::*Hook>
+class intrusive_const_iterator {
+private:
+    const T* current; ///< Current object (nullptr at the end)
+
+public:
+    using difference_type   = ptrdiff_t;
+    using value_type        = T;
+    using pointer           = const T*;
+    using reference         = const T&;
+    using iterator_category = std::forward_iterator_tag;
+
+    /**
+     * @brief Constructor
+     * @param element Starting object for iteration (default: nullptr)
+     */
+    intrusive_const_iterator(const T* element = nullptr) : current(element) {}
+
+    /**
+     * @brief Constructor from non-const iterator
+     * @param other Iterator to convert from
+     */
+    intrusive_const_iterator(const intrusive_iterator<T, Hook>& other) : current(other.get_element()) {}
+
+    /**
+     * @brief Dereference operator
+     * @return Const reference to the current object
+     */
+    const T& operator*() const {
+        return *current;
+    }
+
+    /**
+     * @brief Member access operator
+     * @return Const pointer to the current object
+     */
+    const T* operator->() const {
+        return current;
+    }
+
+    /**
+     * @brief Prefix increment operator
+     * @return Reference to this iterator
+     */
+    intrusive_const_iterator& operator++() {
+        current = (current->*Hook).next;
+        return *this;
+    }
+
+    /**
+     * @brief Postfix increment operator
+     * @return Copy of iterator before increment
+     */
+    intrusive_const_iterator operator++(int) {
+        intrusive_const_iterator temp = *this;
+        ++(*this);
+        return temp;
+    }
+
+    /**
+     * @brief Equality comparison
+     * @param lhs First iterator
+     * @param rhs Second iterator
+     * @return True if both iterators point to the same object
+     */
+    friend bool operator==(const intrusive_const_iterator& lhs, const intrusive_const_iterator& rhs) {
+        return lhs.current == rhs.current;
+    }
+
+    /**
+     * @brief Inequality comparison
+     * @param lhs First iterator
+     * @param rhs Second iterator
+     * @return True if iterators point to different objects
+     */
+    friend bool operator!=(const intrusive_const_iterator& lhs, const intrusive_const_iterator& rhs) {
+        return !(lhs == rhs);
+    }
+
+    /**
+     * @brief Get the current object
+     * @return Const pointer to the current object
+     */
+    const T* get_element() const { return current; }
+};
@@ -0,0 +1,270 @@
+#include "intrusive_queue.h"
+
+// IntrusiveQueue constructors and operators
+template<typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveQueue<T, Hook>::IntrusiveQueue() : frontElement(nullptr), rearElement(nullptr), queueSize(0) {}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveQueue<T, Hook>::IntrusiveQueue(IntrusiveQueue&& other) noexcept
+    : frontElement(other.frontElement), rearElement(other.rearElement), queueSize(other.queueSize) {
+    other.frontElement = nullptr;
+    other.rearElement = nullptr;
+    other.queueSize = 0;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveQueue<T, Hook>& IntrusiveQueue<T, Hook>::operator=(IntrusiveQueue&& other) noexcept {
+    if (this != &other) {
+        frontElement = other.frontElement;
+        rearElement = other.rearElement;
+        queueSize = other.queueSize;
+        other.frontElement = nullptr;
+        other.rearElement = nullptr;
+        other.queueSize = 0;
+    }
+    return *this;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveQueue<T, Hook>& IntrusiveQueue<T, Hook>::operator=(const fwd_container<T>& other) {
+    if (this == &other) return *this;
+    throw std::runtime_error("Cannot assign: IntrusiveQueue does not own its elements");
+}
+
+// fwd_container interface implementation
+template<typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::push(const T&) {
+    throw std::runtime_error("Cannot push: IntrusiveQueue links objects in place, use link()");
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::push(T&&) {
+    throw std::runtime_error("Cannot push: IntrusiveQueue links objects in place, use link()");
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::link(T& value) noexcept {
+    T* element = &value;
+    (element->*Hook).next = nullptr;
+    if (rearElement != nullptr) {
+        (rearElement->*Hook).next = element;
+    } else {
+        frontElement = element;
+    }
+    rearElement = element;
+    ++queueSize;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T IntrusiveQueue<T, Hook>::pop() {
+    return unlink();
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T& IntrusiveQueue<T, Hook>::unlink() {
+    if (is_empty()) throw std::runtime_error("Cannot pop: IntrusiveQueue is empty");
+    return *try_unlink();
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T* IntrusiveQueue<T, Hook>::try_unlink() noexcept {
+    T* element = frontElement;
+    if (element == nullptr) return nullptr;
+
+    frontElement = (element->*Hook).next;
+    if (frontElement == nullptr) rearElement = nullptr;
+    (element->*Hook).next = nullptr;
+    --queueSize;
+    return element;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveQueue<T, Hook>::try_pop(T& out) {
+    if (is_empty()) return false;
+    out = *frontElement;
+    try_unlink();
+    return true;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+std::optional<T> IntrusiveQueue<T, Hook>::try_pop() {
+    if (is_empty()) return std::nullopt;
+    std::optional<T> value(*frontElement);
+    try_unlink();
+    return value;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T& IntrusiveQueue<T, Hook>::get_front() {
+    if (is_empty()) throw std::runtime_error("Cannot get front data: IntrusiveQueue is empty");
+    return *frontElement;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+const T& IntrusiveQueue<T, Hook>::get_front() const {
+    if (is_empty()) throw std::runtime_error("Cannot get front data: IntrusiveQueue is empty");
+    return *frontElement;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T* IntrusiveQueue<T, Hook>::try_front() noexcept {
+    return frontElement;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+const T* IntrusiveQueue<T, Hook>::try_front() const noexcept {
+    return frontElement;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveQueue<T, Hook>::is_empty() const {
+    return frontElement == nullptr;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+size_t IntrusiveQueue<T, Hook>::size() const {
+    return queueSize;
+}
+
+// Iteration
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveQueue<T, Hook>::iterator IntrusiveQueue<T, Hook>::begin() {
+    return iterator(frontElement);
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveQueue<T, Hook>::iterator IntrusiveQueue<T, Hook>::end() {
+    return iterator(nullptr);
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveQueue<T, Hook>::const_iterator IntrusiveQueue<T, Hook>::begin() const {
+    return const_iterator(frontElement);
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveQueue<T, Hook>::const_iterator IntrusiveQueue<T, Hook>::end() const {
+    return const_iterator(nullptr);
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveQueue<T, Hook>::const_iterator IntrusiveQueue<T, Hook>::cbegin() const {
+    return begin();
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveQueue<T, Hook>::const_iterator IntrusiveQueue<T, Hook>::cend() const {
+    return end();
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename fwd_container<T>::iterator IntrusiveQueue<T, Hook>::make_begin() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(begin());
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename fwd_container<T>::iterator IntrusiveQueue<T, Hook>::make_end() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(end());
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename fwd_container<T>::const_iterator IntrusiveQueue<T, Hook>::make_begin() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(begin());
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename fwd_container<T>::const_iterator IntrusiveQueue<T, Hook>::make_end() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(end());
+}
+
+// Other operations
+template<typename T, IntrusiveHook<T> T::*Hook>
+T& IntrusiveQueue<T, Hook>::front() {
+    return get_front();
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+const T& IntrusiveQueue<T, Hook>::front() const {
+    return get_front();
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T& IntrusiveQueue<T, Hook>::back() {
+    if (is_empty()) throw std::runtime_error("Cannot get back data: IntrusiveQueue is empty");
+    return *rearElement;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+const T& IntrusiveQueue<T, Hook>::back() const {
+    if (is_empty()) throw std::runtime_error("Cannot get back data: IntrusiveQueue is empty");
+    return *rearElement;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::splice_back(IntrusiveQueue&& other) noexcept {
+    if (this == &other || other.is_empty()) return;
+
+    if (rearElement != nullptr) {
+        (rearElement->*Hook).next = other.frontElement;
+    } else {
+        frontElement = other.frontElement;
+    }
+    rearElement = other.rearElement;
+    queueSize += other.queueSize;
+
+    other.frontElement = nullptr;
+    other.rearElement = nullptr;
+    other.queueSize = 0;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveQueue<T, Hook>::clear() {
+    frontElement = nullptr;
+    rearElement = nullptr;
+    queueSize = 0;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveQueue<T, Hook>::empty() const {
+    return is_empty();
+}
+
+// Stream operations
+template<typename T, IntrusiveHook<T> T::*Hook>
+std::ostream& IntrusiveQueue<T, Hook>::print(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+
+        bool first = true;
+        for (const T& value : *this) {
+            if (!first) {
+                os << " ";
+            }
+
+            if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+
+            os << value;
+            first = false;
+        }
+
+        if (!os.good()) throw std::runtime_error("Output stream failed after serialization");
+
+        return os;
+
+    } catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("IntrusiveQueue serialization failed: ") + e.what());
+    }
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+std::istream& IntrusiveQueue<T, Hook>::read(std::istream& is) {
+    is.setstate(std::ios::failbit);
+    throw std::runtime_error("IntrusiveQueue input failed: elements are not owned by the queue and cannot be created");
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+std::istream& IntrusiveQueue<T, Hook>::load(std::istream& is) {
+    is.setstate(std::ios::failbit);
+    throw std::runtime_error("IntrusiveQueue load failed: elements are not owned by the queue and cannot be created");
+}
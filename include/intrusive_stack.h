@@ -0,0 +1,283 @@
+#pragma once
+#include <iostream>
+#include <optional>
+#include <exception>
+
+#include "fwd_container.h"
+#include "intrusive.h"
+
+/**
+ * @brief Stack that links the user's objects through an embedded hook instead of owning copies
+ * @tparam T Type of elements stored in the stack
+ * @tparam Hook Pointer to the IntrusiveHook<T> member used for linking (e.g. &T::hook)
+ *
+ * link() links the object itself and unlink() takes it out again: nothing is allocated,
+ * copied or moved. The stack never owns its elements, so every object must stay alive
+ * (and must not be linked into another container through the same hook) for as long
+ * as it is linked. link() takes a non-const lvalue only, so a temporary cannot be
+ * linked; the push() overrides of fwd_container, which accept both, throw instead.
+ * For the same reason the stack is not a forward container for generic code
+ * (is_forward_container_v is false) and forward_all() does not take it.
+ * pop() keeps the fwd_container contract and returns a copy of the unlinked object.
+ */
+template<typename T, IntrusiveHook<T> T::*Hook>
+class IntrusiveStack final : public fwd_container<T> {
+public:
+    using iterator = intrusive_iterator<T, Hook>;
+    using const_iterator = intrusive_const_iterator<T, Hook>;
+
+    static constexpr bool is_intrusive = true; ///< Marker that excludes it from is_forward_container
+
+    /**
+     * @brief Default constructor - creates an empty stack
+     */
+    IntrusiveStack();
+
+    /**
+     * @brief Intrusive stacks cannot be copied: an object links into one container per hook
+     */
+    IntrusiveStack(const IntrusiveStack&) = delete;
+
+    /**
+     * @brief Move constructor - takes over the linked objects of another stack
+     * @param other Stack to move from (left empty)
+     */
+    IntrusiveStack(IntrusiveStack&& other) noexcept;
+
+    /**
+     * @brief Intrusive stacks cannot be copied: an object links into one container per hook
+     */
+    IntrusiveStack& operator=(const IntrusiveStack&) = delete;
+
+    /**
+     * @brief Move assignment operator
+     * @param other Stack to move from (left empty)
+     * @return Reference to this stack
+     */
+    IntrusiveStack& operator=(IntrusiveStack&& other) noexcept;
+
+    /**
+     * @brief Destructor - forgets the linked objects without touching them
+     */
+    ~IntrusiveStack() = default;
+
+    // fwd_container interface implementation
+    /**
+     * @brief Pushing a value would have to link a copy the stack cannot own; use link()
+     * @param value Ignored
+     * @throws std::runtime_error always
+     */
+    void push(const T& value) override;
+
+    /**
+     * @brief Pushing a temporary would leave a dangling link; use link()
+     * @param value Ignored
+     * @throws std::runtime_error always
+     */
+    void push(T&& value) override;
+
+    /**
+     * @brief Link an object onto the top of the stack
+     * @param value Object to link (must outlive its membership)
+     */
+    void link(T& value) noexcept;
+
+    /**
+     * @brief Temporaries cannot be linked: the stack would outlive them
+     */
+    void link(T&& value) = delete;
+
+    /**
+     * @brief Unlink the top object and return a copy of it
+     * @return Copy of the removed object
+     * @throws std::runtime_error if stack is empty
+     */
+    T pop() override;
+
+    /**
+     * @brief Unlink the top object without copying it
+     * @return Reference to the object that was on top
+     * @throws std::runtime_error if stack is empty
+     */
+    T& unlink();
+
+    /**
+     * @brief Unlink the top object if there is one; never throws on empty
+     * @return Pointer to the object that was on top, or nullptr if the stack was empty
+     */
+    T* try_unlink() noexcept;
+
+    /**
+     * @brief Get reference to the top element
+     * @return Reference to the top element
+     * @throws std::runtime_error if stack is empty
+     */
+    T& get_front() override;
+
+    /**
+     * @brief Get const reference to the top element
+     * @return Const reference to the top element
+     * @throws std::runtime_error if stack is empty
+     */
+    const T& get_front() const override;
+
+    /**
+     * @brief Unlink the top object and copy it out; never throws on empty
+     * @param out Receives a copy of the removed object
+     * @return True if an object was removed, false if the stack was empty
+     */
+    bool try_pop(T& out) override;
+
+    /**
+     * @brief Unlink the top object and copy it out; never throws on empty
+     * @return Copy of the removed object, or std::nullopt if the stack was empty
+     */
+    std::optional<T> try_pop() override;
+
+    /**
+     * @brief Get pointer to the top element
+     * @return Pointer to the top element, or nullptr if the stack is empty
+     */
+    T* try_front() noexcept override;
+
+    /**
+     * @brief Get const pointer to the top element
+     * @return Const pointer to the top element, or nullptr if the stack is empty
+     */
+    const T* try_front() const noexcept override;
+
+    /**
+     * @brief Check if stack is empty
+     * @return True if stack is empty, false otherwise
+     */
+    bool is_empty() const override;
+
+    /**
+     * @brief Get the number of elements in stack
+     * @return Size of the stack
+     */
+    size_t size() const override;
+
+    /**
+     * @brief Binary loading would have to create objects, which an intrusive stack cannot own
+     * @param is Input stream
+     * @return Never returns normally
+     * @throws std::runtime_error always; failbit is set
+     */
+    std::istream& load(std::istream& is) override;
+
+    /**
+     * @brief Assignment from a fwd_container is not supported
+     * @param other Container to copy from
+     * @return Never returns normally
+     * @throws std::runtime_error always: the stack cannot hold copies of another container's elements
+     */
+    IntrusiveStack& operator=(const fwd_container<T>& other) override;
+
+    /**
+     * @brief Get iterator to the beginning of the stack
+     * @return Iterator to the first element (top of stack)
+     */
+    iterator begin();
+
+    /**
+     * @brief Get iterator to the end of the stack
+     * @return Iterator to the position after the last element
+     */
+    iterator end();
+
+    /**
+     * @brief Get const iterator to the beginning of the stack
+     * @return Const iterator to the first element (top of stack)
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Get const iterator to the end of the stack
+     * @return Const iterator to the position after the last element
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief Get const iterator to the beginning of the stack
+     * @return Const iterator to the first element (top of stack)
+     */
+    const_iterator cbegin() const;
+
+    /**
+     * @brief Get const iterator to the end of the stack
+     * @return Const iterator to the position after the last element
+     */
+    const_iterator cend() const;
+
+    /**
+     * @brief Returns a reference to the top element (non-const version)
+     * @return Reference to the top element
+     * @throws std::runtime_error if stack is empty
+     */
+    T& top();
+
+    /**
+     * @brief Returns a reference to top element (const version)
+     * @return Const reference to top element
+     * @throws std::runtime_error if stack is empty
+     */
+    const T& top() const;
+
+    /**
+     * @brief Unlinks every object in constant time; the objects themselves are not touched
+     */
+    void clear();
+
+    /**
+     * @brief Checks if the stack is empty
+     * @return true if stack is empty, false otherwise
+     */
+    bool empty() const;
+
+protected:
+    /**
+     * @brief Create a polymorphic iterator to the beginning of the stack
+     * @return Type-erased iterator to the first element
+     */
+    typename fwd_container<T>::iterator make_begin() override;
+
+    /**
+     * @brief Create a polymorphic iterator to the end of the stack
+     * @return Type-erased iterator to the position after the last element
+     */
+    typename fwd_container<T>::iterator make_end() override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the beginning of the stack
+     * @return Type-erased const iterator to the first element
+     */
+    typename fwd_container<T>::const_iterator make_begin() const override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the end of the stack
+     * @return Type-erased const iterator to the position after the last element
+     */
+    typename fwd_container<T>::const_iterator make_end() const override;
+
+    /**
+     * @brief Print stack contents to output stream
+     * @param os Output stream
+     * @return Reference to the output stream
+     */
+    virtual std::ostream& print(std::ostream& os) const override;
+
+    /**
+     * @brief Reading would have to create objects, which an intrusive stack cannot own
+     * @param is Input stream
+     * @return Never returns normally
+     * @throws std::runtime_error always; failbit is set
+     */
+    virtual std::istream& read(std::istream& is) override;
+
+private:
+    T* topElement;    ///< Object on top of the stack (nullptr when empty)
+    size_t stackSize; ///< Number of linked objects
+};
+
+#include "intrusive_stack.ipp"
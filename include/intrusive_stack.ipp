@@ -0,0 +1,231 @@
+#include "intrusive_stack.h"
+
+// IntrusiveStack constructors and operators
+template<typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveStack<T, Hook>::IntrusiveStack() : topElement(nullptr), stackSize(0) {}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveStack<T, Hook>::IntrusiveStack(IntrusiveStack&& other) noexcept
+    : topElement(other.topElement), stackSize(other.stackSize) {
+    other.topElement = nullptr;
+    other.stackSize = 0;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveStack<T, Hook>& IntrusiveStack<T, Hook>::operator=(IntrusiveStack&& other) noexcept {
+    if (this != &other) {
+        topElement = other.topElement;
+        stackSize = other.stackSize;
+        other.topElement = nullptr;
+        other.stackSize = 0;
+    }
+    return *this;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+IntrusiveStack<T, Hook>& IntrusiveStack<T, Hook>::operator=(const fwd_container<T>& other) {
+    if (this == &other) return *this;
+    throw std::runtime_error("Cannot assign: IntrusiveStack does not own its elements");
+}
+
+// fwd_container interface implementation
+template<typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveStack<T, Hook>::push(const T&) {
+    throw std::runtime_error("Cannot push: IntrusiveStack links objects in place, use link()");
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveStack<T, Hook>::push(T&&) {
+    throw std::runtime_error("Cannot push: IntrusiveStack links objects in place, use link()");
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveStack<T, Hook>::link(T& value) noexcept {
+    T* element = &value;
+    (element->*Hook).next = topElement;
+    topElement = element;
+    ++stackSize;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T IntrusiveStack<T, Hook>::pop() {
+    return unlink();
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T& IntrusiveStack<T, Hook>::unlink() {
+    if (is_empty()) throw std::runtime_error("Cannot pop: IntrusiveStack is empty");
+    return *try_unlink();
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T* IntrusiveStack<T, Hook>::try_unlink() noexcept {
+    T* element = topElement;
+    if (element == nullptr) return nullptr;
+
+    topElement = (element->*Hook).next;
+    (element->*Hook).next = nullptr;
+    --stackSize;
+    return element;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveStack<T, Hook>::try_pop(T& out) {
+    if (is_empty()) return false;
+    out = *topElement;
+    try_unlink();
+    return true;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+std::optional<T> IntrusiveStack<T, Hook>::try_pop() {
+    if (is_empty()) return std::nullopt;
+    std::optional<T> value(*topElement);
+    try_unlink();
+    return value;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T& IntrusiveStack<T, Hook>::get_front() {
+    if (is_empty()) throw std::runtime_error("Cannot get top data: IntrusiveStack is empty");
+    return *topElement;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+const T& IntrusiveStack<T, Hook>::get_front() const {
+    if (is_empty()) throw std::runtime_error("Cannot get top data: IntrusiveStack is empty");
+    return *topElement;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+T* IntrusiveStack<T, Hook>::try_front() noexcept {
+    return topElement;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+const T* IntrusiveStack<T, Hook>::try_front() const noexcept {
+    return topElement;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveStack<T, Hook>::is_empty() const {
+    return topElement == nullptr;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+size_t IntrusiveStack<T, Hook>::size() const {
+    return stackSize;
+}
+
+// Iteration
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveStack<T, Hook>::iterator IntrusiveStack<T, Hook>::begin() {
+    return iterator(topElement);
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveStack<T, Hook>::iterator IntrusiveStack<T, Hook>::end() {
+    return iterator(nullptr);
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveStack<T, Hook>::const_iterator IntrusiveStack<T, Hook>::begin() const {
+    return const_iterator(topElement);
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveStack<T, Hook>::const_iterator IntrusiveStack<T, Hook>::end() const {
+    return const_iterator(nullptr);
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveStack<T, Hook>::const_iterator IntrusiveStack<T, Hook>::cbegin() const {
+    return begin();
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename IntrusiveStack<T, Hook>::const_iterator IntrusiveStack<T, Hook>::cend() const {
+    return end();
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename fwd_container<T>::iterator IntrusiveStack<T, Hook>::make_begin() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(begin());
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename fwd_container<T>::iterator IntrusiveStack<T, Hook>::make_end() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(end());
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename fwd_container<T>::const_iterator IntrusiveStack<T, Hook>::make_begin() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(begin());
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+typename fwd_container<T>::const_iterator IntrusiveStack<T, Hook>::make_end() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(end());
+}
+
+// Other operations
+template<typename T, IntrusiveHook<T> T::*Hook>
+T& IntrusiveStack<T, Hook>::top() {
+    return get_front();
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+const T& IntrusiveStack<T, Hook>::top() const {
+    return get_front();
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+void IntrusiveStack<T, Hook>::clear() {
+    topElement = nullptr;
+    stackSize = 0;
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+bool IntrusiveStack<T, Hook>::empty() const {
+    return is_empty();
+}
+
+// Stream operations
+template<typename T, IntrusiveHook<T> T::*Hook>
+std::ostream& IntrusiveStack<T, Hook>::print(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+
+        bool first = true;
+        for (const T& value : *this) {
+            if (!first) {
+                os << " ";
+            }
+
+            if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+
+            os << value;
+            first = false;
+        }
+
+        if (!os.good()) throw std::runtime_error("Output stream failed after serialization");
+
+        return os;
+
+    } catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("IntrusiveStack serialization failed: ") + e.what());
+    }
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+std::istream& IntrusiveStack<T, Hook>::read(std::istream& is) {
+    is.setstate(std::ios::failbit);
+    throw std::runtime_error("IntrusiveStack input failed: elements are not owned by the stack and cannot be created");
+}
+
+template<typename T, IntrusiveHook<T> T::*Hook>
+std::istream& IntrusiveStack<T, Hook>::load(std::istream& is) {
+    is.setstate(std::ios::failbit);
+    throw std::runtime_error("IntrusiveStack load failed: elements are not owned by the stack and cannot be created");
+}
@@ -0,0 +1,491 @@
+#pragma once
+#ifndef _WIN32
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+
+#include "fwd_container.h"
+#include "stream_parse.h"
+
+/**
+ * @brief A durable FIFO queue whose elements live in a memory-mapped file
+ * @tparam T The type of elements stored in the queue (must be trivially copyable)
+ *
+ * The file holds a small header (format version, element size, head and tail indices)
+ * followed by a contiguous array of elements. push() writes at the tail and pop()
+ * advances the head, both directly in the shared mapping, so reopening the file
+ * resumes the queue exactly where it was left. Reads are zero-copy: get_front() and
+ * the iterators refer straight into the mapping. When the tail reaches the end of the
+ * file the live elements are moved back to the start if that frees at least half of
+ * the space, otherwise the file is doubled and remapped.
+ *
+ * Changes reach the file through the page cache and survive a process crash; call
+ * sync() to force them to disk. Pushing may remap the file, which invalidates
+ * iterators, pointers and references. Only available on POSIX systems.
+ */
+template<typename T>
+class MappedQueue final : public fwd_container<T> {
+    static_assert(std::is_trivially_copyable_v<T>, "MappedQueue requires a trivially copyable element type");
+
+public:
+    /**
+     * @brief Iterator implementation for MappedQueue (non-const version)
+     *
+     * Plain value type holding one pointer into the mapping.
+     */
+    class mapped_queue_iterator {
+    private:
+        T* current; ///< Current element pointer
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = T*;
+        using reference         = T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        mapped_queue_iterator() : current(nullptr) {}
+
+        /**
+         * @brief Constructor
+         * @param element Starting element for iteration
+         */
+        explicit mapped_queue_iterator(T* element) : current(element) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Reference to the current element
+         */
+        T& operator*() const {
+            return *current;
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Pointer to the current element
+         */
+        T* operator->() const {
+            return current;
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        mapped_queue_iterator& operator++() {
+            ++current;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        mapped_queue_iterator operator++(int) {
+            mapped_queue_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Advance by several elements, in constant time
+         * @param n Number of elements to skip (at most the distance to the end)
+         * @return Reference to this iterator
+         */
+        mapped_queue_iterator& skip(size_t n) {
+            current += n;
+            return *this;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same element
+         */
+        friend bool operator==(const mapped_queue_iterator& lhs, const mapped_queue_iterator& rhs) {
+            return lhs.current == rhs.current;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different elements
+         */
+        friend bool operator!=(const mapped_queue_iterator& lhs, const mapped_queue_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the current element pointer
+         * @return Pointer to the current element
+         */
+        T* get_current() const { return current; }
+    };
+
+    /**
+     * @brief Const iterator implementation for MappedQueue
+     *
+     * Plain value type holding one pointer into the mapping.
+     */
+    class mapped_queue_const_iterator {
+    private:
+        const T* current; ///< Current element pointer
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = const T*;
+        using reference         = const T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        mapped_queue_const_iterator() : current(nullptr) {}
+
+        /**
+         * @brief Constructor
+         * @param element Starting element for iteration
+         */
+        explicit mapped_queue_const_iterator(const T* element) : current(element) {}
+
+        /**
+         * @brief Conversion from non-const iterator
+         * @param other Non-const iterator to convert
+         */
+        mapped_queue_const_iterator(const mapped_queue_iterator& other) : current(other.get_current()) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Const reference to the current element
+         */
+        const T& operator*() const {
+            return *current;
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Const pointer to the current element
+         */
+        const T* operator->() const {
+            return current;
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        mapped_queue_const_iterator& operator++() {
+            ++current;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        mapped_queue_const_iterator operator++(int) {
+            mapped_queue_const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Advance by several elements, in constant time
+         * @param n Number of elements to skip (at most the distance to the end)
+         * @return Reference to this iterator
+         */
+        mapped_queue_const_iterator& skip(size_t n) {
+            current += n;
+            return *this;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same element
+         */
+        friend bool operator==(const mapped_queue_const_iterator& lhs, const mapped_queue_const_iterator& rhs) {
+            return lhs.current == rhs.current;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different elements
+         */
+        friend bool operator!=(const mapped_queue_const_iterator& lhs, const mapped_queue_const_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the current element pointer
+         * @return Pointer to the current element
+         */
+        const T* get_current() const { return current; }
+    };
+
+    using iterator = mapped_queue_iterator;
+    using const_iterator = mapped_queue_const_iterator;
+
+    /**
+     * @brief Opens a queue file, creating it if it does not exist
+     * @param path Path of the segment file
+     * @param initial_capacity Number of element slots to reserve when the file is created
+     * @throws std::runtime_error if the file cannot be opened or mapped, or was written
+     *         for a different element type or format version
+     */
+    explicit MappedQueue(const std::string& path, size_t initial_capacity = 1024);
+
+    MappedQueue(const MappedQueue&) = delete;
+
+    /**
+     * @brief Move constructor - takes over the file and its mapping
+     * @param other Queue to move from (left without a file; only destruction is allowed)
+     */
+    MappedQueue(MappedQueue&& other) noexcept;
+
+    MappedQueue& operator=(const MappedQueue&) = delete;
+
+    /**
+     * @brief Move assignment - closes the current file and takes over another
+     * @param other Queue to move from (left without a file; only destruction is allowed)
+     * @return Reference to this queue
+     */
+    MappedQueue& operator=(MappedQueue&& other) noexcept;
+
+    /**
+     * @brief Destructor - unmaps and closes the file; the contents stay on disk
+     */
+    ~MappedQueue();
+
+    // fwd_container interface implementation
+    /**
+     * @brief Add element to the back of the queue (copy semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if the file cannot be grown or remapped
+     */
+    void push(const T& value) override;
+
+    /**
+     * @brief Add element to the back of the queue (move semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if the file cannot be grown or remapped
+     */
+    void push(T&& value) override;
+
+    /**
+     * @brief Remove and return element from the front of the queue
+     * @return The removed element from front
+     * @throws std::runtime_error if queue is empty
+     */
+    T pop() override;
+
+    /**
+     * @brief Get reference to the front element
+     * @return Reference to the front element (inside the mapping)
+     * @throws std::runtime_error if queue is empty
+     */
+    T& get_front() override;
+
+    /**
+     * @brief Get const reference to the front element
+     * @return Const reference to the front element (inside the mapping)
+     * @throws std::runtime_error if queue is empty
+     */
+    const T& get_front() const override;
+
+    /**
+     * @brief Check if queue is empty
+     * @return True if queue is empty, false otherwise
+     */
+    bool is_empty() const override;
+
+    /**
+     * @brief Get the number of elements in queue
+     * @return Size of the queue
+     */
+    size_t size() const override;
+
+    /**
+     * @brief Write the queue in the binary format of fwd_container::save()
+     * @param os Output stream (should be opened in binary mode)
+     * @return Reference to the output stream
+     * @throws std::runtime_error if the stream fails
+     *
+     * The live region of the mapping is written with a single stream call.
+     */
+    std::ostream& save(std::ostream& os) const override;
+
+    /**
+     * @brief Polymorphic assignment from another MappedQueue (copies its elements into this file)
+     * @param other Container to copy from
+     * @return Reference to this queue
+     * @throws std::bad_cast if other is not a MappedQueue<T>
+     * @throws std::runtime_error if the file cannot be grown or remapped
+     */
+    MappedQueue<T>& operator=(const fwd_container<T>& other) override;
+
+    /**
+     * @brief Get iterator to the front element
+     * @return Iterator to the front element
+     */
+    iterator begin();
+
+    /**
+     * @brief Get iterator to the position after the last element
+     * @return Iterator to the end
+     */
+    iterator end();
+
+    /**
+     * @brief Get const iterator to the front element
+     * @return Const iterator to the front element
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Get const iterator to the position after the last element
+     * @return Const iterator to the end
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief Get const iterator to the front element
+     * @return Const iterator to the front element
+     */
+    const_iterator cbegin() const;
+
+    /**
+     * @brief Get const iterator to the position after the last element
+     * @return Const iterator to the end
+     */
+    const_iterator cend() const;
+
+    /**
+     * @brief Remove all elements
+     */
+    void clear();
+
+    /**
+     * @brief Checks if the queue is empty
+     * @return true if queue is empty, false otherwise
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the number of element slots in the file
+     * @return Elements that fit before the file has to grow or be compacted
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Flush the mapping to disk
+     * @throws std::runtime_error if msync fails
+     */
+    void sync();
+
+protected:
+    /**
+     * @brief Create a polymorphic iterator to the front element
+     * @return Iterator to the front element
+     */
+    typename fwd_container<T>::iterator make_begin() override;
+
+    /**
+     * @brief Create a polymorphic iterator to the position after the last element
+     * @return Iterator to the end
+     */
+    typename fwd_container<T>::iterator make_end() override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the front element
+     * @return Const iterator to the front element
+     */
+    typename fwd_container<T>::const_iterator make_begin() const override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the position after the last element
+     * @return Const iterator to the end
+     */
+    typename fwd_container<T>::const_iterator make_end() const override;
+
+    /**
+     * @brief Print queue contents to output stream
+     * @param os Output stream
+     * @return Reference to the output stream
+     */
+    virtual std::ostream& print(std::ostream& os) const override;
+
+    /**
+     * @brief Read queue contents from input stream
+     * @param is Input stream
+     * @return Reference to the input stream
+     */
+    virtual std::istream& read(std::istream& is) override;
+
+private:
+    /// Layout of the first bytes of the file
+    struct file_header {
+        char magic[8];        ///< File signature "FWDMAPQ"
+        uint32_t version;     ///< Format version
+        uint32_t elementSize; ///< sizeof(T) of the writer
+        uint64_t capacity;    ///< Number of element slots after the header
+        uint64_t head;        ///< Index of the front element
+        uint64_t tail;        ///< Index one past the last element
+    };
+
+    static constexpr char file_magic[8] = {'F', 'W', 'D', 'M', 'A', 'P', 'Q', '\0'};
+    static constexpr uint32_t format_version = 1;
+
+    /// Offset of the element array; keeps every slot aligned for T
+    static constexpr size_t data_offset = ((sizeof(file_header) + alignof(T) - 1) / alignof(T)) * alignof(T);
+
+    /**
+     * @brief Build an exception describing a failed system call
+     * @param what Description of the operation that failed
+     * @return Exception carrying the description and strerror(errno)
+     */
+    static std::runtime_error system_failure(const std::string& what);
+
+    /**
+     * @brief Map the first bytes of the open file
+     * @param bytes Length of the mapping
+     * @throws std::runtime_error if mmap fails
+     */
+    void map(size_t bytes);
+
+    /**
+     * @brief Make room for at least one more element at the tail
+     * @throws std::runtime_error if the file cannot be grown or remapped
+     */
+    void reserve_slot();
+
+    /**
+     * @brief Pointer to the element slot with the given index
+     * @param index Slot index
+     * @return Pointer into the mapping
+     */
+    T* slot(uint64_t index) const noexcept;
+
+    int fd;               ///< File descriptor of the segment file (-1 after a move)
+    void* mapping;        ///< Start of the mapping (nullptr after a move)
+    size_t mappedBytes;   ///< Length of the mapping
+    file_header* header;  ///< Header at the start of the mapping
+};
+
+#include "mapped_queue.ipp"
+#endif
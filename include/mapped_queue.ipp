@@ -0,0 +1,378 @@
+#include "mapped_queue.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// MappedQueue constructors
+template<typename T>
+MappedQueue<T>::MappedQueue(const std::string& path, size_t initial_capacity)
+    : fd(-1), mapping(nullptr), mappedBytes(0), header(nullptr) {
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) throw system_failure("Cannot open mapped queue file '" + path + "'");
+
+    try {
+        struct stat info;
+        if (::fstat(fd, &info) != 0) throw system_failure("Cannot stat mapped queue file");
+
+        if (info.st_size == 0) {
+            if (initial_capacity == 0) initial_capacity = 1;
+            size_t bytes = data_offset + initial_capacity * sizeof(T);
+            if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+                throw system_failure("Cannot size mapped queue file");
+            }
+            map(bytes);
+            std::memcpy(header->magic, file_magic, sizeof(header->magic));
+            header->version = format_version;
+            header->elementSize = static_cast<uint32_t>(sizeof(T));
+            header->capacity = initial_capacity;
+            header->head = 0;
+            header->tail = 0;
+            return;
+        }
+
+        if (static_cast<size_t>(info.st_size) < data_offset) {
+            throw std::runtime_error("Mapped queue file is truncated");
+        }
+        map(static_cast<size_t>(info.st_size));
+        if (std::memcmp(header->magic, file_magic, sizeof(header->magic)) != 0) {
+            throw std::runtime_error("File is not a mapped queue");
+        }
+        if (header->version != format_version) {
+            throw std::runtime_error("Unsupported mapped queue format version");
+        }
+        if (header->elementSize != sizeof(T)) {
+            throw std::runtime_error("Mapped queue file was written for a different element type");
+        }
+        if (data_offset + header->capacity * sizeof(T) > mappedBytes ||
+            header->head > header->tail || header->tail > header->capacity) {
+            throw std::runtime_error("Mapped queue header is corrupt");
+        }
+    }
+    catch (...) {
+        if (mapping != nullptr) ::munmap(mapping, mappedBytes);
+        ::close(fd);
+        throw;
+    }
+}
+
+template<typename T>
+MappedQueue<T>::MappedQueue(MappedQueue&& other) noexcept
+    : fd(other.fd), mapping(other.mapping), mappedBytes(other.mappedBytes), header(other.header) {
+    other.fd = -1;
+    other.mapping = nullptr;
+    other.mappedBytes = 0;
+    other.header = nullptr;
+}
+
+template<typename T>
+MappedQueue<T>& MappedQueue<T>::operator=(MappedQueue&& other) noexcept {
+    if (this != &other) {
+        if (mapping != nullptr) ::munmap(mapping, mappedBytes);
+        if (fd >= 0) ::close(fd);
+
+        fd = other.fd;
+        mapping = other.mapping;
+        mappedBytes = other.mappedBytes;
+        header = other.header;
+        other.fd = -1;
+        other.mapping = nullptr;
+        other.mappedBytes = 0;
+        other.header = nullptr;
+    }
+    return *this;
+}
+
+template<typename T>
+MappedQueue<T>& MappedQueue<T>::operator=(const fwd_container<T>& other) {
+    const MappedQueue<T>* derived = dynamic_cast<const MappedQueue<T>*>(&other);
+    if (!derived) {
+        throw std::bad_cast();
+    }
+    if (derived == this) return *this;
+
+    clear();
+    for (const T& value : *derived) push(value);
+    return *this;
+}
+
+template<typename T>
+MappedQueue<T>::~MappedQueue() {
+    if (mapping != nullptr) ::munmap(mapping, mappedBytes);
+    if (fd >= 0) ::close(fd);
+}
+
+// Mapping management
+template<typename T>
+std::runtime_error MappedQueue<T>::system_failure(const std::string& what) {
+    return std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+template<typename T>
+void MappedQueue<T>::map(size_t bytes) {
+    void* region = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (region == MAP_FAILED) throw system_failure("Cannot map queue file");
+    mapping = region;
+    mappedBytes = bytes;
+    header = static_cast<file_header*>(region);
+}
+
+template<typename T>
+T* MappedQueue<T>::slot(uint64_t index) const noexcept {
+    return reinterpret_cast<T*>(static_cast<unsigned char*>(mapping) + data_offset) + index;
+}
+
+template<typename T>
+void MappedQueue<T>::reserve_slot() {
+    if (header->tail < header->capacity) return;
+
+    uint64_t live = header->tail - header->head;
+    if (header->head >= header->capacity / 2 && header->head > 0) {
+        // Enough of the file lies before the head to make moving back worth it
+        std::memmove(slot(0), slot(header->head), live * sizeof(T));
+        header->head = 0;
+        header->tail = live;
+        return;
+    }
+
+    uint64_t newCapacity = header->capacity * 2;
+    size_t bytes = data_offset + newCapacity * sizeof(T);
+    if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        throw system_failure("Cannot grow mapped queue file");
+    }
+
+    void* old = mapping;
+    size_t oldBytes = mappedBytes;
+    map(bytes);
+    ::munmap(old, oldBytes);
+    header->capacity = newCapacity;
+}
+
+// fwd_container interface implementation
+template<typename T>
+void MappedQueue<T>::push(const T& value) {
+    // value may live in this queue's mapping, which reserve_slot can move or unmap
+    T copy = value;
+    reserve_slot();
+    std::memcpy(static_cast<void*>(slot(header->tail)), &copy, sizeof(T));
+    ++header->tail;
+}
+
+template<typename T>
+void MappedQueue<T>::push(T&& value) {
+    push(static_cast<const T&>(value));
+}
+
+template<typename T>
+T MappedQueue<T>::pop() {
+    if (is_empty()) throw std::runtime_error("Cannot pop: MappedQueue is empty");
+
+    T value = *slot(header->head);
+    ++header->head;
+    if (header->head == header->tail) {
+        // Start over at the beginning of the file once the queue drains
+        header->head = 0;
+        header->tail = 0;
+    }
+    return value;
+}
+
+template<typename T>
+T& MappedQueue<T>::get_front() {
+    if (is_empty()) throw std::runtime_error("Cannot get front data: MappedQueue is empty");
+    return *slot(header->head);
+}
+
+template<typename T>
+const T& MappedQueue<T>::get_front() const {
+    if (is_empty()) throw std::runtime_error("Cannot get front data: MappedQueue is empty");
+    return *slot(header->head);
+}
+
+template<typename T>
+bool MappedQueue<T>::is_empty() const {
+    return header->head == header->tail;
+}
+
+template<typename T>
+size_t MappedQueue<T>::size() const {
+    return static_cast<size_t>(header->tail - header->head);
+}
+
+template<typename T>
+std::ostream& MappedQueue<T>::save(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+        binary_write_header<T>(os, size());
+        os.write(reinterpret_cast<const char*>(slot(header->head)), static_cast<std::streamsize>(size() * sizeof(T)));
+        if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+        return os;
+    }
+    catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("MappedQueue save failed: ") + e.what());
+    }
+}
+
+// Iteration
+template<typename T>
+typename MappedQueue<T>::iterator MappedQueue<T>::begin() {
+    return iterator(slot(header->head));
+}
+
+template<typename T>
+typename MappedQueue<T>::iterator MappedQueue<T>::end() {
+    return iterator(slot(header->tail));
+}
+
+template<typename T>
+typename MappedQueue<T>::const_iterator MappedQueue<T>::begin() const {
+    return const_iterator(slot(header->head));
+}
+
+template<typename T>
+typename MappedQueue<T>::const_iterator MappedQueue<T>::end() const {
+    return const_iterator(slot(header->tail));
+}
+
+template<typename T>
+typename MappedQueue<T>::const_iterator MappedQueue<T>::cbegin() const {
+    return begin();
+}
+
+template<typename T>
+typename MappedQueue<T>::const_iterator MappedQueue<T>::cend() const {
+    return end();
+}
+
+template<typename T>
+typename fwd_container<T>::iterator MappedQueue<T>::make_begin() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(begin());
+}
+
+template<typename T>
+typename fwd_container<T>::iterator MappedQueue<T>::make_end() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(end());
+}
+
+template<typename T>
+typename fwd_container<T>::const_iterator MappedQueue<T>::make_begin() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(begin());
+}
+
+template<typename T>
+typename fwd_container<T>::const_iterator MappedQueue<T>::make_end() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(end());
+}
+
+// Other operations
+template<typename T>
+void MappedQueue<T>::clear() {
+    header->head = 0;
+    header->tail = 0;
+}
+
+template<typename T>
+bool MappedQueue<T>::empty() const {
+    return is_empty();
+}
+
+template<typename T>
+size_t MappedQueue<T>::capacity() const {
+    return static_cast<size_t>(header->capacity);
+}
+
+template<typename T>
+void MappedQueue<T>::sync() {
+    if (::msync(mapping, mappedBytes, MS_SYNC) != 0) {
+        throw system_failure("Cannot sync mapped queue file");
+    }
+}
+
+// Text serialization
+template<typename T>
+std::ostream& MappedQueue<T>::print(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+
+        bool first = true;
+        for (const T& value : *this) {
+            if (!first) {
+                os << " ";
+            }
+
+            if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+
+            os << value;
+            first = false;
+        }
+
+        if (!os.good()) throw std::runtime_error("Output stream failed after serialization");
+
+        return os;
+
+    } catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("MappedQueue serialization failed: ") + e.what());
+    }
+}
+
+template<typename T>
+std::istream& MappedQueue<T>::read(std::istream& is) {
+    try {
+        if (!is.good()) {
+            throw std::runtime_error("Input stream is in bad state");
+        }
+
+        // Values only ever go behind the old elements (compaction keeps their order),
+        // so rolling back is moving the tail back
+        uint64_t oldSize = header->tail - header->head;
+
+        if constexpr (is_fast_parsable_v<T>) {
+            if (fast_parse_applies(is)) {
+                try {
+                    parse_text_elements<T>(is, [this](T value) { push(value); });
+                }
+                catch (...) {
+                    header->tail = header->head + oldSize;
+                    throw;
+                }
+                return is;
+            }
+        }
+
+        try {
+            T value;
+            while (is >> value) {
+                this->push(value);
+
+                if (!is.good() && !is.eof()) {
+                    throw std::runtime_error("Input stream failed during data reading");
+                }
+            }
+
+            if (is.eof()) {
+                is.clear();
+            }
+
+            if (is.fail() && !is.eof()) {
+                throw std::runtime_error("Failed to parse input data");
+            }
+
+            return is;
+
+        }
+        catch (...) {
+            header->tail = header->head + oldSize;
+            throw;
+        }
+
+    }
+    catch (const std::exception& e)
+    {
+        is.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("MappedQueue input failed: ") + e.what());
+    }
+}
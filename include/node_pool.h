@@ -0,0 +1,233 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+/**
+ * @brief Free-list memory pool that hands out fixed-size blocks carved from slabs
+ * 
+ * Blocks are grouped into size classes (multiples of the fundamental alignment).
+ * Freed blocks are kept on a per-class free list and reused by the next allocation
+ * of the same class, so a container in steady state (as many pushes as pops) does
+ * not touch the global heap at all. Slabs are only returned when the pool is
+ * released or destroyed. The pool is not thread-safe.
+ */
+class NodePool {
+public:
+    static constexpr size_t granularity = alignof(std::max_align_t); ///< Size class step and block alignment
+    static constexpr size_t max_block_size = 256;                    ///< Largest request served from slabs
+    static constexpr size_t default_blocks_per_slab = 64;            ///< Blocks carved from each new slab
+
+    /**
+     * @brief Constructs an empty pool
+     * @param blocks_per_slab Number of blocks allocated at once when a free list runs dry
+     */
+    explicit NodePool(size_t blocks_per_slab = default_blocks_per_slab);
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /**
+     * @brief Destructor - returns every slab to the global heap
+     */
+    ~NodePool();
+
+    /**
+     * @brief Allocates a block of at least the requested size
+     * @param bytes Requested size in bytes
+     * @param alignment Requested alignment
+     * @return Pointer to uninitialized storage
+     * @throws std::bad_alloc if a new slab cannot be allocated
+     */
+    void* allocate(size_t bytes, size_t alignment);
+
+    /**
+     * @brief Returns a block obtained from allocate() with the same size and alignment
+     * @param p Block to return
+     * @param bytes Size passed to allocate()
+     * @param alignment Alignment passed to allocate()
+     */
+    void deallocate(void* p, size_t bytes, size_t alignment) noexcept;
+
+    /**
+     * @brief Makes sure the next count allocations of this size are served without a refill
+     * @param bytes Size of the blocks that will be requested
+     * @param alignment Alignment of the blocks that will be requested
+     * @param count Number of blocks needed
+     * @throws std::bad_alloc if a new slab cannot be allocated
+     * 
+     * Any shortfall is carved from a single slab sized for it, so building a chain of
+     * count nodes costs one heap allocation at most.
+     */
+    void reserve(size_t bytes, size_t alignment, size_t count);
+
+    /**
+     * @brief Checks whether requests of this shape are carved from slabs
+     * @param bytes Requested size in bytes
+     * @param alignment Requested alignment
+     * @return True if served from a slab, false if forwarded to the global heap
+     */
+    static bool is_pooled(size_t bytes, size_t alignment) noexcept;
+
+    /**
+     * @brief Frees all slabs at once, invalidating every block handed out so far
+     * 
+     * Blocks that were not pooled (see is_pooled()) are not tracked and must still be
+     * returned through deallocate().
+     */
+    void release() noexcept;
+
+    /**
+     * @brief Returns the number of slabs currently owned by the pool
+     * @return Slab count
+     */
+    size_t slab_count() const noexcept;
+
+private:
+    struct free_block {
+        free_block* next;
+    };
+
+    struct slab_header {
+        slab_header* next;
+    };
+
+    static constexpr size_t class_count = max_block_size / granularity;
+    static constexpr size_t header_size = (sizeof(slab_header) + granularity - 1) / granularity * granularity;
+
+    static size_t class_index(size_t bytes) noexcept;
+
+    /**
+     * @brief Carves a new slab into free blocks of one size class
+     * @param index Size class to refill
+     * @param blocks Number of blocks in the slab
+     */
+    void refill(size_t index, size_t blocks);
+
+    free_block* freeLists[class_count]; ///< Free list head for each size class
+    size_t freeCounts[class_count];     ///< Number of blocks on each free list
+    slab_header* slabs;                 ///< Singly linked list of owned slabs
+    size_t slabCount;                   ///< Number of owned slabs
+    size_t blocksPerSlab;               ///< Blocks carved from each slab
+};
+
+/**
+ * @brief std::allocator-compatible allocator drawing its storage from a shared NodePool
+ * @tparam T Type of objects allocated
+ * 
+ * Copies and rebound copies share the same pool and compare equal. Copy-constructing
+ * a container selects a fresh pool, so every container owns its pool unless the user
+ * hands the same allocator to several containers explicitly.
+ */
+template<typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template<typename U>
+    struct rebind {
+        using other = PoolAllocator<U>;
+    };
+
+    /**
+     * @brief Default constructor - creates an allocator with its own new pool
+     */
+    PoolAllocator();
+
+    /**
+     * @brief Constructs an allocator that draws from an existing pool
+     * @param pool Pool to share (must not be null)
+     */
+    explicit PoolAllocator(std::shared_ptr<NodePool> pool) noexcept;
+
+    /**
+     * @brief Copy constructor - shares the pool; moving an allocator copies it as well
+     * @param other Allocator to share the pool with
+     */
+    PoolAllocator(const PoolAllocator& other) noexcept = default;
+
+    /**
+     * @brief Copy assignment - starts sharing the pool of another allocator
+     * @param other Allocator to share the pool with
+     * @return Reference to this allocator
+     */
+    PoolAllocator& operator=(const PoolAllocator& other) noexcept = default;
+
+    /**
+     * @brief Rebinding copy constructor - shares the pool of another allocator
+     * @param other Allocator to share the pool with
+     */
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept;
+
+    /**
+     * @brief Allocates storage for n objects
+     * @param n Number of objects
+     * @return Pointer to uninitialized storage
+     * @throws std::bad_alloc if allocation fails
+     */
+    T* allocate(size_t n);
+
+    /**
+     * @brief Returns storage obtained from allocate()
+     * @param p Storage to return
+     * @param n Number of objects passed to allocate()
+     */
+    void deallocate(T* p, size_t n) noexcept;
+
+    /**
+     * @brief Prepares the pool for count single-object allocations
+     * @param count Number of objects that will be allocated one at a time
+     * @throws std::bad_alloc if a new slab cannot be allocated
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Allocator used by a copy-constructed container: a fresh, unshared pool
+     * @return New allocator with its own pool
+     */
+    PoolAllocator select_on_container_copy_construction() const;
+
+    /**
+     * @brief Returns the pool this allocator draws from
+     * @return Reference to the shared pool
+     */
+    NodePool& pool() const noexcept;
+
+    /**
+     * @brief Checks whether this allocator is the only owner of its pool
+     * @return True if no other allocator shares the pool
+     */
+    bool owns_pool_exclusively() const noexcept;
+
+    /**
+     * @brief Frees every slab of the pool at once if no other allocator shares it
+     * @return True if the pool was released, false if it is shared (or T is too large to be
+     *         pooled) and nothing happened
+     * 
+     * Lets a container that owns its pool drop all of its nodes without visiting them.
+     */
+    bool release_exclusive() noexcept;
+
+    template<typename U>
+    friend class PoolAllocator;
+
+    template<typename U, typename V>
+    friend bool operator==(const PoolAllocator<U>& lhs, const PoolAllocator<V>& rhs) noexcept;
+
+private:
+    std::shared_ptr<NodePool> sharedPool; ///< Pool shared by all copies of this allocator
+};
+
+template<typename U, typename V>
+bool operator==(const PoolAllocator<U>& lhs, const PoolAllocator<V>& rhs) noexcept;
+
+template<typename U, typename V>
+bool operator!=(const PoolAllocator<U>& lhs, const PoolAllocator<V>& rhs) noexcept;
+
+#include "node_pool.ipp"
@@ -0,0 +1,138 @@
+#include "node_pool.h"
+
+// NodePool
+inline NodePool::NodePool(size_t blocks_per_slab)
+    : freeLists{}, freeCounts{}, slabs(nullptr), slabCount(0), blocksPerSlab(blocks_per_slab ? blocks_per_slab : 1) {}
+
+inline NodePool::~NodePool() {
+    release();
+}
+
+inline bool NodePool::is_pooled(size_t bytes, size_t alignment) noexcept {
+    return bytes != 0 && bytes <= max_block_size && alignment <= granularity;
+}
+
+inline size_t NodePool::class_index(size_t bytes) noexcept {
+    return (bytes + granularity - 1) / granularity - 1;
+}
+
+inline void* NodePool::allocate(size_t bytes, size_t alignment) {
+    if (!is_pooled(bytes, alignment)) {
+        return ::operator new(bytes, std::align_val_t(alignment));
+    }
+
+    size_t index = class_index(bytes);
+    if (freeLists[index] == nullptr) refill(index, blocksPerSlab);
+
+    free_block* block = freeLists[index];
+    freeLists[index] = block->next;
+    --freeCounts[index];
+    return block;
+}
+
+inline void NodePool::deallocate(void* p, size_t bytes, size_t alignment) noexcept {
+    if (!is_pooled(bytes, alignment)) {
+        ::operator delete(p, std::align_val_t(alignment));
+        return;
+    }
+
+    size_t index = class_index(bytes);
+    free_block* block = ::new (p) free_block{freeLists[index]};
+    freeLists[index] = block;
+    ++freeCounts[index];
+}
+
+inline void NodePool::reserve(size_t bytes, size_t alignment, size_t count) {
+    if (!is_pooled(bytes, alignment)) return;
+
+    size_t index = class_index(bytes);
+    if (freeCounts[index] < count) refill(index, count - freeCounts[index]);
+}
+
+inline void NodePool::refill(size_t index, size_t blocks) {
+    const size_t blockSize = (index + 1) * granularity;
+    char* raw = static_cast<char*>(::operator new(header_size + blockSize * blocks));
+
+    slabs = ::new (raw) slab_header{slabs};
+    ++slabCount;
+
+    // Thread the fresh blocks onto the free list back to front so they come out in address order
+    char* first = raw + header_size;
+    for (size_t i = blocks; i-- > 0;) {
+        freeLists[index] = ::new (first + i * blockSize) free_block{freeLists[index]};
+    }
+    freeCounts[index] += blocks;
+}
+
+inline void NodePool::release() noexcept {
+    while (slabs != nullptr) {
+        slab_header* temp = slabs;
+        slabs = slabs->next;
+        ::operator delete(temp);
+    }
+    slabCount = 0;
+    for (free_block*& head : freeLists) head = nullptr;
+    for (size_t& count : freeCounts) count = 0;
+}
+
+inline size_t NodePool::slab_count() const noexcept {
+    return slabCount;
+}
+
+// PoolAllocator
+template<typename T>
+PoolAllocator<T>::PoolAllocator() : sharedPool(std::make_shared<NodePool>()) {}
+
+template<typename T>
+PoolAllocator<T>::PoolAllocator(std::shared_ptr<NodePool> pool) noexcept : sharedPool(std::move(pool)) {}
+
+template<typename T>
+template<typename U>
+PoolAllocator<T>::PoolAllocator(const PoolAllocator<U>& other) noexcept : sharedPool(other.sharedPool) {}
+
+template<typename T>
+T* PoolAllocator<T>::allocate(size_t n) {
+    return static_cast<T*>(sharedPool->allocate(n * sizeof(T), alignof(T)));
+}
+
+template<typename T>
+void PoolAllocator<T>::deallocate(T* p, size_t n) noexcept {
+    sharedPool->deallocate(p, n * sizeof(T), alignof(T));
+}
+
+template<typename T>
+void PoolAllocator<T>::reserve(size_t count) {
+    sharedPool->reserve(sizeof(T), alignof(T), count);
+}
+
+template<typename T>
+PoolAllocator<T> PoolAllocator<T>::select_on_container_copy_construction() const {
+    return PoolAllocator<T>();
+}
+
+template<typename T>
+NodePool& PoolAllocator<T>::pool() const noexcept {
+    return *sharedPool;
+}
+
+template<typename T>
+bool PoolAllocator<T>::owns_pool_exclusively() const noexcept {
+    return sharedPool.use_count() == 1;
+}
+
+template<typename T>
+bool PoolAllocator<T>::release_exclusive() noexcept {
+    if (!NodePool::is_pooled(sizeof(T), alignof(T)) || !owns_pool_exclusively()) return false;
+    sharedPool->release();
+    return true;
+}
+
+template<typename U, typename V>
+bool operator==(const PoolAllocator<U>& lhs, const PoolAllocator<V>& rhs) noexcept {
+    return lhs.sharedPool == rhs.sharedPool;
+}
+
+template<typename U, typename V>
+bool operator!=(const PoolAllocator<U>& lhs, const PoolAllocator<V>& rhs) noexcept {
+    return !(lhs == rhs);
+}
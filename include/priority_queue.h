@@ -0,0 +1,528 @@
+#pragma once
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "fwd_container.h"
+#include "stream_parse.h"
+
+/**
+ * @brief Priority queue backed by an implicit d-ary heap in one contiguous array
+ * @tparam T Type of elements stored in the queue
+ * @tparam Compare Strict weak ordering; the element that compares greatest is popped first (default: std::less<T>)
+ * @tparam Alloc Allocator for the heap array (default: std::allocator<T>)
+ * @tparam Arity Number of children per heap node (default: 4)
+ *
+ * get_front() and pop() serve the most urgent element; push and pop run in
+ * O(log n). A 4-ary heap is half as deep as a binary one and keeps the children of a
+ * node next to each other, so sifting down touches fewer cache lines. Ranges are
+ * added by appending and restoring the heap once, in O(n) instead of O(n log n).
+ * Iteration visits the elements in heap (not priority) order.
+ *
+ * If Compare or a move of T throws while the heap is being restored, every element is
+ * still held exactly once (except the one pop() was removing), but the heap order may be
+ * broken until clear() or assignment.
+ * A move assignment of T that throws while putting the displaced element back is not
+ * recoverable and loses that element.
+ */
+template<typename T, typename Compare = std::less<T>, typename Alloc = std::allocator<T>, size_t Arity = 4>
+class PriorityQueue final : public fwd_container<T> {
+    static_assert(Arity >= 2, "A heap node needs at least two children");
+
+public:
+    /**
+     * @brief Iterator implementation for PriorityQueue (non-const version)
+     *
+     * Changing an element through it in a way that alters its priority breaks the heap.
+     */
+    class priority_queue_iterator {
+    private:
+        T* current; ///< Current slot of the heap array
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = T*;
+        using reference         = T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Constructor
+         * @param slot Starting slot for iteration (default: nullptr)
+         */
+        priority_queue_iterator(T* slot = nullptr) : current(slot) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Reference to the current element
+         */
+        T& operator*() const {
+            return *current;
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Pointer to the current element
+         */
+        T* operator->() const {
+            return current;
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        priority_queue_iterator& operator++() {
+            ++current;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        priority_queue_iterator operator++(int) {
+            priority_queue_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Advance by several elements, in constant time
+         * @param n Number of elements to skip (at most the distance to the end)
+         * @return Reference to this iterator
+         */
+        priority_queue_iterator& skip(size_t n) {
+            current += n;
+            return *this;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same slot
+         */
+        friend bool operator==(const priority_queue_iterator& lhs, const priority_queue_iterator& rhs) {
+            return lhs.current == rhs.current;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different slots
+         */
+        friend bool operator!=(const priority_queue_iterator& lhs, const priority_queue_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the current slot
+         * @return Pointer to the current slot
+         */
+        T* get_slot() const { return current; }
+    };
+
+    /**
+     * @brief Const iterator implementation for PriorityQueue
+     */
+    class priority_queue_const_iterator {
+    private:
+        const T* current; ///< Current slot of the heap array
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = const T*;
+        using reference         = const T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Constructor
+         * @param slot Starting slot for iteration (default: nullptr)
+         */
+        priority_queue_const_iterator(const T* slot = nullptr) : current(slot) {}
+
+        /**
+         * @brief Constructor from non-const iterator
+         * @param other Iterator to convert from
+         */
+        priority_queue_const_iterator(const priority_queue_iterator& other) : current(other.get_slot()) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Const reference to the current element
+         */
+        const T& operator*() const {
+            return *current;
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Const pointer to the current element
+         */
+        const T* operator->() const {
+            return current;
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        priority_queue_const_iterator& operator++() {
+            ++current;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        priority_queue_const_iterator operator++(int) {
+            priority_queue_const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Advance by several elements, in constant time
+         * @param n Number of elements to skip (at most the distance to the end)
+         * @return Reference to this iterator
+         */
+        priority_queue_const_iterator& skip(size_t n) {
+            current += n;
+            return *this;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same slot
+         */
+        friend bool operator==(const priority_queue_const_iterator& lhs, const priority_queue_const_iterator& rhs) {
+            return lhs.current == rhs.current;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different slots
+         */
+        friend bool operator!=(const priority_queue_const_iterator& lhs, const priority_queue_const_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the current slot
+         * @return Const pointer to the current slot
+         */
+        const T* get_slot() const { return current; }
+    };
+
+    using iterator = priority_queue_iterator;
+    using const_iterator = priority_queue_const_iterator;
+    using allocator_type = Alloc;
+    using value_compare = Compare;
+
+    static constexpr size_t arity = Arity; ///< Children per heap node
+
+    /**
+     * @brief Default constructor - creates an empty priority queue
+     */
+    PriorityQueue();
+
+    /**
+     * @brief Creates an empty priority queue with the given ordering and allocator
+     * @param compare Ordering of the elements
+     * @param alloc Allocator for the heap array
+     */
+    explicit PriorityQueue(const Compare& compare, const Alloc& alloc = Alloc());
+
+    /**
+     * @brief Builds a priority queue from a range in linear time
+     * @tparam InputIt Input iterator whose elements are convertible to T
+     * @param first Iterator to the first element
+     * @param last Iterator past the last element
+     * @param compare Ordering of the elements
+     * @param alloc Allocator for the heap array
+     * @throws std::runtime_error if memory allocation fails
+     */
+    template<typename InputIt>
+    PriorityQueue(InputIt first, InputIt last, const Compare& compare = Compare(), const Alloc& alloc = Alloc());
+
+    /**
+     * @brief Copy constructor
+     * @param other Priority queue to copy from
+     */
+    PriorityQueue(const PriorityQueue& other) = default;
+
+    /**
+     * @brief Move constructor
+     * @param other Priority queue to move from (left empty)
+     */
+    PriorityQueue(PriorityQueue&& other) noexcept;
+
+    /**
+     * @brief Copy assignment operator
+     * @param other Priority queue to copy from
+     * @return Reference to this priority queue
+     */
+    PriorityQueue& operator=(const PriorityQueue& other);
+
+    /**
+     * @brief Move assignment operator
+     * @param other Priority queue to move from (left empty)
+     * @return Reference to this priority queue
+     */
+    PriorityQueue& operator=(PriorityQueue&& other);
+
+    /**
+     * @brief Destructor
+     */
+    ~PriorityQueue() = default;
+
+    // fwd_container interface implementation
+    /**
+     * @brief Add an element (copy semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     */
+    void push(const T& value) override;
+
+    /**
+     * @brief Add an element (move semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     */
+    void push(T&& value) override;
+
+    /**
+     * @brief Construct an element in place and sift it into position
+     * @param args Arguments forwarded to the T constructor
+     * @throws std::runtime_error if memory allocation fails
+     *
+     * Returns nothing: the new element may move anywhere in the heap.
+     */
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    /**
+     * @brief Remove and return the most urgent element
+     * @return The removed element
+     * @throws std::runtime_error if the priority queue is empty
+     */
+    T pop() override;
+
+    /**
+     * @brief Get reference to the most urgent element
+     * @return Reference to the top of the heap (changing its priority breaks the heap)
+     * @throws std::runtime_error if the priority queue is empty
+     */
+    T& get_front() override;
+
+    /**
+     * @brief Get const reference to the most urgent element
+     * @return Const reference to the top of the heap
+     * @throws std::runtime_error if the priority queue is empty
+     */
+    const T& get_front() const override;
+
+    /**
+     * @brief Check if the priority queue is empty
+     * @return True if it holds no elements
+     */
+    bool is_empty() const override;
+
+    /**
+     * @brief Get the number of elements
+     * @return Size of the priority queue
+     */
+    size_t size() const override;
+
+    /**
+     * @brief Add a range of elements
+     * @tparam InputIt Input iterator whose elements are convertible to T
+     * @param first Iterator to the first element to add
+     * @param last Iterator past the last element to add
+     * @throws std::runtime_error if memory allocation fails (the priority queue is left unchanged)
+     *
+     * The elements are appended first. A range at least as large as the queue is
+     * merged by rebuilding the whole heap; a smaller one is sifted up element by element.
+     */
+    template<typename InputIt>
+    void push_range(InputIt first, InputIt last);
+
+    /**
+     * @brief Add a range of elements
+     * @param first Pointer to the first element to add
+     * @param last Pointer past the last element to add
+     * @throws std::runtime_error if memory allocation fails (the priority queue is left unchanged)
+     */
+    void push_range(const T* first, const T* last) override;
+
+    /**
+     * @brief Add the elements stored by save()
+     * @param is Input stream (should be opened in binary mode)
+     * @return Reference to the input stream
+     * @throws std::runtime_error if the data is malformed or memory allocation fails
+     *
+     * The elements are decoded straight into the heap array and merged as by
+     * push_range(); on failure the priority queue is left as it was.
+     */
+    std::istream& load(std::istream& is) override;
+
+    /**
+     * @brief Assignment from any fwd_container
+     * @param other Container to copy from
+     * @return Reference to this priority queue
+     * @throws std::runtime_error if memory allocation fails
+     *
+     * Ordering does not depend on where the elements come from, so any container is
+     * accepted: another priority queue of this type is copied as is, the elements of
+     * anything else are collected and heapified.
+     */
+    PriorityQueue& operator=(const fwd_container<T>& other) override;
+
+    /**
+     * @brief Get iterator to the beginning of the heap array
+     * @return Iterator to the most urgent element
+     */
+    iterator begin();
+
+    /**
+     * @brief Get iterator to the end of the heap array
+     * @return Iterator to the position after the last element
+     */
+    iterator end();
+
+    /**
+     * @brief Get const iterator to the beginning of the heap array
+     * @return Const iterator to the most urgent element
+     */
+    const_iterator begin() const;
+
+    /**
+     * @brief Get const iterator to the end of the heap array
+     * @return Const iterator to the position after the last element
+     */
+    const_iterator end() const;
+
+    /**
+     * @brief Get const iterator to the beginning of the heap array
+     * @return Const iterator to the most urgent element
+     */
+    const_iterator cbegin() const;
+
+    /**
+     * @brief Get const iterator to the end of the heap array
+     * @return Const iterator to the position after the last element
+     */
+    const_iterator cend() const;
+
+    /**
+     * @brief Returns the most urgent element
+     * @return Const reference to the top of the heap
+     * @throws std::runtime_error if the priority queue is empty
+     */
+    const T& top() const;
+
+    /**
+     * @brief Reserve room in the heap array
+     * @param count Number of elements to make room for
+     * @throws std::runtime_error if memory allocation fails
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Removes all elements, keeping the heap array for reuse
+     */
+    void clear();
+
+    /**
+     * @brief Checks if the priority queue is empty
+     * @return true if it holds no elements
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns a copy of the ordering
+     * @return The comparison object
+     */
+    Compare value_comp() const;
+
+    /**
+     * @brief Returns a copy of the allocator of the heap array
+     * @return The allocator
+     */
+    Alloc get_allocator() const;
+
+protected:
+    /**
+     * @brief Create a polymorphic iterator to the beginning of the heap array
+     * @return Type-erased iterator to the first element
+     */
+    typename fwd_container<T>::iterator make_begin() override;
+
+    /**
+     * @brief Create a polymorphic iterator to the end of the heap array
+     * @return Type-erased iterator to the position after the last element
+     */
+    typename fwd_container<T>::iterator make_end() override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the beginning of the heap array
+     * @return Type-erased const iterator to the first element
+     */
+    typename fwd_container<T>::const_iterator make_begin() const override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the end of the heap array
+     * @return Type-erased const iterator to the position after the last element
+     */
+    typename fwd_container<T>::const_iterator make_end() const override;
+
+    /**
+     * @brief Print the elements in heap order
+     * @param os Output stream
+     * @return Reference to the output stream
+     */
+    virtual std::ostream& print(std::ostream& os) const override;
+
+    /**
+     * @brief Read whitespace-separated elements and add them as by push_range()
+     * @param is Input stream
+     * @return Reference to the input stream
+     */
+    virtual std::istream& read(std::istream& is) override;
+
+private:
+    /**
+     * @brief Moves the element at index towards the root until its parent is at least as urgent
+     * @param index Slot of the element to sift
+     */
+    void sift_up(size_t index);
+
+    /**
+     * @brief Moves the element at index towards the leaves until no child is more urgent
+     * @param index Slot of the element to sift
+     */
+    void sift_down(size_t index);
+
+    /**
+     * @brief Restores the heap after elements were appended behind the first oldSize ones
+     * @param oldSize Number of elements that already formed a heap
+     */
+    void merge_appended(size_t oldSize);
+
+    std::vector<T, Alloc> heap; ///< Heap array; heap[0] is the most urgent element
+    Compare compare;            ///< Ordering of the elements
+};
+
+#include "priority_queue.ipp"
@@ -0,0 +1,405 @@
+#include "priority_queue.h"
+
+// PriorityQueue constructors and operators
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+PriorityQueue<T, Compare, Alloc, Arity>::PriorityQueue() : heap(), compare() {}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+PriorityQueue<T, Compare, Alloc, Arity>::PriorityQueue(const Compare& order, const Alloc& alloc)
+    : heap(alloc), compare(order) {}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+template<typename InputIt>
+PriorityQueue<T, Compare, Alloc, Arity>::PriorityQueue(InputIt first, InputIt last, const Compare& order, const Alloc& alloc)
+    : heap(alloc), compare(order) {
+    push_range(first, last);
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+PriorityQueue<T, Compare, Alloc, Arity>::PriorityQueue(PriorityQueue&& other) noexcept
+    : heap(std::move(other.heap)), compare(other.compare) {
+    other.heap.clear();
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+auto PriorityQueue<T, Compare, Alloc, Arity>::operator=(const PriorityQueue& other) -> PriorityQueue& {
+    if (this != &other) {
+        heap = other.heap;
+        compare = other.compare;
+    }
+    return *this;
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+auto PriorityQueue<T, Compare, Alloc, Arity>::operator=(PriorityQueue&& other) -> PriorityQueue& {
+    if (this != &other) {
+        heap = std::move(other.heap);
+        compare = other.compare;
+        other.heap.clear();
+    }
+    return *this;
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+auto PriorityQueue<T, Compare, Alloc, Arity>::operator=(const fwd_container<T>& other) -> PriorityQueue& {
+    if (this == &other) return *this;
+
+    if (const PriorityQueue* derived = dynamic_cast<const PriorityQueue*>(&other)) {
+        return *this = *derived;
+    }
+
+    try {
+        std::vector<T, Alloc> elements(heap.get_allocator());
+        elements.reserve(other.size());
+        for (const T& value : other) elements.push_back(value);
+        heap.swap(elements);
+        merge_appended(0);
+    }
+    catch (const std::bad_alloc& e) {
+        throw std::runtime_error("Memory allocation failed during copy assignment: " + std::string(e.what()));
+    }
+    return *this;
+}
+
+// Heap maintenance
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+void PriorityQueue<T, Compare, Alloc, Arity>::sift_up(size_t index) {
+    T value = std::move(heap[index]);
+    try {
+        while (index > 0) {
+            size_t parent = (index - 1) / Arity;
+            if (!compare(heap[parent], value)) break;
+            heap[index] = std::move(heap[parent]);
+            index = parent;
+        }
+    }
+    catch (...) {
+        // heap[index] is the hole value was lifted out of; fill it so no element is lost
+        heap[index] = std::move(value);
+        throw;
+    }
+    heap[index] = std::move(value);
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+void PriorityQueue<T, Compare, Alloc, Arity>::sift_down(size_t index) {
+    const size_t count = heap.size();
+    T value = std::move(heap[index]);
+
+    try {
+        while (true) {
+            size_t first = index * Arity + 1;
+            if (first >= count) break;
+
+            // The children of a node are adjacent, so picking the most urgent one scans one block
+            size_t last = first + Arity < count ? first + Arity : count;
+            size_t best = first;
+            for (size_t child = first + 1; child < last; ++child) {
+                if (compare(heap[best], heap[child])) best = child;
+            }
+
+            if (!compare(value, heap[best])) break;
+            heap[index] = std::move(heap[best]);
+            index = best;
+        }
+    }
+    catch (...) {
+        heap[index] = std::move(value);
+        throw;
+    }
+    heap[index] = std::move(value);
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+void PriorityQueue<T, Compare, Alloc, Arity>::merge_appended(size_t oldSize) {
+    const size_t count = heap.size();
+    if (count - oldSize >= oldSize) {
+        // Rebuilding bottom-up is linear, cheaper than sifting in as many elements as there were
+        if (count < 2) return;
+        for (size_t i = (count - 2) / Arity + 1; i-- > 0;) sift_down(i);
+    } else {
+        for (size_t i = oldSize; i < count; ++i) sift_up(i);
+    }
+}
+
+// fwd_container interface implementation
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+void PriorityQueue<T, Compare, Alloc, Arity>::push(const T& value) {
+    emplace(value);
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+void PriorityQueue<T, Compare, Alloc, Arity>::push(T&& value) {
+    emplace(std::move(value));
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+template<typename... Args>
+void PriorityQueue<T, Compare, Alloc, Arity>::emplace(Args&&... args) {
+    try {
+        heap.emplace_back(std::forward<Args>(args)...);
+    }
+    catch (const std::bad_alloc& e) {
+        throw std::runtime_error("Failed to allocate memory for new priority queue element: " + std::string(e.what()));
+    }
+    sift_up(heap.size() - 1);
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+T PriorityQueue<T, Compare, Alloc, Arity>::pop() {
+    if (is_empty()) throw std::runtime_error("Cannot pop: PriorityQueue is empty");
+
+    T value = std::move(heap.front());
+    if (heap.size() > 1) {
+        heap.front() = std::move(heap.back());
+        heap.pop_back();
+        sift_down(0);
+    } else {
+        heap.pop_back();
+    }
+    return value;
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+T& PriorityQueue<T, Compare, Alloc, Arity>::get_front() {
+    if (is_empty()) throw std::runtime_error("Cannot get front data: PriorityQueue is empty");
+    return heap.front();
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+const T& PriorityQueue<T, Compare, Alloc, Arity>::get_front() const {
+    if (is_empty()) throw std::runtime_error("Cannot get front data: PriorityQueue is empty");
+    return heap.front();
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+bool PriorityQueue<T, Compare, Alloc, Arity>::is_empty() const {
+    return heap.empty();
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+size_t PriorityQueue<T, Compare, Alloc, Arity>::size() const {
+    return heap.size();
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+template<typename InputIt>
+void PriorityQueue<T, Compare, Alloc, Arity>::push_range(InputIt first, InputIt last) {
+    const size_t oldSize = heap.size();
+    try {
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>) {
+            heap.reserve(oldSize + static_cast<size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) heap.emplace_back(*first);
+    }
+    catch (const std::bad_alloc& e) {
+        heap.erase(heap.begin() + oldSize, heap.end());
+        throw std::runtime_error("Failed to allocate memory for priority queue range: " + std::string(e.what()));
+    }
+    catch (...) {
+        heap.erase(heap.begin() + oldSize, heap.end());
+        throw;
+    }
+    merge_appended(oldSize);
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+void PriorityQueue<T, Compare, Alloc, Arity>::push_range(const T* first, const T* last) {
+    push_range<const T*>(first, last);
+}
+
+// Iteration
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+auto PriorityQueue<T, Compare, Alloc, Arity>::begin() -> iterator {
+    return iterator(heap.data());
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+auto PriorityQueue<T, Compare, Alloc, Arity>::end() -> iterator {
+    return iterator(heap.data() + heap.size());
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+auto PriorityQueue<T, Compare, Alloc, Arity>::begin() const -> const_iterator {
+    return const_iterator(heap.data());
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+auto PriorityQueue<T, Compare, Alloc, Arity>::end() const -> const_iterator {
+    return const_iterator(heap.data() + heap.size());
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+auto PriorityQueue<T, Compare, Alloc, Arity>::cbegin() const -> const_iterator {
+    return begin();
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+auto PriorityQueue<T, Compare, Alloc, Arity>::cend() const -> const_iterator {
+    return end();
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+typename fwd_container<T>::iterator PriorityQueue<T, Compare, Alloc, Arity>::make_begin() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(begin());
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+typename fwd_container<T>::iterator PriorityQueue<T, Compare, Alloc, Arity>::make_end() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(end());
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+typename fwd_container<T>::const_iterator PriorityQueue<T, Compare, Alloc, Arity>::make_begin() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(begin());
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+typename fwd_container<T>::const_iterator PriorityQueue<T, Compare, Alloc, Arity>::make_end() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(end());
+}
+
+// Other operations
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+const T& PriorityQueue<T, Compare, Alloc, Arity>::top() const {
+    return get_front();
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+void PriorityQueue<T, Compare, Alloc, Arity>::reserve(size_t count) {
+    try {
+        heap.reserve(count);
+    }
+    catch (const std::exception& e) {
+        throw std::runtime_error("Failed to reserve priority queue storage: " + std::string(e.what()));
+    }
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+void PriorityQueue<T, Compare, Alloc, Arity>::clear() {
+    heap.clear();
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+bool PriorityQueue<T, Compare, Alloc, Arity>::empty() const {
+    return is_empty();
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+Compare PriorityQueue<T, Compare, Alloc, Arity>::value_comp() const {
+    return compare;
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+Alloc PriorityQueue<T, Compare, Alloc, Arity>::get_allocator() const {
+    return heap.get_allocator();
+}
+
+// Stream operations
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+std::ostream& PriorityQueue<T, Compare, Alloc, Arity>::print(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+
+        bool first = true;
+        for (const T& value : heap) {
+            if (!first) {
+                os << " ";
+            }
+
+            if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+
+            os << value;
+            first = false;
+        }
+
+        if (!os.good()) throw std::runtime_error("Output stream failed after serialization");
+
+        return os;
+
+    } catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("PriorityQueue serialization failed: ") + e.what());
+    }
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+std::istream& PriorityQueue<T, Compare, Alloc, Arity>::read(std::istream& is) {
+    try {
+        if (!is.good()) {
+            throw std::runtime_error("Input stream is in bad state");
+        }
+
+        // Values are appended behind the heap and only merged once everything parsed,
+        // so rolling back is cutting the array back
+        const size_t oldSize = heap.size();
+
+        try {
+            bool parsed = false;
+            if constexpr (is_fast_parsable_v<T>) {
+                if (fast_parse_applies(is)) {
+                    parse_text_elements<T>(is, [this](T value) { heap.push_back(value); });
+                    parsed = true;
+                }
+            }
+            if (!parsed) {
+                T value;
+                while (is >> value) {
+                    heap.push_back(value);
+
+                    if (!is.good() && !is.eof()) {
+                        throw std::runtime_error("Input stream failed during data reading");
+                    }
+                }
+
+                if (is.eof()) {
+                    is.clear();
+                }
+
+                if (is.fail() && !is.eof()) {
+                    throw std::runtime_error("Failed to parse input data");
+                }
+            }
+        }
+        catch (const std::bad_alloc& e) {
+            heap.erase(heap.begin() + oldSize, heap.end());
+            throw std::runtime_error("Memory allocation failed during input: " + std::string(e.what()));
+        }
+        catch (...) {
+            heap.erase(heap.begin() + oldSize, heap.end());
+            throw;
+        }
+
+        merge_appended(oldSize);
+        return is;
+
+    }
+    catch (const std::exception& e)
+    {
+        is.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("PriorityQueue input failed: ") + e.what());
+    }
+}
+
+template<typename T, typename Compare, typename Alloc, size_t Arity>
+std::istream& PriorityQueue<T, Compare, Alloc, Arity>::load(std::istream& is) {
+    try {
+        if (!is.good()) throw std::runtime_error("Input stream is in bad state");
+        binary_header header = binary_read_header<T>(is);
+
+        const size_t oldSize = heap.size();
+        try {
+            binary_read_elements<T>(is, header.count, [this](T&& value) { heap.push_back(std::move(value)); });
+        }
+        catch (...) {
+            heap.erase(heap.begin() + oldSize, heap.end());
+            throw;
+        }
+        merge_appended(oldSize);
+        return is;
+    }
+    catch (const std::exception& e) {
+        is.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("PriorityQueue load failed: ") + e.what());
+    }
+}
@@ -1,41 +1,244 @@
 #pragma once
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <exception>
+#include <iterator>
 #include <sstream>
+#include <type_traits>
+#include <utility>
 
 #include "Node.h"
 #include "fwd_container.h"
+#include "instrumentation.h"
+#include "stream_parse.h"
 
 /**
  * @brief A queue implementation using linked nodes
  * @tparam T The type of elements stored in the queue
+ * @tparam Alloc Allocator for the elements, rebound internally to Node<T> (default: std::allocator<T>)
+ * @tparam Instrumentation Policy notified of pushes, pops, node allocations and size changes
+ *         (default: Uninstrumented; see Instrumented and stats())
  * 
  * This class implements a FIFO (First-In-First-Out) data structure
  * using a singly linked list of nodes.
  */
-template<typename T>
-class Queue : public fwd_container<T> {
+template<typename T, typename Alloc = std::allocator<T>, typename Instrumentation = Uninstrumented>
+class Queue final : public fwd_container<T>, private Instrumentation {
 public:
-    using iterator = typename fwd_container<T>::iterator;
-    using const_iterator = typename fwd_container<T>::const_iterator;
+    /**
+     * @brief Iterator implementation for Queue (non-const version)
+     * 
+     * Plain value type holding one node pointer; no virtual calls and no allocation.
+     */
+    class queue_iterator {
+    private:
+        Node<T>* current; ///< Current node pointer
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = T*;
+        using reference         = T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        queue_iterator() : current(nullptr) {}
+
+        /**
+         * @brief Constructor
+         * @param node Starting node for iteration
+         */
+        explicit queue_iterator(Node<T>* node) : current(node) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Reference to the current element
+         */
+        T& operator*() const {
+            return current->data;
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Pointer to the current element
+         */
+        T* operator->() const {
+            return &(current->data);
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        queue_iterator& operator++() {
+            current = current->next;
+            if (current) prefetch_node(current->next);
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        queue_iterator operator++(int) {
+            queue_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same node
+         */
+        friend bool operator==(const queue_iterator& lhs, const queue_iterator& rhs) {
+            return lhs.current == rhs.current;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different nodes
+         */
+        friend bool operator!=(const queue_iterator& lhs, const queue_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the current node pointer
+         * @return Pointer to current node
+         */
+        Node<T>* get_current() const { return current; }
+    };
+
+    /**
+     * @brief Const iterator implementation for Queue
+     * 
+     * Plain value type holding one node pointer; no virtual calls and no allocation.
+     */
+    class queue_const_iterator {
+    private:
+        const Node<T>* current; ///< Current node pointer
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = const T*;
+        using reference         = const T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        queue_const_iterator() : current(nullptr) {}
+
+        /**
+         * @brief Constructor
+         * @param node Starting node for iteration
+         */
+        explicit queue_const_iterator(const Node<T>* node) : current(node) {}
+
+        /**
+         * @brief Constructor from non-const iterator
+         * @param other Iterator to convert from
+         */
+        queue_const_iterator(const queue_iterator& other) : current(other.get_current()) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Const reference to the current element
+         */
+        const T& operator*() const {
+            return current->data;
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Const pointer to the current element
+         */
+        const T* operator->() const {
+            return &(current->data);
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        queue_const_iterator& operator++() {
+            current = current->next;
+            if (current) prefetch_node(current->next);
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        queue_const_iterator operator++(int) {
+            queue_const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same node
+         */
+        friend bool operator==(const queue_const_iterator& lhs, const queue_const_iterator& rhs) {
+            return lhs.current == rhs.current;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different nodes
+         */
+        friend bool operator!=(const queue_const_iterator& lhs, const queue_const_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the current node pointer
+         * @return Const pointer to current node
+         */
+        const Node<T>* get_current() const { return current; }
+    };
+
+    using iterator = queue_iterator;
+    using const_iterator = queue_const_iterator;
+    using allocator_type = Alloc;
 
     /**
      * @brief Default constructor - creates an empty queue
      */
     Queue();
 
+    /**
+     * @brief Creates an empty queue that allocates its nodes through the given allocator
+     * @param alloc Allocator to use for all nodes of this queue
+     */
+    explicit Queue(const Alloc& alloc);
+
     /**
      * @brief Copy constructor - creates a deep copy of another queue
      * @param other Queue to copy from
      * @throws std::runtime_error if memory allocation fails during copying
      */
-    Queue(const Queue<T>& other);
+    Queue(const Queue<T, Alloc, Instrumentation>& other);
 
     /**
      * @brief Move constructor - transfers ownership from another queue
      * @param other Queue to move from (will be left in valid but empty state)
      */
-    Queue(Queue<T>&& other);
+    Queue(Queue<T, Alloc, Instrumentation>&& other);
 
     /**
      * @brief Copy assignment operator
@@ -43,14 +246,14 @@ public:
      * @return Reference to this queue
      * @throws std::runtime_error if memory allocation fails during copying
      */
-    Queue<T>& operator=(const Queue<T>& other);
+    Queue<T, Alloc, Instrumentation>& operator=(const Queue<T, Alloc, Instrumentation>& other);
 
     /**
      * @brief Move assignment operator
      * @param other Queue to move from
      * @return Reference to this queue
      */
-    Queue<T>& operator=(Queue<T>&& other);
+    Queue<T, Alloc, Instrumentation>& operator=(Queue<T, Alloc, Instrumentation>&& other);
 
     /**
      * @brief Virtual destructor
@@ -69,6 +272,73 @@ public:
      * @param value The value to add
      */
     void push(T&& value) override;
+
+    /**
+     * @brief Construct an element in place on the back of the queue
+     * @param args Arguments forwarded to the T constructor
+     * @return Reference to the new element
+     * @throws std::runtime_error if the queue is full or memory allocation fails
+     */
+    template<typename... Args>
+    T& emplace(Args&&... args);
+
+    /**
+     * @brief Construct an element in place at the front of the queue, ahead of every waiting element
+     * @param args Arguments forwarded to the T constructor
+     * @return Reference to the new element
+     * @throws std::runtime_error if the queue is full or memory allocation fails
+     */
+    template<typename... Args>
+    T& emplace_front(Args&&... args);
+
+    /**
+     * @brief Add element to the back of the queue unless it is full (copy semantics)
+     * @param value The value to add
+     * @return True if the element was added, false if the queue was at capacity
+     * @throws std::runtime_error if memory allocation fails
+     */
+    bool try_push(const T& value);
+
+    /**
+     * @brief Add element to the back of the queue unless it is full (move semantics)
+     * @param value The value to add (left untouched if the queue is full)
+     * @return True if the element was added, false if the queue was at capacity
+     * @throws std::runtime_error if memory allocation fails
+     */
+    bool try_push(T&& value);
+
+    /**
+     * @brief Construct an element in place on the back of the queue unless it is full
+     * @param args Arguments forwarded to the T constructor
+     * @return True if the element was added, false if the queue was at capacity
+     * @throws std::runtime_error if memory allocation fails
+     */
+    template<typename... Args>
+    bool try_emplace(Args&&... args);
+
+    /**
+     * @brief Bound the number of elements the queue may hold
+     * @param capacity Maximum number of elements, or 0 to make the queue unbounded
+     * @throws std::runtime_error if the queue already holds more than capacity elements,
+     *         or if the node storage cannot be preallocated
+     * 
+     * Storage for every free slot is allocated up front and kept on a spare list, so a
+     * bounded queue never allocates in push and never frees in pop. Once the bound is
+     * reached, push and emplace throw while try_push reports failure.
+     */
+    void set_capacity(size_t capacity);
+
+    /**
+     * @brief Get the maximum number of elements the queue may hold
+     * @return Capacity set by set_capacity, or 0 if the queue is unbounded
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Check if a bounded queue has reached its capacity
+     * @return True if no further element can be pushed, false otherwise (always false when unbounded)
+     */
+    bool is_full() const;
     
     /**
      * @brief Remove and return element from the front of the queue
@@ -90,6 +360,31 @@ public:
      * @throws std::runtime_error if queue is empty
      */
     const T& get_front() const override;
+
+    /**
+     * @brief Remove the front element if there is one; never throws on empty
+     * @param out Receives the removed element
+     * @return True if an element was removed, false if the queue was empty
+     */
+    bool try_pop(T& out) override;
+
+    /**
+     * @brief Remove the front element if there is one; never throws on empty
+     * @return The removed element, or std::nullopt if the queue was empty
+     */
+    std::optional<T> try_pop() override;
+
+    /**
+     * @brief Get pointer to the front element
+     * @return Pointer to the front element, or nullptr if the queue is empty
+     */
+    T* try_front() noexcept override;
+
+    /**
+     * @brief Get const pointer to the front element
+     * @return Const pointer to the front element, or nullptr if the queue is empty
+     */
+    const T* try_front() const noexcept override;
     
     /**
      * @brief Check if queue is empty
@@ -103,49 +398,151 @@ public:
      */
     size_t size() const override;
 
+    /**
+     * @brief Add a range of elements to the back of the queue
+     * @tparam InputIt Input iterator whose elements are convertible to T
+     * @param first Iterator to the first element to add
+     * @param last Iterator past the last element to add
+     * @throws std::runtime_error if memory allocation fails (the queue is left unchanged)
+     * 
+     * All nodes are linked into a detached chain first and then attached with a single
+     * update of the rear pointer.
+     */
+    template<typename InputIt>
+    void push_range(InputIt first, InputIt last);
+
+    /**
+     * @brief Add a range of elements to the back of the queue
+     * @param first Pointer to the first element to add
+     * @param last Pointer past the last element to add
+     * @throws std::runtime_error if memory allocation fails (the queue is left unchanged)
+     */
+    void push_range(const T* first, const T* last) override;
+
+    /**
+     * @brief Remove n elements from the front of the queue, writing them in FIFO order to out
+     * @tparam OutputIt Output iterator accepting T
+     * @param n Number of elements to remove
+     * @param out Destination for the removed elements
+     * @return Iterator past the last element written
+     * @throws std::runtime_error if the queue holds fewer than n elements
+     * 
+     * Nodes are only released after every element has been written. Elements are moved
+     * out only if writing them through out cannot throw, and copied otherwise, so a
+     * throwing write leaves the queue unchanged (for a move-only T only the basic
+     * guarantee holds).
+     */
+    template<typename OutputIt>
+    OutputIt pop_n(size_t n, OutputIt out);
+
+    /**
+     * @brief Remove n elements from the front of the queue, writing them in FIFO order to out
+     * @param n Number of elements to remove
+     * @param out Destination for the removed elements
+     * @return Pointer past the last element written
+     * @throws std::runtime_error if the queue holds fewer than n elements
+     */
+    T* pop_n(size_t n, T* out) override;
+
+    /**
+     * @brief Remove every element of the queue, writing them in FIFO order to out
+     * @tparam OutputIt Output iterator accepting T
+     * @param out Destination for the removed elements
+     * @return Iterator past the last element written
+     */
+    template<typename OutputIt>
+    OutputIt drain_into(OutputIt out);
+
+    /**
+     * @brief Remove every element of the queue, writing them in FIFO order to out
+     * @param out Destination for the removed elements (must have room for size() elements)
+     * @return Pointer past the last element written
+     */
+    T* drain_into(T* out) override;
+
+    /**
+     * @brief Move every element of another queue to the back of this one
+     * @param other Queue to take the elements from (left empty)
+     * 
+     * Runs in constant time by relinking the node chain. If the two allocators compare
+     * unequal the nodes cannot be adopted, and the elements are moved one by one instead.
+     * @throws std::runtime_error if the combined size exceeds the capacity of this queue
+     */
+    void splice_back(Queue<T, Alloc, Instrumentation>&& other);
+
+    /**
+     * @brief Split the queue after the given position
+     * @param pos Iterator to the last element that stays in this queue
+     * @return Queue holding every element after pos, in order
+     * @throws std::runtime_error if pos is end()
+     * 
+     * No element is copied or moved; the cost is one walk over the detached tail to
+     * keep both sizes correct.
+     */
+    Queue<T, Alloc, Instrumentation> split_after(iterator pos);
+
+    /**
+     * @brief Write the queue in the binary format, front element first
+     * @param os Output stream (should be opened in binary mode)
+     * @return Reference to the output stream
+     * @throws std::runtime_error if an element cannot be encoded or the stream fails
+     */
+    std::ostream& save(std::ostream& os) const override;
+
+    /**
+     * @brief Append the elements stored by save() to the back of the queue
+     * @param is Input stream (should be opened in binary mode)
+     * @return Reference to the input stream
+     * @throws std::runtime_error if the data is malformed, does not fit the capacity or memory allocation fails
+     * 
+     * Elements are decoded straight into a detached chain of nodes, which is linked
+     * behind the rear only once the whole stream has been read.
+     */
+    std::istream& load(std::istream& is) override;
+
     /**
      * @brief Assignment from any fwd_container
      * @param other Container to copy from
      * @return Reference to this queue
      * @throws std::runtime_error if memory allocation fails
      */
-    Queue<T>& operator=(const fwd_container<T>& other) override;
+    Queue<T, Alloc, Instrumentation>& operator=(const fwd_container<T>& other) override;
     
     /**
      * @brief Get iterator to the beginning of the queue
      * @return Iterator to the first element
      */
-    iterator begin() override;
+    iterator begin();
     
     /**
      * @brief Get iterator to the end of the queue
      * @return Iterator to the position after the last element
      */
-    iterator end() override;
+    iterator end();
     
     /**
      * @brief Get const iterator to the beginning of the queue
      * @return Const iterator to the first element
      */
-    const_iterator begin() const override;
+    const_iterator begin() const;
     
     /**
      * @brief Get const iterator to the end of the queue
      * @return Const iterator to the position after the last element
      */
-    const_iterator end() const override;
+    const_iterator end() const;
     
     /**
      * @brief Get const iterator to the beginning of the queue
      * @return Const iterator to the first element
      */
-    const_iterator cbegin() const override;
+    const_iterator cbegin() const;
     
     /**
      * @brief Get const iterator to the end of the queue
      * @return Const iterator to the position after the last element
      */
-    const_iterator cend() const override;
+    const_iterator cend() const;
 
     /**
      * @brief Returns the number of elements in the queue
@@ -200,6 +597,23 @@ public:
      */
     void clear();
 
+    /**
+     * @brief Returns a copy of the allocator associated with the queue
+     * @return Allocator rebound back to the element type
+     */
+    Alloc get_allocator() const;
+
+    /**
+     * @brief Snapshot of the instrumentation counters (only with an enabled policy such as Instrumented)
+     * @return Pushes, pops, node allocations and frees, peak size and sampled latencies
+     */
+    ContainerStats stats() const;
+
+    /**
+     * @brief Sets the instrumentation counters back to zero and the peak size to the current size
+     */
+    void reset_stats();
+
     /**
      * @brief Checks if the queue is empty
      * @return true if queue is empty, false otherwise
@@ -207,6 +621,30 @@ public:
     bool empty() const;
 
 protected:
+    /**
+     * @brief Create a polymorphic iterator to the beginning of the queue
+     * @return Type-erased iterator to the first element
+     */
+    typename fwd_container<T>::iterator make_begin() override;
+
+    /**
+     * @brief Create a polymorphic iterator to the end of the queue
+     * @return Type-erased iterator to the position after the last element
+     */
+    typename fwd_container<T>::iterator make_end() override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the beginning of the queue
+     * @return Type-erased const iterator to the first element
+     */
+    typename fwd_container<T>::const_iterator make_begin() const override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the end of the queue
+     * @return Type-erased const iterator to the position after the last element
+     */
+    typename fwd_container<T>::const_iterator make_end() const override;
+
     /**
      * @brief Print queue contents to output stream
      * @param os Output stream
@@ -222,221 +660,92 @@ protected:
     virtual std::istream& read(std::istream& is) override;
 
 private:
+    using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node<T>>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
     /**
-     * @brief Iterator implementation for Queue (non-const version)
+     * @brief The instrumentation policy (an empty base unless instrumented)
+     * @return Reference to the policy object
      */
-    class queue_iterator : public fwd_container<T>::iterator_base {
-    private:
-        Node<T>* current; ///< Current node pointer
-        static constexpr int iterator_kind = 1;
-
-    public:
-        int get_iterator_kind() const noexcept override {
-            return iterator_kind;
-        }
+    Instrumentation& instrumentation() noexcept { return *this; }
 
-        /**
-         * @brief Constructor
-         * @param node Starting node for iteration
-         */
-        queue_iterator(Node<T>* node) : current(node) {}
-        
-        /**
-         * @brief Dereference operator
-         * @return Reference to the current element
-         */
-        T& operator*() override {
-            return current->data;
-        }
-        
-        /**
-         * @brief Member access operator
-         * @return Pointer to the current element
-         */
-        T* operator->() override {
-            return &(current->data);
-        }
-        
-        /**
-         * @brief Prefix increment operator
-         * @return Reference to this iterator
-         */
-        queue_iterator& operator++() override {
-            current = current->next;
-            return *this;
-        }
-        
-        /**
-         * @brief Equality comparison with iterator_base
-         * @param other The iterator to compare with
-         * @return True if iterators are equal
-         */
-        bool operator==(const typename fwd_container<T>::iterator_base& other) const override {
-            if (this->get_iterator_kind() != other.get_iterator_kind()) return false;
-            const queue_iterator* derived = static_cast<const queue_iterator*>(&other);
-            return derived && current == derived->current;
-        }
-        
-        /**
-         * @brief Inequality comparison with iterator_base
-         * @param other The iterator to compare with
-         * @return True if iterators are not equal
-         */
-        bool operator!=(const typename fwd_container<T>::iterator_base& other) const override {
-            return !(*this == other);
-        }
-        
-        /**
-         * @brief Equality comparison with const_iterator_base
-         * @param other The const iterator to compare with
-         * @return True if iterators are equal
-         */
-        bool operator==(const typename fwd_container<T>::const_iterator_base& other) const override {
-            if (this->get_iterator_kind() != other.get_iterator_kind()) return false;
-            const queue_const_iterator* derived = static_cast<const queue_const_iterator*>(&other);
-            return derived && current == derived->get_current(); 
-        }
-        
-        /**
-         * @brief Inequality comparison with const_iterator_base
-         * @param other The const iterator to compare with
-         * @return True if iterators are not equal
-         */
-        bool operator!=(const typename fwd_container<T>::const_iterator_base& other) const override {
-            return !(*this == other);
-        }
+    /**
+     * @brief Destroys the front element and unlinks its node (queue must not be empty)
+     */
+    void drop_front() noexcept;
 
-        /**
-         * @brief Create a const version of this iterator
-         * @return Pointer to new const_iterator_base
-         */
-        typename fwd_container<T>::const_iterator_base* create_const() const override {
-            return new queue_const_iterator(current);
-        }
+    /**
+     * @brief Construct a node, reusing spare storage when there is some
+     * @param args Arguments forwarded to the Node<T> constructor
+     * @return The new node
+     */
+    template<typename... Args>
+    Node<T>* acquire_node(Args&&... args);
 
-        /**
-         * @brief Get the current node pointer
-         * @return Pointer to current node
-         */
-        Node<T>* get_current() const { return current; }
+    /**
+     * @brief Destroy a node, keeping its storage as a spare while the queue is bounded
+     * @param node Node to destroy (already unlinked)
+     */
+    void recycle_node(Node<T>* node) noexcept;
 
-    protected:
-        /**
-         * @brief Clone this iterator
-         * @return Pointer to new cloned iterator
-         */
-        queue_iterator* clone() const override {
-            return new queue_iterator(current);
-        }
-        
-        friend class queue_const_iterator;
-    };
+    /**
+     * @brief Recycle every node of a detached chain
+     * @param head First node of the chain (may be nullptr)
+     */
+    void recycle_chain(Node<T>* head) noexcept;
 
     /**
-     * @brief Const iterator implementation for Queue
+     * @brief Free spare storage until at most keep blocks remain
+     * @param keep Number of spare blocks to retain
      */
-    class queue_const_iterator : public fwd_container<T>::const_iterator_base {
-    private:
-        const Node<T>* current; ///< Current node pointer
-        static constexpr int iterator_kind = 1;
+    void trim_spares(size_t keep) noexcept;
 
-    public:
-        int get_iterator_kind() const noexcept override {
-            return iterator_kind;
-        }
+    /**
+     * @brief Free every spare block
+     */
+    void release_spares() noexcept;
 
-        /**
-         * @brief Constructor
-         * @param node Starting node for iteration
-         */
-        queue_const_iterator(const Node<T>* node) : current(node) {}
-        
-        /**
-         * @brief Dereference operator
-         * @return Const reference to the current element
-         */
-        const T& operator*() const override {
-            return current->data;
-        }
-        
-        /**
-         * @brief Member access operator
-         * @return Const pointer to the current element
-         */
-        const T* operator->() const override {
-            return &(current->data);
-        }
-        
-        /**
-         * @brief Prefix increment operator
-         * @return Reference to this iterator
-         */
-        queue_const_iterator& operator++() override {
-            current = current->next;
-            return *this;
-        }
-        
-        /**
-         * @brief Equality comparison with const_iterator_base
-         * @param other The const iterator to compare with
-         * @return True if iterators are equal
-         */
-        bool operator==(const typename fwd_container<T>::const_iterator_base& other) const override {
-            if (this->get_iterator_kind() != other.get_iterator_kind()) return false;
-            const queue_const_iterator* derived = static_cast<const queue_const_iterator*>(&other);
-            return derived && current == derived->current;
-        }
-        
-        /**
-         * @brief Inequality comparison with const_iterator_base
-         * @param other The const iterator to compare with
-         * @return True if iterators are not equal
-         */
-        bool operator!=(const typename fwd_container<T>::const_iterator_base& other) const override {
-            return !(*this == other);
-        }
-        
-        /**
-         * @brief Equality comparison with iterator_base
-         * @param other The iterator to compare with
-         * @return True if iterators are equal
-         */
-        bool operator==(const typename fwd_container<T>::iterator_base& other) const override {
-            if (this->get_iterator_kind() != other.get_iterator_kind()) return false;
-            const queue_iterator* derived = static_cast<const queue_iterator*>(&other);
-            return derived && current == derived->get_current(); 
-        }
-        
-        /**
-         * @brief Inequality comparison with iterator_base
-         * @param other The iterator to compare with
-         * @return True if iterators are not equal
-         */
-        bool operator!=(const typename fwd_container<T>::iterator_base& other) const override {
-            return !(*this == other);
-        }
+    /**
+     * @brief Destroy every element after the given node, making it the rear again
+     * @param last Node that becomes the rear (nullptr empties the queue)
+     * @param count Number of elements up to and including last
+     */
+    void truncate_after(Node<T>* last, size_t count) noexcept;
 
-        /**
-         * @brief Get the current node pointer
-         * @return Const pointer to current node
-         */
-        const Node<T>* get_current() const { return current; }
+    /**
+     * @brief Copy count nodes into a detached chain, taking spare storage first
+     * @param source First node to copy
+     * @param count Number of nodes to copy
+     * @param last Receives the last node of the copy
+     * @return First node of the copy (nothing is leaked if a copy throws)
+     */
+    Node<T>* clone_chain(const Node<T>* source, size_t count, Node<T>*& last);
 
-    protected:
-        /**
-         * @brief Clone this iterator
-         * @return Pointer to new cloned const iterator
-         */
-        queue_const_iterator* clone() const override {
-            return new queue_const_iterator(current);
-        }
+    /**
+     * @brief Parse numbers up to the end of the stream and append them
+     * @param is Input stream
+     * @throws std::runtime_error if a token is not a number, the queue would overflow its
+     *         capacity or memory allocation fails; the queue is left unchanged
+     * 
+     * Values go into a detached chain that is linked behind the rear only once the
+     * whole input has been parsed.
+     */
+    void append_parsed(std::istream& is);
 
-        friend class queue_iterator;
+    /// Unconstructed node storage waiting on the spare list
+    struct spare_block {
+        spare_block* next; ///< Next spare block
     };
 
-    Node<T>* frontNode; ///< Pointer to the front node (for pop operations)
-    Node<T>* rearNode;  ///< Pointer to the rear node (for push operations)
-    size_t queueSize;   ///< Number of elements in the queue
+    static_assert(sizeof(spare_block) <= sizeof(Node<T>), "Node<T> must be able to hold a spare_block");
+
+    Node<T>* frontNode;      ///< Pointer to the front node (for pop operations)
+    Node<T>* rearNode;       ///< Pointer to the rear node (for push operations)
+    size_t queueSize;        ///< Number of elements in the queue
+    NodeAllocator nodeAlloc; ///< Allocator providing storage for the nodes
+    spare_block* spareNodes; ///< Preallocated node storage for a bounded queue
+    size_t spareCount;       ///< Number of blocks on the spare list
+    size_t queueCapacity;    ///< Maximum number of elements, 0 if unbounded
 };
 
 #include "queue.ipp"
\ No newline at end of file
@@ -1,46 +1,96 @@
 #include "queue.h"
 
 // Queue constructors and operators
-template<typename T>
-Queue<T>::Queue() : frontNode(nullptr), rearNode(nullptr), queueSize(0) {}
-
-template<typename T>
-Queue<T>::Queue(const Queue<T>& other) : frontNode(nullptr), rearNode(nullptr), queueSize(0) {
-    if (!other.is_empty()) {
-        Node<T>* current = other.frontNode;   
-
-        try {         
-            while (current != nullptr) {
-                push(current->data);
-                current = current->next;
-            }         
-        } 
-        catch (const std::bad_alloc& e) {
-            clear();
-            throw std::runtime_error("Memory allocation failed during copy construction: " + std::string(e.what()));
-        }
+template<typename T, typename Alloc, typename Instrumentation>
+Queue<T, Alloc, Instrumentation>::Queue() 
+    : frontNode(nullptr), rearNode(nullptr), queueSize(0), nodeAlloc(), spareNodes(nullptr), spareCount(0), queueCapacity(0) {}
+
+template<typename T, typename Alloc, typename Instrumentation>
+Queue<T, Alloc, Instrumentation>::Queue(const Alloc& alloc) 
+    : frontNode(nullptr), rearNode(nullptr), queueSize(0), nodeAlloc(alloc), spareNodes(nullptr), spareCount(0), queueCapacity(0) {}
+
+template<typename T, typename Alloc, typename Instrumentation>
+Queue<T, Alloc, Instrumentation>::Queue(const Queue<T, Alloc, Instrumentation>& other) 
+    : Instrumentation(), frontNode(nullptr), rearNode(nullptr), queueSize(0), nodeAlloc(NodeTraits::select_on_container_copy_construction(other.nodeAlloc)),
+      spareNodes(nullptr), spareCount(0), queueCapacity(0) {
+    try {         
+        frontNode = copy_chain(nodeAlloc, other.frontNode, other.queueSize, rearNode);
+        queueSize = other.queueSize;
+        instrumentation().record_allocations(queueSize);
+        instrumentation().record_size(queueSize);
+        if (other.queueCapacity != 0) set_capacity(other.queueCapacity);
+    } 
+    catch (const std::bad_alloc& e) {
+        clear();
+        release_spares();
+        throw std::runtime_error("Memory allocation failed during copy construction: " + std::string(e.what()));
+    }
+    catch (...) {
+        clear();
+        release_spares();
+        throw;
     }
 }
 
-template<typename T>
-Queue<T>::Queue(Queue<T>&& other) : frontNode(other.frontNode), rearNode(other.rearNode), queueSize(other.queueSize) {
+template<typename T, typename Alloc, typename Instrumentation>
+Queue<T, Alloc, Instrumentation>::Queue(Queue<T, Alloc, Instrumentation>&& other) 
+    : frontNode(other.frontNode), rearNode(other.rearNode), queueSize(other.queueSize), nodeAlloc(std::move(other.nodeAlloc)),
+      spareNodes(other.spareNodes), spareCount(other.spareCount), queueCapacity(other.queueCapacity) {
     other.frontNode = nullptr;
     other.rearNode = nullptr;
     other.queueSize = 0;
+    other.spareNodes = nullptr;
+    other.spareCount = 0;
+    other.queueCapacity = 0;
+    instrumentation().record_size(queueSize);
 }
 
-template<typename T>
-Queue<T>& Queue<T>::operator=(const Queue<T>& other) {
+template<typename T, typename Alloc, typename Instrumentation>
+Queue<T, Alloc, Instrumentation>& Queue<T, Alloc, Instrumentation>::operator=(const Queue<T, Alloc, Instrumentation>& other) {
     if (this != &other) {
-        clear();
-        queueSize = 0;   
-        Node<T>* current = other.frontNode;
+        if (queueCapacity != 0 && other.queueSize > queueCapacity) {
+            throw std::runtime_error("Cannot assign: source has more elements than the Queue capacity");
+        }
+        if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+            // Nodes of the allocator being replaced cannot be kept
+            if (nodeAlloc != other.nodeAlloc) {
+                clear();
+                release_spares();
+            }
+            nodeAlloc = other.nodeAlloc;
+        }
+
+        // Assign into the nodes both queues have, then free or add only the difference
+        Node<T>* target = frontNode;
+        const Node<T>* source = other.frontNode;
+        Node<T>* kept = nullptr;
+        size_t count = 0;
+        while (target != nullptr && source != nullptr) {
+            prefetch_node(target->next);
+            prefetch_node(source->next);
+            target->data = source->data;
+            kept = target;
+            target = target->next;
+            source = source->next;
+            ++count;
+        }
+
+        if (source == nullptr) {
+            truncate_after(kept, count);
+            return *this;
+        }
 
         try {
-            while (current != nullptr) {
-                push(current->data);
-                current = current->next;
-            }    
+            Node<T>* chainRear = nullptr;
+            Node<T>* chainFront = clone_chain(source, other.queueSize - count, chainRear);
+            if (rearNode == nullptr) {
+                frontNode = chainFront;
+            } else {
+                rearNode->next = chainFront;
+            }
+            rearNode = chainRear;
+            queueSize = other.queueSize;
+            instrumentation().record_size(queueSize);
         }
         catch(const std::bad_alloc& e) {
             throw std::runtime_error("Memory allocation failed during copy assignment: " + std::string(e.what()));
@@ -49,10 +99,26 @@ Queue<T>& Queue<T>::operator=(const Queue<T>& other) {
     return *this;
 }
 
-template<typename T>
-Queue<T>& Queue<T>::operator=(Queue<T>&& other) {
+template<typename T, typename Alloc, typename Instrumentation>
+Queue<T, Alloc, Instrumentation>& Queue<T, Alloc, Instrumentation>::operator=(Queue<T, Alloc, Instrumentation>&& other) {
     if (this != &other) {
+        if (queueCapacity != 0 && other.queueSize > queueCapacity) {
+            throw std::runtime_error("Cannot assign: source has more elements than the Queue capacity");
+        }
         clear();
+        if constexpr (!NodeTraits::propagate_on_container_move_assignment::value) {
+            // Nodes owned by a foreign allocator cannot be adopted; copy them and release the source
+            if (nodeAlloc != other.nodeAlloc) {
+                *this = static_cast<const Queue<T, Alloc, Instrumentation>&>(other);
+                other.clear();
+                return *this;
+            }
+        }
+        else {
+            // Spare storage belongs to the allocator being replaced
+            if (nodeAlloc != other.nodeAlloc) release_spares();
+            nodeAlloc = std::move(other.nodeAlloc);
+        }
         frontNode = other.frontNode;
         rearNode = other.rearNode;
         queueSize = other.queueSize;
@@ -60,13 +126,14 @@ Queue<T>& Queue<T>::operator=(Queue<T>&& other) {
         other.frontNode = nullptr;
         other.rearNode = nullptr;
         other.queueSize = 0;
+        instrumentation().record_size(queueSize);
     }
     return *this;
 }
 
-template<typename T>
-Queue<T>& Queue<T>::operator=(const fwd_container<T>& other){
-    const Queue<T>* derived = dynamic_cast<const Queue<T>*>(&other);
+template<typename T, typename Alloc, typename Instrumentation>
+Queue<T, Alloc, Instrumentation>& Queue<T, Alloc, Instrumentation>::operator=(const fwd_container<T>& other){
+    const Queue<T, Alloc, Instrumentation>* derived = dynamic_cast<const Queue<T, Alloc, Instrumentation>*>(&other);
     if (!derived) {
         throw std::bad_cast();
     }
@@ -74,16 +141,31 @@ Queue<T>& Queue<T>::operator=(const fwd_container<T>& other){
 }
 
 
-template<typename T>
-Queue<T>::~Queue() {
+template<typename T, typename Alloc, typename Instrumentation>
+Queue<T, Alloc, Instrumentation>::~Queue() {
     clear();
+    release_spares();
 }
 
 // fwd_container interface implementation
-template<typename T>
-void Queue<T>::push(const T& value) {
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::push(const T& value) {
+    emplace(value);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::push(T&& value) { 
+    emplace(std::move(value));
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+template<typename... Args>
+T& Queue<T, Alloc, Instrumentation>::emplace(Args&&... args) {
+    if (is_full()) throw std::runtime_error("Cannot push: Queue is full");
+
     try {
-        Node<T>* newNode = new Node<T>(value); // next = nullptr
+        typename Instrumentation::sample started = instrumentation().begin_push();
+        Node<T>* newNode = acquire_node(std::in_place, nullptr, std::forward<Args>(args)...);
         
         if (is_empty()) {
             frontNode = rearNode = newNode;
@@ -92,150 +174,555 @@ void Queue<T>::push(const T& value) {
             rearNode = newNode;       
         }
         ++queueSize;
+        instrumentation().record_push(1, queueSize, started);
+        return newNode->data;
     }
     catch(std::bad_alloc& e) {
         throw std::runtime_error("Failed to allocate memory for new queue element: " + std::string(e.what()));
     } 
 }
 
-template<typename T>
-void Queue<T>::push(T&& value) { 
+template<typename T, typename Alloc, typename Instrumentation>
+template<typename... Args>
+T& Queue<T, Alloc, Instrumentation>::emplace_front(Args&&... args) {
+    if (is_full()) throw std::runtime_error("Cannot push: Queue is full");
+
     try {
-        Node<T>* newNode = new Node<T>(std::move(value)); // next = nullptr
+        typename Instrumentation::sample started = instrumentation().begin_push();
+        Node<T>* newNode = acquire_node(std::in_place, frontNode, std::forward<Args>(args)...);
         
-        if (is_empty()) {
-            frontNode = rearNode = newNode;
-        } else {
-            rearNode->next = newNode; 
-            rearNode = newNode;       
-        }
+        if (is_empty()) rearNode = newNode;
+        frontNode = newNode;
         ++queueSize;
+        instrumentation().record_push(1, queueSize, started);
+        return newNode->data;
     }
     catch(std::bad_alloc& e) {
         throw std::runtime_error("Failed to allocate memory for new queue element: " + std::string(e.what()));
     } 
 }
 
-template<typename T>
-T Queue<T>::pop() {
-    if (is_empty()) throw std::runtime_error("Cannot pop: Queue is empty");
-
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::drop_front() noexcept {
     Node<T>* temp = frontNode;
     frontNode = frontNode->next;
     if(frontNode == nullptr) rearNode = nullptr;
-    T value = std::move(temp->data); 
     --queueSize;  
-    delete temp;
+    recycle_node(temp);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+T Queue<T, Alloc, Instrumentation>::pop() {
+    if (is_empty()) throw std::runtime_error("Cannot pop: Queue is empty");
+
+    typename Instrumentation::sample started = instrumentation().begin_pop();
+    T value = std::move(frontNode->data); 
+    drop_front();
+    instrumentation().record_pop(1, started);
     return value;
 }
 
-template<typename T>
-T& Queue<T>::get_front() {
+template<typename T, typename Alloc, typename Instrumentation>
+bool Queue<T, Alloc, Instrumentation>::try_pop(T& out) {
+    if (is_empty()) return false;
+
+    typename Instrumentation::sample started = instrumentation().begin_pop();
+    out = std::move(frontNode->data);
+    drop_front();
+    instrumentation().record_pop(1, started);
+    return true;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+std::optional<T> Queue<T, Alloc, Instrumentation>::try_pop() {
+    if (is_empty()) return std::nullopt;
+
+    typename Instrumentation::sample started = instrumentation().begin_pop();
+    std::optional<T> value(std::move(frontNode->data));
+    drop_front();
+    instrumentation().record_pop(1, started);
+    return value;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+T& Queue<T, Alloc, Instrumentation>::get_front() {
     if (is_empty()) throw std::runtime_error("Cannot get front data: Queue is empty");
     return frontNode->data;
 }
 
-template<typename T>
-const T& Queue<T>::get_front() const {
+template<typename T, typename Alloc, typename Instrumentation>
+const T& Queue<T, Alloc, Instrumentation>::get_front() const {
     if (is_empty()) throw std::runtime_error("Cannot get front data: Queue is empty");
     return frontNode->data;
 }
 
-template<typename T>
-bool Queue<T>::is_empty() const {
+template<typename T, typename Alloc, typename Instrumentation>
+T* Queue<T, Alloc, Instrumentation>::try_front() noexcept {
+    return frontNode ? &frontNode->data : nullptr;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+const T* Queue<T, Alloc, Instrumentation>::try_front() const noexcept {
+    return frontNode ? &frontNode->data : nullptr;
+}
+
+// Bounded capacity
+template<typename T, typename Alloc, typename Instrumentation>
+template<typename... Args>
+Node<T>* Queue<T, Alloc, Instrumentation>::acquire_node(Args&&... args) {
+    if (spareNodes == nullptr) {
+        Node<T>* node = create_node(nodeAlloc, std::forward<Args>(args)...);
+        instrumentation().record_allocations(1);
+        return node;
+    }
+
+    spare_block* block = spareNodes;
+    spare_block* next = block->next;
+    Node<T>* node = reinterpret_cast<Node<T>*>(block);
+    try {
+        NodeTraits::construct(nodeAlloc, node, std::forward<Args>(args)...);
+    }
+    catch (...) {
+        spareNodes = ::new (static_cast<void*>(node)) spare_block{next};
+        throw;
+    }
+    spareNodes = next;
+    --spareCount;
+    return node;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::recycle_node(Node<T>* node) noexcept {
+    if (queueCapacity != 0 && queueSize + spareCount < queueCapacity) {
+        NodeTraits::destroy(nodeAlloc, node);
+        spareNodes = ::new (static_cast<void*>(node)) spare_block{spareNodes};
+        ++spareCount;
+    } else {
+        destroy_node(nodeAlloc, node);
+        instrumentation().record_frees(1);
+    }
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::recycle_chain(Node<T>* head) noexcept {
+    while (head != nullptr) {
+        Node<T>* next = head->next;
+        prefetch_node(next);
+        recycle_node(head);
+        head = next;
+    }
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::trim_spares(size_t keep) noexcept {
+    while (spareCount > keep) {
+        spare_block* block = spareNodes;
+        spareNodes = block->next;
+        --spareCount;
+        NodeTraits::deallocate(nodeAlloc, reinterpret_cast<Node<T>*>(block), 1);
+        instrumentation().record_frees(1);
+    }
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::release_spares() noexcept {
+    trim_spares(0);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::set_capacity(size_t capacity) {
+    if (capacity != 0 && capacity < queueSize) {
+        throw std::runtime_error("Cannot set capacity: Queue holds more elements than the new capacity");
+    }
+
+    size_t previous = queueCapacity;
+    queueCapacity = capacity;
+    if (capacity == 0) {
+        release_spares();
+        return;
+    }
+
+    trim_spares(capacity - queueSize);
+    try {
+        while (queueSize + spareCount < capacity) {
+            Node<T>* raw = NodeTraits::allocate(nodeAlloc, 1);
+            spareNodes = ::new (static_cast<void*>(raw)) spare_block{spareNodes};
+            ++spareCount;
+            instrumentation().record_allocations(1);
+        }
+    }
+    catch (std::bad_alloc& e) {
+        queueCapacity = previous;
+        trim_spares(previous == 0 ? 0 : previous - queueSize);
+        throw std::runtime_error("Failed to preallocate memory for queue capacity: " + std::string(e.what()));
+    }
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+Node<T>* Queue<T, Alloc, Instrumentation>::clone_chain(const Node<T>* source, size_t count, Node<T>*& last) {
+    Node<T>* head = nullptr;
+    last = nullptr;
+    if (count > spareCount) reserve_nodes(nodeAlloc, count - spareCount);
+
+    try {
+        for (; count > 0; --count, source = source->next) {
+            prefetch_node(source->next);
+            Node<T>* copy = acquire_node(source->data);
+            if (last == nullptr) {
+                head = copy;
+            } else {
+                last->next = copy;
+            }
+            last = copy;
+        }
+    }
+    catch (...) {
+        recycle_chain(head);
+        last = nullptr;
+        throw;
+    }
+    return head;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::truncate_after(Node<T>* last, size_t count) noexcept {
+    Node<T>* extra = last == nullptr ? frontNode : last->next;
+    if (last == nullptr) {
+        frontNode = nullptr;
+    } else {
+        last->next = nullptr;
+    }
+    rearNode = last;
+    queueSize = count;
+    recycle_chain(extra);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+size_t Queue<T, Alloc, Instrumentation>::capacity() const {
+    return queueCapacity;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+bool Queue<T, Alloc, Instrumentation>::is_full() const {
+    return queueCapacity != 0 && queueSize == queueCapacity;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+bool Queue<T, Alloc, Instrumentation>::try_push(const T& value) {
+    return try_emplace(value);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+bool Queue<T, Alloc, Instrumentation>::try_push(T&& value) {
+    return try_emplace(std::move(value));
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+template<typename... Args>
+bool Queue<T, Alloc, Instrumentation>::try_emplace(Args&&... args) {
+    if (is_full()) return false;
+    emplace(std::forward<Args>(args)...);
+    return true;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+bool Queue<T, Alloc, Instrumentation>::is_empty() const {
     return frontNode == nullptr;
 }
 
-template<typename T>
-size_t Queue<T>::size() const {
+template<typename T, typename Alloc, typename Instrumentation>
+size_t Queue<T, Alloc, Instrumentation>::size() const {
     return queueSize;
 }
 
-template<typename T>
-typename Queue<T>::iterator Queue<T>::begin() {
-    return iterator(new queue_iterator(frontNode));
+// Bulk operations
+template<typename T, typename Alloc, typename Instrumentation>
+template<typename InputIt>
+void Queue<T, Alloc, Instrumentation>::push_range(InputIt first, InputIt last) {
+    Node<T>* chainFront = nullptr;
+    Node<T>* chainRear = nullptr;
+    size_t count = 0;
+
+    try {
+        for (; first != last; ++first) {
+            if (queueCapacity != 0 && queueSize + count == queueCapacity) {
+                throw std::runtime_error("Cannot push_range: Queue capacity exceeded");
+            }
+            Node<T>* newNode = acquire_node(*first);
+            if (chainRear == nullptr) {
+                chainFront = newNode;
+            } else {
+                chainRear->next = newNode;
+            }
+            chainRear = newNode;
+            ++count;
+        }
+    }
+    catch (std::bad_alloc& e) {
+        recycle_chain(chainFront);
+        throw std::runtime_error("Failed to allocate memory for queue range: " + std::string(e.what()));
+    }
+    catch (...) {
+        recycle_chain(chainFront);
+        throw;
+    }
+
+    if (chainFront == nullptr) return;
+    if (is_empty()) {
+        frontNode = chainFront;
+    } else {
+        rearNode->next = chainFront;
+    }
+    rearNode = chainRear;
+    queueSize += count;
+    instrumentation().record_push(count, queueSize);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::push_range(const T* first, const T* last) {
+    push_range<const T*>(first, last);
 }
 
-template<typename T>
-typename Queue<T>::iterator Queue<T>::end() {
-    return iterator(new queue_iterator(nullptr));
+template<typename T, typename Alloc, typename Instrumentation>
+template<typename OutputIt>
+OutputIt Queue<T, Alloc, Instrumentation>::pop_n(size_t n, OutputIt out) {
+    if (n > queueSize) throw std::runtime_error("Cannot pop_n: Queue has fewer elements than requested");
+
+    // Elements are only moved out when writing them cannot throw; otherwise they are
+    // copied, so a failed write leaves every element intact
+    constexpr bool move_out = !std::is_copy_constructible_v<T> ||
+        (noexcept(*out = std::move(std::declval<T&>())) && noexcept(++out));
+
+    Node<T>* current = frontNode;
+    for (size_t i = 0; i < n; ++i) {
+        prefetch_node(current->next);
+        if constexpr (move_out) {
+            *out = std::move(current->data);
+        }
+        else {
+            *out = static_cast<const T&>(current->data);
+        }
+        ++out;
+        current = current->next;
+    }
+
+    // Every element is out; unlink the consumed prefix in one go
+    Node<T>* consumed = frontNode;
+    frontNode = current;
+    if (frontNode == nullptr) {
+        rearNode = nullptr;
+    }
+    queueSize -= n;
+    while (consumed != current) {
+        Node<T>* temp = consumed;
+        consumed = consumed->next;
+        recycle_node(temp);
+    }
+    instrumentation().record_pop(n);
+    return out;
 }
 
-template<typename T>
-typename Queue<T>::const_iterator Queue<T>::begin() const {
-    return const_iterator(new queue_const_iterator(frontNode));
+template<typename T, typename Alloc, typename Instrumentation>
+T* Queue<T, Alloc, Instrumentation>::pop_n(size_t n, T* out) {
+    return pop_n<T*>(n, out);
 }
 
-template<typename T>
-typename Queue<T>::const_iterator Queue<T>::end() const {
-    return const_iterator(new queue_const_iterator(nullptr));
+template<typename T, typename Alloc, typename Instrumentation>
+template<typename OutputIt>
+OutputIt Queue<T, Alloc, Instrumentation>::drain_into(OutputIt out) {
+    return pop_n(queueSize, out);
 }
 
-template<typename T>
-typename Queue<T>::const_iterator Queue<T>::cbegin() const {
-    return const_iterator(new queue_const_iterator(frontNode));
+template<typename T, typename Alloc, typename Instrumentation>
+T* Queue<T, Alloc, Instrumentation>::drain_into(T* out) {
+    return drain_into<T*>(out);
 }
 
-template<typename T>
-typename Queue<T>::const_iterator Queue<T>::cend() const {
-    return const_iterator(new queue_const_iterator(nullptr));
+// Splicing
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::splice_back(Queue<T, Alloc, Instrumentation>&& other) {
+    if (this == &other || other.is_empty()) return;
+    if (queueCapacity != 0 && queueSize + other.queueSize > queueCapacity) {
+        throw std::runtime_error("Cannot splice: Queue capacity exceeded");
+    }
+
+    if constexpr (!NodeTraits::is_always_equal::value) {
+        if (nodeAlloc != other.nodeAlloc) {
+            push_range(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            other.clear();
+            return;
+        }
+    }
+
+    if (is_empty()) {
+        frontNode = other.frontNode;
+    } else {
+        rearNode->next = other.frontNode;
+    }
+    rearNode = other.rearNode;
+    queueSize += other.queueSize;
+    instrumentation().record_size(queueSize);
+
+    other.frontNode = nullptr;
+    other.rearNode = nullptr;
+    other.queueSize = 0;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+Queue<T, Alloc, Instrumentation> Queue<T, Alloc, Instrumentation>::split_after(iterator pos) {
+    Node<T>* last = pos.get_current();
+    if (last == nullptr) throw std::runtime_error("Cannot split: iterator does not point to an element");
+
+    Queue<T, Alloc, Instrumentation> tail(get_allocator());
+    if (last->next == nullptr) return tail;
+
+    tail.frontNode = last->next;
+    tail.rearNode = rearNode;
+    for (Node<T>* current = tail.frontNode; current != nullptr; current = current->next) {
+        ++tail.queueSize;
+    }
+    tail.instrumentation().record_size(tail.queueSize);
+
+    last->next = nullptr;
+    rearNode = last;
+    queueSize -= tail.queueSize;
+    return tail;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename Queue<T, Alloc, Instrumentation>::iterator Queue<T, Alloc, Instrumentation>::begin() {
+    return iterator(frontNode);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename Queue<T, Alloc, Instrumentation>::iterator Queue<T, Alloc, Instrumentation>::end() {
+    return iterator(nullptr);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename Queue<T, Alloc, Instrumentation>::const_iterator Queue<T, Alloc, Instrumentation>::begin() const {
+    return const_iterator(frontNode);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename Queue<T, Alloc, Instrumentation>::const_iterator Queue<T, Alloc, Instrumentation>::end() const {
+    return const_iterator(nullptr);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename Queue<T, Alloc, Instrumentation>::const_iterator Queue<T, Alloc, Instrumentation>::cbegin() const {
+    return const_iterator(frontNode);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename Queue<T, Alloc, Instrumentation>::const_iterator Queue<T, Alloc, Instrumentation>::cend() const {
+    return const_iterator(nullptr);
+}
+
+// Polymorphic iterators for access through fwd_container<T>
+template<typename T, typename Alloc, typename Instrumentation>
+typename fwd_container<T>::iterator Queue<T, Alloc, Instrumentation>::make_begin() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(begin());
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename fwd_container<T>::iterator Queue<T, Alloc, Instrumentation>::make_end() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(end());
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename fwd_container<T>::const_iterator Queue<T, Alloc, Instrumentation>::make_begin() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(begin());
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename fwd_container<T>::const_iterator Queue<T, Alloc, Instrumentation>::make_end() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(end());
 }
 
 // Additional methods for backward compatibility
-template<typename T>
-size_t Queue<T>::getSize() const {
+template<typename T, typename Alloc, typename Instrumentation>
+size_t Queue<T, Alloc, Instrumentation>::getSize() const {
     return queueSize;
 }
 
-template<typename T>
-Node<T>* Queue<T>::getFrontNode() {
+template<typename T, typename Alloc, typename Instrumentation>
+Node<T>* Queue<T, Alloc, Instrumentation>::getFrontNode() {
     if (is_empty()) throw std::runtime_error("Cannot get front Node: Queue is empty");
     return frontNode;
 }
 
-template<typename T>
-auto Queue<T>::getFrontNode() const -> const Node<T>* {
+template<typename T, typename Alloc, typename Instrumentation>
+auto Queue<T, Alloc, Instrumentation>::getFrontNode() const -> const Node<T>* {
     if (is_empty()) throw std::runtime_error("Cannot get front Node: Queue is empty");
     return frontNode;
 }
 
-template<typename T>
-Node<T>* Queue<T>::getRearNode() {
+template<typename T, typename Alloc, typename Instrumentation>
+Node<T>* Queue<T, Alloc, Instrumentation>::getRearNode() {
     if (is_empty()) throw std::runtime_error("Cannot get rear Node: Queue is empty");
     return rearNode;
 }
 
-template<typename T>
-auto Queue<T>::getRearNode() const -> const Node<T>* {
+template<typename T, typename Alloc, typename Instrumentation>
+auto Queue<T, Alloc, Instrumentation>::getRearNode() const -> const Node<T>* {
     if (is_empty()) throw std::runtime_error("Cannot get rear Node: Queue is empty");
     return rearNode;
 }
 
-template<typename T>
-T& Queue<T>::front() {
+template<typename T, typename Alloc, typename Instrumentation>
+T& Queue<T, Alloc, Instrumentation>::front() {
     return get_front();
 }
 
-template<typename T>
-const T& Queue<T>::front() const {
+template<typename T, typename Alloc, typename Instrumentation>
+const T& Queue<T, Alloc, Instrumentation>::front() const {
     return get_front();
 }
 
-template<typename T>
-void Queue<T>::clear() {
-    while (!is_empty()) {
-        pop();
+template<typename T, typename Alloc, typename Instrumentation>
+Alloc Queue<T, Alloc, Instrumentation>::get_allocator() const {
+    return Alloc(nodeAlloc);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+ContainerStats Queue<T, Alloc, Instrumentation>::stats() const {
+    static_assert(Instrumentation::enabled, "stats() needs an instrumented Queue, e.g. Queue<T, Alloc, Instrumented<>>");
+    return Instrumentation::snapshot();
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::reset_stats() {
+    static_assert(Instrumentation::enabled, "reset_stats() needs an instrumented Queue, e.g. Queue<T, Alloc, Instrumented<>>");
+    instrumentation().reset(queueSize);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::clear() {
+    Node<T>* chain = frontNode;
+    size_t count = queueSize;
+    frontNode = nullptr;
+    rearNode = nullptr;
+    queueSize = 0;
+
+    if constexpr (std::is_trivially_destructible_v<Node<T>>) {
+        // Spare blocks of a bounded queue live in the pool too and must survive
+        if (chain != nullptr && queueCapacity == 0 && release_all_nodes(nodeAlloc)) {
+            instrumentation().record_frees(count);
+            return;
+        }
     }
+    recycle_chain(chain);
 }
 
-template<typename T>
-bool Queue<T>::empty() const {
+template<typename T, typename Alloc, typename Instrumentation>
+bool Queue<T, Alloc, Instrumentation>::empty() const {
     return is_empty();
 }
 
 // Protected methods for stream operations
-template<typename T>
-std::ostream& Queue<T>::print(std::ostream& os) const {
+template<typename T, typename Alloc, typename Instrumentation>
+std::ostream& Queue<T, Alloc, Instrumentation>::print(std::ostream& os) const {
     try {
         if (!os.good()) throw std::runtime_error("Output stream is in bad state");
         
@@ -249,6 +736,7 @@ std::ostream& Queue<T>::print(std::ostream& os) const {
             
             if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
             
+            prefetch_node(current->next);
             os << current->data;
             current = current->next;
             first = false;
@@ -264,14 +752,24 @@ std::ostream& Queue<T>::print(std::ostream& os) const {
     }
 }
 
-template<typename T>
-std::istream& Queue<T>::read(std::istream& is) {
+template<typename T, typename Alloc, typename Instrumentation>
+std::istream& Queue<T, Alloc, Instrumentation>::read(std::istream& is) {
     try {
         if (!is.good()) {
             throw std::runtime_error("Input stream is in bad state");
         }
+
+        if constexpr (is_fast_parsable_v<T>) {
+            if (fast_parse_applies(is)) {
+                append_parsed(is);
+                return is;
+            }
+        }
         
-        Queue<T> backup = *this;
+        // Everything read is appended behind the current rear, so rolling back only
+        // has to cut the chain there again
+        Node<T>* oldRear = rearNode;
+        size_t oldSize = queueSize;
         
         try {
             T value;
@@ -303,7 +801,7 @@ std::istream& Queue<T>::read(std::istream& is) {
             
         } 
         catch (...) {
-            *this = std::move(backup);
+            truncate_after(oldRear, oldSize);
             throw;
         }
         
@@ -313,4 +811,109 @@ std::istream& Queue<T>::read(std::istream& is) {
         is.setstate(std::ios::failbit);
         throw std::runtime_error(std::string("Queue input failed: ") + e.what());
     }
-}
\ No newline at end of file
+}
+
+// Binary serialization
+template<typename T, typename Alloc, typename Instrumentation>
+std::ostream& Queue<T, Alloc, Instrumentation>::save(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+        binary_write_header<T>(os, queueSize);
+        binary_write_elements<T>(os, begin(), end());
+        if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+        return os;
+    }
+    catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Queue save failed: ") + e.what());
+    }
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+std::istream& Queue<T, Alloc, Instrumentation>::load(std::istream& is) {
+    try {
+        if (!is.good()) throw std::runtime_error("Input stream is in bad state");
+        binary_header header = binary_read_header<T>(is);
+        if (queueCapacity != 0 && header.count > queueCapacity - queueSize) {
+            throw std::runtime_error("Stored elements exceed the Queue capacity");
+        }
+
+        Node<T>* chainFront = nullptr;
+        Node<T>* chainRear = nullptr;
+        size_t count = 0;
+        try {
+            binary_read_elements<T>(is, header.count, [&](T&& value) {
+                Node<T>* newNode = acquire_node(std::move(value));
+                if (chainRear == nullptr) {
+                    chainFront = newNode;
+                } else {
+                    chainRear->next = newNode;
+                }
+                chainRear = newNode;
+                ++count;
+            });
+        }
+        catch (...) {
+            recycle_chain(chainFront);
+            throw;
+        }
+
+        if (chainFront != nullptr) {
+            if (rearNode == nullptr) {
+                frontNode = chainFront;
+            } else {
+                rearNode->next = chainFront;
+            }
+            rearNode = chainRear;
+            queueSize += count;
+            instrumentation().record_push(count, queueSize);
+        }
+        return is;
+    }
+    catch (const std::exception& e) {
+        is.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Queue load failed: ") + e.what());
+    }
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Queue<T, Alloc, Instrumentation>::append_parsed(std::istream& is) {
+    Node<T>* chainFront = nullptr;
+    Node<T>* chainRear = nullptr;
+    size_t count = 0;
+
+    try {
+        parse_text_elements<T>(is, [&](T value) {
+            if (queueCapacity != 0 && queueSize + count == queueCapacity) {
+                throw std::runtime_error("Push operation failed during input: Queue is full");
+            }
+            Node<T>* newNode = acquire_node(value);
+            if (chainRear == nullptr) {
+                chainFront = newNode;
+            } else {
+                chainRear->next = newNode;
+            }
+            chainRear = newNode;
+            ++count;
+        });
+    }
+    catch (const std::bad_alloc& e) {
+        recycle_chain(chainFront);
+        throw std::runtime_error("Memory allocation failed during input: " + std::string(e.what()));
+    }
+    catch (...) {
+        recycle_chain(chainFront);
+        throw;
+    }
+
+    if (chainFront != nullptr) {
+        if (rearNode == nullptr) {
+            frontNode = chainFront;
+        } else {
+            rearNode->next = chainFront;
+        }
+        rearNode = chainRear;
+        queueSize += count;
+        instrumentation().record_push(count, queueSize);
+    }
+}
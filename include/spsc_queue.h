@@ -0,0 +1,155 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <optional>
+#include <stdexcept>
+
+/**
+ * @brief Bounded wait-free queue for exactly one producer thread and one consumer thread
+ * @tparam T The type of elements stored in the queue
+ * @tparam Capacity Maximum number of elements held at once
+ *
+ * Elements live in a contiguous ring embedded in the object. The producer only writes
+ * the tail index and the consumer only writes the head index; each keeps a cached copy
+ * of the other side's index so the shared cache line is only read when the cached
+ * value says the ring looks full (or empty). The two indices sit on separate cache
+ * lines. The member names follow fwd_container<T> (push, pop, get_front, size), but
+ * pop() and push() wait for an element or a free slot instead of throwing; try_pop()
+ * and try_push() are the non-blocking variants.
+ */
+template<typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity > 0, "SpscQueue capacity must be positive");
+
+public:
+    /**
+     * @brief Default constructor - creates an empty queue
+     */
+    SpscQueue();
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Destructor - destroys remaining elements; neither thread may use the queue
+     */
+    ~SpscQueue();
+
+    /**
+     * @brief Add element to the back of the queue, waiting while the ring is full (producer only)
+     * @param value The value to add
+     */
+    void push(const T& value);
+
+    /**
+     * @brief Add element to the back of the queue, waiting while the ring is full (producer only)
+     * @param value The value to add
+     */
+    void push(T&& value);
+
+    /**
+     * @brief Add element to the back of the queue if there is room (producer only)
+     * @param value The value to add
+     * @return True if the element was added, false if the ring was full
+     */
+    bool try_push(const T& value);
+
+    /**
+     * @brief Add element to the back of the queue if there is room (producer only)
+     * @param value The value to add (left untouched if the ring is full)
+     * @return True if the element was added, false if the ring was full
+     */
+    bool try_push(T&& value);
+
+    /**
+     * @brief Construct an element in place at the back of the queue if there is room (producer only)
+     * @param args Arguments forwarded to the T constructor
+     * @return True if the element was added, false if the ring was full
+     */
+    template<typename... Args>
+    bool try_emplace(Args&&... args);
+
+    /**
+     * @brief Remove and return the front element, waiting while the queue is empty (consumer only)
+     * @return The removed element
+     */
+    T pop();
+
+    /**
+     * @brief Remove the front element if there is one (consumer only)
+     * @param out Receives the removed element
+     * @return True if an element was removed, false if the queue was empty
+     */
+    bool try_pop(T& out);
+
+    /**
+     * @brief Remove the front element if there is one (consumer only)
+     * @return The removed element, or std::nullopt if the queue was empty
+     */
+    std::optional<T> try_pop();
+
+    /**
+     * @brief Get reference to the front element (consumer only)
+     * @return Reference to the front element
+     * @throws std::runtime_error if queue is empty
+     */
+    T& get_front();
+
+    /**
+     * @brief Get const reference to the front element (consumer only)
+     * @return Const reference to the front element
+     * @throws std::runtime_error if queue is empty
+     */
+    const T& get_front() const;
+
+    /**
+     * @brief Check if queue is empty at the moment of the call
+     * @return True if queue is empty, false otherwise
+     */
+    bool is_empty() const;
+
+    /**
+     * @brief Checks if the queue is empty at the moment of the call
+     * @return true if queue is empty, false otherwise
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the number of elements in queue
+     * @return Size of the queue; exact when called from the producer or the consumer
+     *         while the other side is idle
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the maximum number of elements the queue can hold
+     * @return Capacity of the ring
+     */
+    static constexpr size_t capacity() noexcept { return Capacity; }
+
+private:
+    static constexpr size_t cache_line = 64;
+
+    T* slot(size_t index) noexcept;
+    const T* slot(size_t index) const noexcept;
+
+    /**
+     * @brief Wait until the ring has room for one element (producer only)
+     */
+    void wait_for_room() noexcept;
+
+    /**
+     * @brief Wait until the ring holds at least one element (consumer only)
+     */
+    void wait_for_element() noexcept;
+
+    // Indices grow monotonically; the slot is index % Capacity
+    alignas(cache_line) std::atomic<size_t> head; ///< Next slot to pop (written by the consumer)
+    size_t cachedTail;                            ///< Consumer's last view of tail
+    alignas(cache_line) std::atomic<size_t> tail; ///< Next slot to fill (written by the producer)
+    size_t cachedHead;                            ///< Producer's last view of head
+    alignas(cache_line) alignas(T) unsigned char storage[Capacity * sizeof(T)]; ///< Element ring
+};
+
+#include "spsc_queue.ipp"
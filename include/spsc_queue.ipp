@@ -0,0 +1,154 @@
+#include "spsc_queue.h"
+#include <thread>
+#include <utility>
+
+// SpscQueue constructors
+template<typename T, size_t Capacity>
+SpscQueue<T, Capacity>::SpscQueue() : head(0), cachedTail(0), tail(0), cachedHead(0) {}
+
+template<typename T, size_t Capacity>
+SpscQueue<T, Capacity>::~SpscQueue() {
+    size_t last = tail.load(std::memory_order_acquire);
+    for (size_t i = head.load(std::memory_order_relaxed); i != last; ++i) {
+        slot(i)->~T();
+    }
+}
+
+// Slot access
+template<typename T, size_t Capacity>
+T* SpscQueue<T, Capacity>::slot(size_t index) noexcept {
+    return std::launder(reinterpret_cast<T*>(storage + (index % Capacity) * sizeof(T)));
+}
+
+template<typename T, size_t Capacity>
+const T* SpscQueue<T, Capacity>::slot(size_t index) const noexcept {
+    return std::launder(reinterpret_cast<const T*>(storage + (index % Capacity) * sizeof(T)));
+}
+
+// Producer side
+template<typename T, size_t Capacity>
+template<typename... Args>
+bool SpscQueue<T, Capacity>::try_emplace(Args&&... args) {
+    size_t back = tail.load(std::memory_order_relaxed);
+    if (back - cachedHead == Capacity) {
+        cachedHead = head.load(std::memory_order_acquire);
+        if (back - cachedHead == Capacity) return false;
+    }
+
+    ::new (static_cast<void*>(storage + (back % Capacity) * sizeof(T))) T(std::forward<Args>(args)...);
+    tail.store(back + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T, size_t Capacity>
+bool SpscQueue<T, Capacity>::try_push(const T& value) {
+    return try_emplace(value);
+}
+
+template<typename T, size_t Capacity>
+bool SpscQueue<T, Capacity>::try_push(T&& value) {
+    return try_emplace(std::move(value));
+}
+
+template<typename T, size_t Capacity>
+void SpscQueue<T, Capacity>::wait_for_room() noexcept {
+    size_t back = tail.load(std::memory_order_relaxed);
+    while (back - cachedHead == Capacity) {
+        cachedHead = head.load(std::memory_order_acquire);
+        if (back - cachedHead == Capacity) std::this_thread::yield();
+    }
+}
+
+template<typename T, size_t Capacity>
+void SpscQueue<T, Capacity>::push(const T& value) {
+    wait_for_room();
+    try_emplace(value);
+}
+
+template<typename T, size_t Capacity>
+void SpscQueue<T, Capacity>::push(T&& value) {
+    wait_for_room();
+    try_emplace(std::move(value));
+}
+
+// Consumer side
+template<typename T, size_t Capacity>
+bool SpscQueue<T, Capacity>::try_pop(T& out) {
+    size_t front = head.load(std::memory_order_relaxed);
+    if (front == cachedTail) {
+        cachedTail = tail.load(std::memory_order_acquire);
+        if (front == cachedTail) return false;
+    }
+
+    T* element = slot(front);
+    out = std::move(*element);
+    element->~T();
+    head.store(front + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T, size_t Capacity>
+std::optional<T> SpscQueue<T, Capacity>::try_pop() {
+    size_t front = head.load(std::memory_order_relaxed);
+    if (front == cachedTail) {
+        cachedTail = tail.load(std::memory_order_acquire);
+        if (front == cachedTail) return std::nullopt;
+    }
+
+    T* element = slot(front);
+    std::optional<T> result(std::move(*element));
+    element->~T();
+    head.store(front + 1, std::memory_order_release);
+    return result;
+}
+
+template<typename T, size_t Capacity>
+void SpscQueue<T, Capacity>::wait_for_element() noexcept {
+    size_t front = head.load(std::memory_order_relaxed);
+    while (front == cachedTail) {
+        cachedTail = tail.load(std::memory_order_acquire);
+        if (front == cachedTail) std::this_thread::yield();
+    }
+}
+
+template<typename T, size_t Capacity>
+T SpscQueue<T, Capacity>::pop() {
+    wait_for_element();
+
+    size_t front = head.load(std::memory_order_relaxed);
+    T* element = slot(front);
+    T value = std::move(*element);
+    element->~T();
+    head.store(front + 1, std::memory_order_release);
+    return value;
+}
+
+template<typename T, size_t Capacity>
+T& SpscQueue<T, Capacity>::get_front() {
+    if (is_empty()) throw std::runtime_error("Cannot get front data: SpscQueue is empty");
+    return *slot(head.load(std::memory_order_relaxed));
+}
+
+template<typename T, size_t Capacity>
+const T& SpscQueue<T, Capacity>::get_front() const {
+    if (is_empty()) throw std::runtime_error("Cannot get front data: SpscQueue is empty");
+    return *slot(head.load(std::memory_order_relaxed));
+}
+
+// Observers
+template<typename T, size_t Capacity>
+bool SpscQueue<T, Capacity>::is_empty() const {
+    return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+}
+
+template<typename T, size_t Capacity>
+bool SpscQueue<T, Capacity>::empty() const {
+    return is_empty();
+}
+
+template<typename T, size_t Capacity>
+size_t SpscQueue<T, Capacity>::size() const {
+    size_t front = head.load(std::memory_order_acquire);
+    size_t back = tail.load(std::memory_order_acquire);
+    return back - front;
+}
@@ -1,42 +1,250 @@
 #pragma once
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <new>
+#include <type_traits>
+#include <utility>
 
 #include "Node.h"
 #include "fwd_container.h"
+#include "instrumentation.h"
+#include "stream_parse.h"
+
+template<typename T, typename Alloc> class ConcurrentStack;
 
 /**
  * @brief Stack implementation using singly linked list
  * @tparam T Type of elements stored in the stack
+ * @tparam Alloc Allocator for the elements, rebound internally to Node<T> (default: std::allocator<T>)
+ * @tparam Instrumentation Policy notified of pushes, pops, node allocations and size changes
+ *         (default: Uninstrumented; see Instrumented and stats())
  * 
  * This class implements a LIFO (Last-In-First-Out) data structure
  * using a singly linked list of nodes.
  */
-template<typename T>
-class Stack : public fwd_container<T> {
+template<typename T, typename Alloc = std::allocator<T>, typename Instrumentation = Uninstrumented>
+class Stack final : public fwd_container<T>, private Instrumentation {
 public:
-    using iterator = typename fwd_container<T>::iterator;
-    using const_iterator = typename fwd_container<T>::const_iterator;
+    /**
+     * @brief Iterator implementation for Stack (non-const version)
+     * 
+     * Plain value type holding one node pointer; no virtual calls and no allocation.
+     */
+    class stack_iterator {
+    private:
+        Node<T>* current; ///< Current node pointer
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = T*;
+        using reference         = T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        stack_iterator() : current(nullptr) {}
+
+        /**
+         * @brief Constructor
+         * @param node Starting node for iteration
+         */
+        explicit stack_iterator(Node<T>* node) : current(node) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Reference to the current element
+         */
+        T& operator*() const {
+            return current->data;
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Pointer to the current element
+         */
+        T* operator->() const {
+            return &(current->data);
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        stack_iterator& operator++() {
+            if (current) {
+                current = current->next;
+                if (current) prefetch_node(current->next);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        stack_iterator operator++(int) {
+            stack_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same node
+         */
+        friend bool operator==(const stack_iterator& lhs, const stack_iterator& rhs) {
+            return lhs.current == rhs.current;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different nodes
+         */
+        friend bool operator!=(const stack_iterator& lhs, const stack_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the current node pointer
+         * @return Pointer to current node
+         */
+        Node<T>* get_current() const { return current; }
+    };
+
+    /**
+     * @brief Const iterator implementation for Stack
+     * 
+     * Plain value type holding one node pointer; no virtual calls and no allocation.
+     */
+    class stack_const_iterator {
+    private:
+        const Node<T>* current; ///< Current node pointer
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = const T*;
+        using reference         = const T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        stack_const_iterator() : current(nullptr) {}
+
+        /**
+         * @brief Constructor
+         * @param node Starting node for iteration
+         */
+        explicit stack_const_iterator(const Node<T>* node) : current(node) {}
+
+        /**
+         * @brief Constructor from non-const iterator
+         * @param other Iterator to convert from
+         */
+        stack_const_iterator(const stack_iterator& other) : current(other.get_current()) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Const reference to the current element
+         */
+        const T& operator*() const {
+            return current->data;
+        }
+
+        /**
+         * @brief Member access operator
+         * @return Const pointer to the current element
+         */
+        const T* operator->() const {
+            return &(current->data);
+        }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        stack_const_iterator& operator++() {
+            if (current) {
+                current = current->next;
+                if (current) prefetch_node(current->next);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        stack_const_iterator operator++(int) {
+            stack_const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same node
+         */
+        friend bool operator==(const stack_const_iterator& lhs, const stack_const_iterator& rhs) {
+            return lhs.current == rhs.current;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different nodes
+         */
+        friend bool operator!=(const stack_const_iterator& lhs, const stack_const_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the current node pointer
+         * @return Const pointer to current node
+         */
+        const Node<T>* get_current() const { return current; }
+    };
+
+    using iterator = stack_iterator;
+    using const_iterator = stack_const_iterator;
+    using allocator_type = Alloc;
 
     /**
      * @brief Default constructor - creates an empty stack
      */
     Stack();
 
+    /**
+     * @brief Creates an empty stack that allocates its nodes through the given allocator
+     * @param alloc Allocator to use for all nodes of this stack
+     */
+    explicit Stack(const Alloc& alloc);
+
     /**
      * @brief Copy constructor - creates a deep copy of another stack
      * @param other Stack to copy from
      * @throws std::runtime_error if memory allocation fails during copying
      */
-    Stack(const Stack<T>& other);
+    Stack(const Stack<T, Alloc, Instrumentation>& other);
 
     /**
      * @brief Move constructor - transfers ownership from another stack
      * @param other Stack to move from (will be left in valid but empty state)
      */
-    Stack(Stack<T>&& other);
+    Stack(Stack<T, Alloc, Instrumentation>&& other);
 
     /**
      * @brief Copy assignment operator
@@ -44,14 +252,14 @@ public:
      * @return Reference to this stack
      * @throws std::runtime_error if memory allocation fails during copying
      */
-    Stack<T>& operator=(const Stack<T>& other);
+    Stack<T, Alloc, Instrumentation>& operator=(const Stack<T, Alloc, Instrumentation>& other);
 
     /**
      * @brief Move assignment operator
      * @param other Stack to move from
      * @return Reference to this stack
      */
-    Stack<T>& operator=(Stack<T>&& other);
+    Stack<T, Alloc, Instrumentation>& operator=(Stack<T, Alloc, Instrumentation>&& other);
 
     /**
      * @brief Virtual destructor
@@ -70,6 +278,15 @@ public:
      * @param value The value to add
      */
     void push(T&& value) override;
+
+    /**
+     * @brief Construct an element in place on the top of the stack
+     * @param args Arguments forwarded to the T constructor
+     * @return Reference to the new element
+     * @throws std::runtime_error if memory allocation fails
+     */
+    template<typename... Args>
+    T& emplace(Args&&... args);
     
     /**
      * @brief Remove and return element from the top of the stack
@@ -91,6 +308,31 @@ public:
      * @throws std::runtime_error if stack is empty
      */
     const T& get_front() const override;
+
+    /**
+     * @brief Remove the top element if there is one; never throws on empty
+     * @param out Receives the removed element
+     * @return True if an element was removed, false if the stack was empty
+     */
+    bool try_pop(T& out) override;
+
+    /**
+     * @brief Remove the top element if there is one; never throws on empty
+     * @return The removed element, or std::nullopt if the stack was empty
+     */
+    std::optional<T> try_pop() override;
+
+    /**
+     * @brief Get pointer to the top element
+     * @return Pointer to the top element, or nullptr if the stack is empty
+     */
+    T* try_front() noexcept override;
+
+    /**
+     * @brief Get const pointer to the top element
+     * @return Const pointer to the top element, or nullptr if the stack is empty
+     */
+    const T* try_front() const noexcept override;
     
     /**
      * @brief Check if stack is empty
@@ -104,49 +346,153 @@ public:
      */
     size_t size() const override;
 
+    /**
+     * @brief Add a range of elements to the top of the stack
+     * @tparam InputIt Input iterator whose elements are convertible to T
+     * @param first Iterator to the first element to add
+     * @param last Iterator past the last element to add
+     * @throws std::runtime_error if memory allocation fails (the stack is left unchanged)
+     * 
+     * All nodes are linked into a detached chain first and then attached with a single
+     * update of the top pointer. The last element of the range ends up on top,
+     * as with repeated push().
+     */
+    template<typename InputIt>
+    void push_range(InputIt first, InputIt last);
+
+    /**
+     * @brief Add a range of elements to the top of the stack
+     * @param first Pointer to the first element to add
+     * @param last Pointer past the last element to add
+     * @throws std::runtime_error if memory allocation fails (the stack is left unchanged)
+     */
+    void push_range(const T* first, const T* last) override;
+
+    /**
+     * @brief Remove n elements from the top of the stack, writing them in LIFO order to out
+     * @tparam OutputIt Output iterator accepting T
+     * @param n Number of elements to remove
+     * @param out Destination for the removed elements
+     * @return Iterator past the last element written
+     * @throws std::runtime_error if the stack holds fewer than n elements
+     * 
+     * Nodes are only released after every element has been written. Elements are moved
+     * out only if writing them through out cannot throw, and copied otherwise, so a
+     * throwing write leaves the stack unchanged (for a move-only T only the basic
+     * guarantee holds).
+     */
+    template<typename OutputIt>
+    OutputIt pop_n(size_t n, OutputIt out);
+
+    /**
+     * @brief Remove n elements from the top of the stack, writing them in LIFO order to out
+     * @param n Number of elements to remove
+     * @param out Destination for the removed elements
+     * @return Pointer past the last element written
+     * @throws std::runtime_error if the stack holds fewer than n elements
+     */
+    T* pop_n(size_t n, T* out) override;
+
+    /**
+     * @brief Remove every element of the stack, writing them in LIFO order to out
+     * @tparam OutputIt Output iterator accepting T
+     * @param out Destination for the removed elements
+     * @return Iterator past the last element written
+     */
+    template<typename OutputIt>
+    OutputIt drain_into(OutputIt out);
+
+    /**
+     * @brief Remove every element of the stack, writing them in LIFO order to out
+     * @param out Destination for the removed elements (must have room for size() elements)
+     * @return Pointer past the last element written
+     */
+    T* drain_into(T* out) override;
+
+    /**
+     * @brief Move every element of another stack on top of this one, keeping their order
+     * @param other Stack to take the elements from (left empty)
+     * 
+     * Nodes are relinked rather than reallocated; the cost is one walk to the bottom of
+     * other. If the two allocators compare unequal the nodes cannot be adopted, and the
+     * elements are moved one by one instead.
+     */
+    void splice_top(Stack<T, Alloc, Instrumentation>&& other);
+
+    /**
+     * @brief Split the stack below the given position
+     * @param pos Iterator to the lowest element that stays in this stack
+     * @return Stack holding every element below pos, in order
+     * @throws std::runtime_error if pos is end()
+     * 
+     * No element is copied or moved; the cost is one walk over the detached part to
+     * keep both sizes correct.
+     */
+    Stack<T, Alloc, Instrumentation> split_after(iterator pos);
+
+    /**
+     * @brief Write the stack in the binary format, top element first
+     * @param os Output stream (should be opened in binary mode)
+     * @return Reference to the output stream
+     * @throws std::runtime_error if an element cannot be encoded or the stream fails
+     */
+    std::ostream& save(std::ostream& os) const override;
+
+    /**
+     * @brief Place the elements stored by save() on top of the stack
+     * @param is Input stream (should be opened in binary mode)
+     * @return Reference to the input stream
+     * @throws std::runtime_error if the data is malformed or memory allocation fails
+     * 
+     * Elements are decoded straight into a detached chain of nodes in saved order,
+     * which is linked above the current top only once the whole stream has been read,
+     * so loading into an empty stack reproduces the saved one.
+     */
+    std::istream& load(std::istream& is) override;
+
     /**
      * @brief Assignment from any fwd_container
      * @param other Container to copy from
      * @return Reference to this stack
      * @throws std::runtime_error if memory allocation fails
      */
-    Stack<T>& operator=(const fwd_container<T>& other) override;
+    Stack<T, Alloc, Instrumentation>& operator=(const fwd_container<T>& other) override;
     
     /**
      * @brief Get iterator to the beginning of the stack
      * @return Iterator to the first element (top of stack)
      */
-    iterator begin() override;
+    iterator begin();
     
     /**
      * @brief Get iterator to the end of the stack
      * @return Iterator to the position after the last element
      */
-    iterator end() override;
+    iterator end();
     
     /**
      * @brief Get const iterator to the beginning of the stack
      * @return Const iterator to the first element (top of stack)
      */
-    const_iterator begin() const override;
+    const_iterator begin() const;
     
     /**
      * @brief Get const iterator to the end of the stack
      * @return Const iterator to the position after the last element
      */
-    const_iterator end() const override;
+    const_iterator end() const;
     
     /**
      * @brief Get const iterator to the beginning of the stack
      * @return Const iterator to the first element (top of stack)
      */
-    const_iterator cbegin() const override;
+    const_iterator cbegin() const;
     
     /**
      * @brief Get const iterator to the end of the stack
      * @return Const iterator to the position after the last element
      */
-    const_iterator cend() const override;
+    const_iterator cend() const;
 
     /**
      * @brief Returns the number of elements in the stack
@@ -179,7 +525,48 @@ public:
      */
     void clear();
 
+    /**
+     * @brief Returns a copy of the allocator associated with the stack
+     * @return Allocator rebound back to the element type
+     */
+    Alloc get_allocator() const;
+
+    /**
+     * @brief Snapshot of the instrumentation counters (only with an enabled policy such as Instrumented)
+     * @return Pushes, pops, node allocations and frees, peak size and sampled latencies
+     */
+    ContainerStats stats() const;
+
+    /**
+     * @brief Sets the instrumentation counters back to zero and the peak size to the current size
+     */
+    void reset_stats();
+
 protected:
+    /**
+     * @brief Create a polymorphic iterator to the beginning of the stack
+     * @return Type-erased iterator to the first element
+     */
+    typename fwd_container<T>::iterator make_begin() override;
+
+    /**
+     * @brief Create a polymorphic iterator to the end of the stack
+     * @return Type-erased iterator to the position after the last element
+     */
+    typename fwd_container<T>::iterator make_end() override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the beginning of the stack
+     * @return Type-erased const iterator to the first element
+     */
+    typename fwd_container<T>::const_iterator make_begin() const override;
+
+    /**
+     * @brief Create a polymorphic const iterator to the end of the stack
+     * @return Type-erased const iterator to the position after the last element
+     */
+    typename fwd_container<T>::const_iterator make_end() const override;
+
     /**
      * @brief Print stack contents to output stream
      * @param os Output stream
@@ -195,224 +582,66 @@ protected:
     virtual std::istream& read(std::istream& is) override;
 
 private:
-    /**
-     * @brief Iterator implementation for Stack (non-const version)
-     */
-    class stack_iterator : public fwd_container<T>::iterator_base {
-    private:
-        Node<T>* current; ///< Current node pointer
-        static constexpr int iterator_kind = 2;
-
-    public:
-        int get_iterator_kind() const noexcept override {
-            return iterator_kind;
-        }
-
-        /**
-         * @brief Constructor
-         * @param node Starting node for iteration
-         */
-        stack_iterator(Node<T>* node) : current(node) {}
-        
-        /**
-         * @brief Dereference operator
-         * @return Reference to the current element
-         */
-        T& operator*() override {
-            return current->data;
-        }
-        
-        /**
-         * @brief Member access operator
-         * @return Pointer to the current element
-         */
-        T* operator->() override {
-            return &(current->data);
-        }
-        
-        /**
-         * @brief Prefix increment operator
-         * @return Reference to this iterator
-         */
-        stack_iterator& operator++() override {
-            if (current) {
-                current = current->next;
-            }
-            return *this;
-        }
-        
-        /**
-         * @brief Equality comparison with iterator_base
-         * @param other The iterator to compare with
-         * @return True if iterators are equal
-         */
-        bool operator==(const typename fwd_container<T>::iterator_base& other) const override {
-            if (this->get_iterator_kind() != other.get_iterator_kind()) return false;
-            const stack_iterator* derived = static_cast<const stack_iterator*>(&other);
-            return derived && current == derived->current;
-        }
-        
-        /**
-         * @brief Inequality comparison with iterator_base
-         * @param other The iterator to compare with
-         * @return True if iterators are not equal
-         */
-        bool operator!=(const typename fwd_container<T>::iterator_base& other) const override {
-            return !(*this == other);
-        }
-        
-        /**
-         * @brief Equality comparison with const_iterator_base
-         * @param other The const iterator to compare with
-         * @return True if iterators are equal
-         */
-        bool operator==(const typename fwd_container<T>::const_iterator_base& other) const override {
-            if (this->get_iterator_kind() != other.get_iterator_kind()) return false;
-            const stack_const_iterator* derived = static_cast<const stack_const_iterator*>(&other);
-            return derived && current == derived->get_current();
-        }
-        
-        /**
-         * @brief Inequality comparison with const_iterator_base
-         * @param other The const iterator to compare with
-         * @return True if iterators are not equal
-         */
-        bool operator!=(const typename fwd_container<T>::const_iterator_base& other) const override {
-            return !(*this == other);
-        }
-
-        /**
-         * @brief Create a const version of this iterator
-         * @return Pointer to new const_iterator_base
-         */
-        typename fwd_container<T>::const_iterator_base* create_const() const override {
-            return new stack_const_iterator(current);
-        }
+    friend class ConcurrentStack<T, Alloc>;
 
-        /**
-         * @brief Get the current node pointer
-         * @return Pointer to current node
-         */
-        Node<T>* get_current() const { return current; }
+    using NodeAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node<T>>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
 
-    protected:
-        /**
-         * @brief Clone this iterator
-         * @return Pointer to new cloned iterator
-         */
-        stack_iterator* clone() const override {
-            return new stack_iterator(current);
-        }
+    /**
+     * @brief Adopts an existing node chain
+     * @param top First node of a nullptr-terminated chain allocated through alloc
+     * @param count Number of nodes in the chain
+     * @param alloc Allocator the chain was allocated with
+     */
+    Stack(Node<T>* top, size_t count, const NodeAllocator& alloc);
 
-        friend class stack_const_iterator;
-    };
+    /**
+     * @brief The instrumentation policy (an empty base unless instrumented)
+     * @return Reference to the policy object
+     */
+    Instrumentation& instrumentation() noexcept { return *this; }
 
     /**
-     * @brief Const iterator implementation for Stack
+     * @brief Creates a node through the node allocator and records the allocation
+     * @param args Arguments forwarded to the Node constructor
+     * @return Pointer to the new node
+     * @throws Whatever create_node throws; nothing is recorded then
      */
-    class stack_const_iterator : public fwd_container<T>::const_iterator_base {
-    private:
-        const Node<T>* current; ///< Current node pointer
-        static constexpr int iterator_kind = 2;
+    template<typename... Args>
+    Node<T>* new_node(Args&&... args);
 
-    public:
-        int get_iterator_kind() const noexcept override {
-            return iterator_kind;
-        }
-        
-        /**
-         * @brief Constructor
-         * @param node Starting node for iteration
-         */
-        stack_const_iterator(const Node<T>* node) : current(node) {}
-        
-        /**
-         * @brief Dereference operator
-         * @return Const reference to the current element
-         */
-        const T& operator*() const override {
-            return current->data;
-        }
-        
-        /**
-         * @brief Member access operator
-         * @return Const pointer to the current element
-         */
-        const T* operator->() const override {
-            return &(current->data);
-        }
-        
-        /**
-         * @brief Prefix increment operator
-         * @return Reference to this iterator
-         */
-        stack_const_iterator& operator++() override {
-            if (current) {
-                current = current->next;
-            }
-            return *this;
-        }
-        
-        /**
-         * @brief Equality comparison with const_iterator_base
-         * @param other The const iterator to compare with
-         * @return True if iterators are equal
-         */
-        bool operator==(const typename fwd_container<T>::const_iterator_base& other) const override {
-            if (this->get_iterator_kind() != other.get_iterator_kind()) return false;
-            const stack_const_iterator* derived = static_cast<const stack_const_iterator*>(&other);
-            return derived && current == derived->current;
-        }
-        
-        /**
-         * @brief Inequality comparison with const_iterator_base
-         * @param other The const iterator to compare with
-         * @return True if iterators are not equal
-         */
-        bool operator!=(const typename fwd_container<T>::const_iterator_base& other) const override {
-            return !(*this == other);
-        }
-        
-        /**
-         * @brief Equality comparison with iterator_base
-         * @param other The iterator to compare with
-         * @return True if iterators are equal
-         */
-        bool operator==(const typename fwd_container<T>::iterator_base& other) const override {
-            if (this->get_iterator_kind() != other.get_iterator_kind()) return false;
-            const stack_iterator* derived = static_cast<const stack_iterator*>(&other);
-            return derived && current == derived->get_current();
-        }
-        
-        /**
-         * @brief Inequality comparison with iterator_base
-         * @param other The iterator to compare with
-         * @return True if iterators are not equal
-         */
-        bool operator!=(const typename fwd_container<T>::iterator_base& other) const override {
-            return !(*this == other);
-        }
+    /**
+     * @brief Destroys a node and records the free
+     * @param node Node to destroy (must not be nullptr)
+     */
+    void free_node(Node<T>* node) noexcept;
 
-        /**
-         * @brief Get the current node pointer
-         * @return Const pointer to current node
-         */
-        const Node<T>* get_current() const { return current; }
+    /**
+     * @brief Destroys a nullptr-terminated chain and records the frees
+     * @param head First node of the chain (may be nullptr)
+     * @param count Number of nodes in the chain
+     */
+    void free_chain(Node<T>* head, size_t count) noexcept;
 
-    protected:
-        /**
-         * @brief Clone this iterator
-         * @return Pointer to new cloned const iterator
-         */
-        stack_const_iterator* clone() const override {
-            return new stack_const_iterator(current);
-        }
+    /**
+     * @brief Destroys the top element and unlinks its node (stack must not be empty)
+     */
+    void drop_top() noexcept;
 
-        friend class stack_iterator;
-    };
+    /**
+     * @brief Parse numbers up to the end of the stream and push them in order
+     * @param is Input stream
+     * @throws std::runtime_error if a token is not a number or memory allocation fails;
+     *         the stack is left unchanged
+     * 
+     * Values go into a detached chain (last value first) that is placed on top only
+     * once the whole input has been parsed.
+     */
+    void push_parsed(std::istream& is);
 
-    Node<T>* topNode;    ///< Pointer to the top node of the stack
-    size_t stackSize;    ///< Number of elements in the stack
+    Node<T>* topNode;        ///< Pointer to the top node of the stack
+    size_t stackSize;        ///< Number of elements in the stack
+    NodeAllocator nodeAlloc; ///< Allocator providing storage for the nodes
 };
 
 #include "stack.ipp"
\ No newline at end of file
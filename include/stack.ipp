@@ -1,104 +1,121 @@
 #include "stack.h"
 
 // Stack constructors and operators
-template<typename T>
-Stack<T>::Stack() : topNode(nullptr), stackSize(0) {}
-
-template<typename T>
-Stack<T>::Stack(const Stack<T>& other) : topNode(nullptr), stackSize(other.stackSize) {
-    if (!other.is_empty()) {
-        Node<T>* current = other.topNode;
-        Node<T>* prevNewNode = nullptr;
-        Node<T>* newTopNode = nullptr;
-        
-        try {
-            newTopNode = new Node<T>(current->data);
-            prevNewNode = newTopNode;
-            current = current->next;
-            
-            while (current != nullptr) {
-                Node<T>* newNode = new Node<T>(current->data);
-                prevNewNode->next = newNode; 
-                prevNewNode = newNode;        
-                current = current->next;
-            }
-            
-            topNode = newTopNode; 
-            
-        } 
-        catch (const std::bad_alloc& e) {
-            while (newTopNode != nullptr) {
-                Node<T>* temp = newTopNode;
-                newTopNode = newTopNode->next;
-                delete temp;
-            }
-            throw std::runtime_error("Memory allocation failed during copy construction: " + std::string(e.what()));
-        }
+template<typename T, typename Alloc, typename Instrumentation>
+Stack<T, Alloc, Instrumentation>::Stack() : topNode(nullptr), stackSize(0), nodeAlloc() {}
+
+template<typename T, typename Alloc, typename Instrumentation>
+Stack<T, Alloc, Instrumentation>::Stack(const Alloc& alloc) : topNode(nullptr), stackSize(0), nodeAlloc(alloc) {}
+
+template<typename T, typename Alloc, typename Instrumentation>
+Stack<T, Alloc, Instrumentation>::Stack(Node<T>* top, size_t count, const NodeAllocator& alloc) : topNode(top), stackSize(count), nodeAlloc(alloc) {
+    instrumentation().record_size(count);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+Stack<T, Alloc, Instrumentation>::Stack(const Stack<T, Alloc, Instrumentation>& other) 
+    : Instrumentation(), topNode(nullptr), stackSize(other.stackSize), nodeAlloc(NodeTraits::select_on_container_copy_construction(other.nodeAlloc)) {
+    try {
+        Node<T>* bottom = nullptr;
+        topNode = copy_chain(nodeAlloc, other.topNode, other.stackSize, bottom);
+        instrumentation().record_allocations(stackSize);
+        instrumentation().record_size(stackSize);
+    } 
+    catch (const std::bad_alloc& e) {
+        throw std::runtime_error("Memory allocation failed during copy construction: " + std::string(e.what()));
     }
 }
 
-template<typename T>
-Stack<T>::Stack(Stack<T>&& other) : topNode(other.topNode), stackSize(other.stackSize) {
+template<typename T, typename Alloc, typename Instrumentation>
+Stack<T, Alloc, Instrumentation>::Stack(Stack<T, Alloc, Instrumentation>&& other) 
+    : topNode(other.topNode), stackSize(other.stackSize), nodeAlloc(std::move(other.nodeAlloc)) {
     other.topNode = nullptr;
     other.stackSize = 0;
+    instrumentation().record_size(stackSize);
 }
 
-template<typename T>
-Stack<T>& Stack<T>::operator=(const Stack<T>& other) {
+template<typename T, typename Alloc, typename Instrumentation>
+Stack<T, Alloc, Instrumentation>& Stack<T, Alloc, Instrumentation>::operator=(const Stack<T, Alloc, Instrumentation>& other) {
     if (this != &other) {
-        clear();
-        stackSize = 0;
-        
-        if (!other.is_empty()) {
-            Node<T>* current = other.topNode;
-            Node<T>* prevNewNode = nullptr;
-            Node<T>* newTopNode = nullptr;
-            
-            try {
-                newTopNode = new Node<T>(current->data);
-                prevNewNode = newTopNode;
-                current = current->next;
-                
-                while (current != nullptr) {
-                    Node<T>* newNode = new Node<T>(current->data);
-                    prevNewNode->next = newNode; 
-                    prevNewNode = newNode;        
-                    current = current->next;
-                }
-                
-                topNode = newTopNode; 
-                stackSize = other.stackSize;
+        if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+            // Nodes of the allocator being replaced cannot be kept
+            if (nodeAlloc != other.nodeAlloc) clear();
+            nodeAlloc = other.nodeAlloc;
+        }
+
+        // Assign into the nodes both stacks have, then free or add only the difference
+        Node<T>* target = topNode;
+        const Node<T>* source = other.topNode;
+        Node<T>* kept = nullptr;
+        size_t count = 0;
+        while (target != nullptr && source != nullptr) {
+            prefetch_node(target->next);
+            prefetch_node(source->next);
+            target->data = source->data;
+            kept = target;
+            target = target->next;
+            source = source->next;
+            ++count;
+        }
+
+        if (source == nullptr) {
+            if (kept == nullptr) {
+                topNode = nullptr;
+            } else {
+                kept->next = nullptr;
             }
-            catch(const std::bad_alloc& e) {
-                // Clean up and rethrow on allocation failure
-                while (newTopNode != nullptr) {
-                    Node<T>* temp = newTopNode;
-                    newTopNode = newTopNode->next;
-                    delete temp;
-                }
-                throw std::runtime_error("Memory allocation failed during copy assignment: " + std::string(e.what()));
+            free_chain(target, stackSize - count);
+            stackSize = count;
+            return *this;
+        }
+
+        try {
+            Node<T>* bottom = nullptr;
+            Node<T>* chain = copy_chain(nodeAlloc, source, other.stackSize - count, bottom);
+            instrumentation().record_allocations(other.stackSize - count);
+            if (kept == nullptr) {
+                topNode = chain;
+            } else {
+                kept->next = chain;
             }
+            stackSize = other.stackSize;
+            instrumentation().record_size(stackSize);
+        }
+        catch(const std::bad_alloc& e) {
+            throw std::runtime_error("Memory allocation failed during copy assignment: " + std::string(e.what()));
         }
     }
     return *this;
 }
 
-template<typename T>
-Stack<T>& Stack<T>::operator=(Stack<T>&& other) {
+template<typename T, typename Alloc, typename Instrumentation>
+Stack<T, Alloc, Instrumentation>& Stack<T, Alloc, Instrumentation>::operator=(Stack<T, Alloc, Instrumentation>&& other) {
     if (this != &other) {
         clear();
+        if constexpr (!NodeTraits::propagate_on_container_move_assignment::value) {
+            // Nodes owned by a foreign allocator cannot be adopted; copy them and release the source
+            if (nodeAlloc != other.nodeAlloc) {
+                *this = static_cast<const Stack<T, Alloc, Instrumentation>&>(other);
+                other.clear();
+                return *this;
+            }
+        }
+        else {
+            nodeAlloc = std::move(other.nodeAlloc);
+        }
         topNode = other.topNode;
         stackSize = other.stackSize;
         
         other.topNode = nullptr;
         other.stackSize = 0;
+        instrumentation().record_size(stackSize);
     }
     return *this;
 }
 
-template<typename T>
-Stack<T>& Stack<T>::operator=(const fwd_container<T>& other){
-    const Stack<T>* derived = dynamic_cast<const Stack<T>*>(&other);
+template<typename T, typename Alloc, typename Instrumentation>
+Stack<T, Alloc, Instrumentation>& Stack<T, Alloc, Instrumentation>::operator=(const fwd_container<T>& other){
+    const Stack<T, Alloc, Instrumentation>* derived = dynamic_cast<const Stack<T, Alloc, Instrumentation>*>(&other);
     if (!derived) {
         throw std::bad_cast();
     }
@@ -106,131 +123,396 @@ Stack<T>& Stack<T>::operator=(const fwd_container<T>& other){
 }
 
 
-template<typename T>
-Stack<T>::~Stack() {
+template<typename T, typename Alloc, typename Instrumentation>
+Stack<T, Alloc, Instrumentation>::~Stack() {
     clear();
 }
 
 // fwd_container interface implementation
-template<typename T>
-void Stack<T>::push(const T& value) {
-    try {
-        Node<T>* newNode = new Node<T>(value, topNode);
-        topNode = newNode;
-        ++stackSize; 
-    }
-    catch(std::bad_alloc& e) {
-        throw std::runtime_error("Failed to allocate memory for new stack element: " + std::string(e.what()));
-    } 
+template<typename T, typename Alloc, typename Instrumentation>
+void Stack<T, Alloc, Instrumentation>::push(const T& value) {
+    emplace(value);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Stack<T, Alloc, Instrumentation>::push(T&& value) { 
+    emplace(std::move(value));
 }
 
-template<typename T>
-void Stack<T>::push(T&& value) { 
+template<typename T, typename Alloc, typename Instrumentation>
+template<typename... Args>
+T& Stack<T, Alloc, Instrumentation>::emplace(Args&&... args) {
     try {
-        Node<T>* newNode = new Node<T>(std::move(value), topNode);
+        typename Instrumentation::sample started = instrumentation().begin_push();
+        Node<T>* newNode = new_node(std::in_place, topNode, std::forward<Args>(args)...);
         topNode = newNode;
         ++stackSize; 
+        instrumentation().record_push(1, stackSize, started);
+        return newNode->data;
     }
     catch(std::bad_alloc& e) {
         throw std::runtime_error("Failed to allocate memory for new stack element: " + std::string(e.what()));
     } 
 }
 
-template<typename T>
-T Stack<T>::pop() {
-    if (is_empty()) throw std::runtime_error("Cannot pop: Stack is empty");
+template<typename T, typename Alloc, typename Instrumentation>
+template<typename... Args>
+Node<T>* Stack<T, Alloc, Instrumentation>::new_node(Args&&... args) {
+    Node<T>* node = create_node(nodeAlloc, std::forward<Args>(args)...);
+    instrumentation().record_allocations(1);
+    return node;
+}
 
+template<typename T, typename Alloc, typename Instrumentation>
+void Stack<T, Alloc, Instrumentation>::free_node(Node<T>* node) noexcept {
+    destroy_node(nodeAlloc, node);
+    instrumentation().record_frees(1);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Stack<T, Alloc, Instrumentation>::free_chain(Node<T>* head, size_t count) noexcept {
+    destroy_chain(nodeAlloc, head);
+    instrumentation().record_frees(count);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Stack<T, Alloc, Instrumentation>::drop_top() noexcept {
     Node<T>* temp = topNode;
     topNode = topNode->next;
-    T value = std::move(temp->data); 
     --stackSize;  
-    delete temp;
+    free_node(temp);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+T Stack<T, Alloc, Instrumentation>::pop() {
+    if (is_empty()) throw std::runtime_error("Cannot pop: Stack is empty");
+
+    typename Instrumentation::sample started = instrumentation().begin_pop();
+    T value = std::move(topNode->data); 
+    drop_top();
+    instrumentation().record_pop(1, started);
+    return value;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+bool Stack<T, Alloc, Instrumentation>::try_pop(T& out) {
+    if (is_empty()) return false;
+
+    typename Instrumentation::sample started = instrumentation().begin_pop();
+    out = std::move(topNode->data);
+    drop_top();
+    instrumentation().record_pop(1, started);
+    return true;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+std::optional<T> Stack<T, Alloc, Instrumentation>::try_pop() {
+    if (is_empty()) return std::nullopt;
+
+    typename Instrumentation::sample started = instrumentation().begin_pop();
+    std::optional<T> value(std::move(topNode->data));
+    drop_top();
+    instrumentation().record_pop(1, started);
     return value;
 }
 
-template<typename T>
-T& Stack<T>::get_front() {
+template<typename T, typename Alloc, typename Instrumentation>
+T& Stack<T, Alloc, Instrumentation>::get_front() {
     if (is_empty()) throw std::runtime_error("Cannot get top data: Stack is empty");
     return topNode->data;
 }
 
-template<typename T>
-const T& Stack<T>::get_front() const {
+template<typename T, typename Alloc, typename Instrumentation>
+const T& Stack<T, Alloc, Instrumentation>::get_front() const {
     if (is_empty()) throw std::runtime_error("Cannot get top data: Stack is empty");
     return topNode->data;
 }
 
-template<typename T>
-bool Stack<T>::is_empty() const {
+template<typename T, typename Alloc, typename Instrumentation>
+T* Stack<T, Alloc, Instrumentation>::try_front() noexcept {
+    return topNode ? &topNode->data : nullptr;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+const T* Stack<T, Alloc, Instrumentation>::try_front() const noexcept {
+    return topNode ? &topNode->data : nullptr;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+bool Stack<T, Alloc, Instrumentation>::is_empty() const {
     return topNode == nullptr;
 }
 
-template<typename T>
-size_t Stack<T>::size() const {
+template<typename T, typename Alloc, typename Instrumentation>
+size_t Stack<T, Alloc, Instrumentation>::size() const {
     return stackSize;
 }
 
-template<typename T>
-typename Stack<T>::iterator Stack<T>::begin() {
-    return iterator(new stack_iterator(topNode));
+// Bulk operations
+template<typename T, typename Alloc, typename Instrumentation>
+template<typename InputIt>
+void Stack<T, Alloc, Instrumentation>::push_range(InputIt first, InputIt last) {
+    Node<T>* chainTop = nullptr;
+    Node<T>* chainBottom = nullptr;
+    size_t count = 0;
+
+    try {
+        for (; first != last; ++first) {
+            chainTop = new_node(*first, chainTop);
+            if (chainBottom == nullptr) chainBottom = chainTop;
+            ++count;
+        }
+    }
+    catch (std::bad_alloc& e) {
+        free_chain(chainTop, count);
+        throw std::runtime_error("Failed to allocate memory for stack range: " + std::string(e.what()));
+    }
+    catch (...) {
+        free_chain(chainTop, count);
+        throw;
+    }
+
+    if (chainTop == nullptr) return;
+    chainBottom->next = topNode;
+    topNode = chainTop;
+    stackSize += count;
+    instrumentation().record_push(count, stackSize);
 }
 
-template<typename T>
-typename Stack<T>::iterator Stack<T>::end() {
-    return iterator(new stack_iterator(nullptr));
+template<typename T, typename Alloc, typename Instrumentation>
+void Stack<T, Alloc, Instrumentation>::push_range(const T* first, const T* last) {
+    push_range<const T*>(first, last);
 }
 
-template<typename T>
-typename Stack<T>::const_iterator Stack<T>::begin() const {
-    return const_iterator(new stack_const_iterator(topNode));
+template<typename T, typename Alloc, typename Instrumentation>
+template<typename OutputIt>
+OutputIt Stack<T, Alloc, Instrumentation>::pop_n(size_t n, OutputIt out) {
+    if (n > stackSize) throw std::runtime_error("Cannot pop_n: Stack has fewer elements than requested");
+
+    // Elements are only moved out when writing them cannot throw; otherwise they are
+    // copied, so a failed write leaves every element intact
+    constexpr bool move_out = !std::is_copy_constructible_v<T> ||
+        (noexcept(*out = std::move(std::declval<T&>())) && noexcept(++out));
+
+    Node<T>* current = topNode;
+    for (size_t i = 0; i < n; ++i) {
+        prefetch_node(current->next);
+        if constexpr (move_out) {
+            *out = std::move(current->data);
+        }
+        else {
+            *out = static_cast<const T&>(current->data);
+        }
+        ++out;
+        current = current->next;
+    }
+
+    // Every element is out; unlink the consumed prefix in one go
+    Node<T>* consumed = topNode;
+    topNode = current;
+    stackSize -= n;
+    while (consumed != current) {
+        Node<T>* temp = consumed;
+        consumed = consumed->next;
+        free_node(temp);
+    }
+    instrumentation().record_pop(n);
+    return out;
 }
 
-template<typename T>
-typename Stack<T>::const_iterator Stack<T>::end() const {
-    return const_iterator(new stack_const_iterator(nullptr));
+template<typename T, typename Alloc, typename Instrumentation>
+T* Stack<T, Alloc, Instrumentation>::pop_n(size_t n, T* out) {
+    return pop_n<T*>(n, out);
 }
 
-template<typename T>
-typename Stack<T>::const_iterator Stack<T>::cbegin() const {
-    return const_iterator(new stack_const_iterator(topNode));
+template<typename T, typename Alloc, typename Instrumentation>
+template<typename OutputIt>
+OutputIt Stack<T, Alloc, Instrumentation>::drain_into(OutputIt out) {
+    return pop_n(stackSize, out);
 }
 
-template<typename T>
-typename Stack<T>::const_iterator Stack<T>::cend() const {
-    return const_iterator(new stack_const_iterator(nullptr));
+template<typename T, typename Alloc, typename Instrumentation>
+T* Stack<T, Alloc, Instrumentation>::drain_into(T* out) {
+    return drain_into<T*>(out);
+}
+
+// Splicing
+template<typename T, typename Alloc, typename Instrumentation>
+void Stack<T, Alloc, Instrumentation>::splice_top(Stack<T, Alloc, Instrumentation>&& other) {
+    if (this == &other || other.is_empty()) return;
+
+    if constexpr (!NodeTraits::is_always_equal::value) {
+        if (nodeAlloc != other.nodeAlloc) {
+            // Rebuild other's chain top-down in our own allocator, then link it in one step
+            Node<T>* chainTop = nullptr;
+            Node<T>* chainBottom = nullptr;
+            size_t count = 0;
+            try {
+                for (Node<T>* current = other.topNode; current != nullptr; current = current->next) {
+                    Node<T>* newNode = new_node(std::move_if_noexcept(current->data));
+                    if (chainBottom == nullptr) {
+                        chainTop = newNode;
+                    } else {
+                        chainBottom->next = newNode;
+                    }
+                    chainBottom = newNode;
+                    ++count;
+                }
+            }
+            catch (std::bad_alloc& e) {
+                free_chain(chainTop, count);
+                throw std::runtime_error("Failed to allocate memory for spliced stack elements: " + std::string(e.what()));
+            }
+            catch (...) {
+                free_chain(chainTop, count);
+                throw;
+            }
+            chainBottom->next = topNode;
+            topNode = chainTop;
+            stackSize += other.stackSize;
+            instrumentation().record_size(stackSize);
+            other.clear();
+            return;
+        }
+    }
+
+    Node<T>* bottom = other.topNode;
+    while (bottom->next != nullptr) bottom = bottom->next;
+
+    bottom->next = topNode;
+    topNode = other.topNode;
+    stackSize += other.stackSize;
+    instrumentation().record_size(stackSize);
+
+    other.topNode = nullptr;
+    other.stackSize = 0;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+Stack<T, Alloc, Instrumentation> Stack<T, Alloc, Instrumentation>::split_after(iterator pos) {
+    Node<T>* last = pos.get_current();
+    if (last == nullptr) throw std::runtime_error("Cannot split: iterator does not point to an element");
+
+    Stack<T, Alloc, Instrumentation> rest(get_allocator());
+    rest.topNode = last->next;
+    for (Node<T>* current = rest.topNode; current != nullptr; current = current->next) {
+        ++rest.stackSize;
+    }
+    rest.instrumentation().record_size(rest.stackSize);
+
+    last->next = nullptr;
+    stackSize -= rest.stackSize;
+    return rest;
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename Stack<T, Alloc, Instrumentation>::iterator Stack<T, Alloc, Instrumentation>::begin() {
+    return iterator(topNode);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename Stack<T, Alloc, Instrumentation>::iterator Stack<T, Alloc, Instrumentation>::end() {
+    return iterator(nullptr);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename Stack<T, Alloc, Instrumentation>::const_iterator Stack<T, Alloc, Instrumentation>::begin() const {
+    return const_iterator(topNode);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename Stack<T, Alloc, Instrumentation>::const_iterator Stack<T, Alloc, Instrumentation>::end() const {
+    return const_iterator(nullptr);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename Stack<T, Alloc, Instrumentation>::const_iterator Stack<T, Alloc, Instrumentation>::cbegin() const {
+    return const_iterator(topNode);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename Stack<T, Alloc, Instrumentation>::const_iterator Stack<T, Alloc, Instrumentation>::cend() const {
+    return const_iterator(nullptr);
+}
+
+// Polymorphic iterators for access through fwd_container<T>
+template<typename T, typename Alloc, typename Instrumentation>
+typename fwd_container<T>::iterator Stack<T, Alloc, Instrumentation>::make_begin() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(begin());
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename fwd_container<T>::iterator Stack<T, Alloc, Instrumentation>::make_end() {
+    return fwd_container<T>::template wrap_iterator<iterator, const_iterator>(end());
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename fwd_container<T>::const_iterator Stack<T, Alloc, Instrumentation>::make_begin() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(begin());
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+typename fwd_container<T>::const_iterator Stack<T, Alloc, Instrumentation>::make_end() const {
+    return fwd_container<T>::template wrap_const_iterator<const_iterator, iterator>(end());
 }
 
 // Additional methods for backward compatibility
-template<typename T>
-size_t Stack<T>::getSize() const {
+template<typename T, typename Alloc, typename Instrumentation>
+size_t Stack<T, Alloc, Instrumentation>::getSize() const {
     return stackSize;
 }
 
-template<typename T>
-bool Stack<T>::empty() const {
+template<typename T, typename Alloc, typename Instrumentation>
+bool Stack<T, Alloc, Instrumentation>::empty() const {
     return is_empty();
 }
 
-template<typename T>
-T& Stack<T>::top() {
+template<typename T, typename Alloc, typename Instrumentation>
+T& Stack<T, Alloc, Instrumentation>::top() {
     return get_front();
 }
 
-template<typename T>
-const T& Stack<T>::top() const {
+template<typename T, typename Alloc, typename Instrumentation>
+const T& Stack<T, Alloc, Instrumentation>::top() const {
     return get_front();
 }
 
-template<typename T>
-void Stack<T>::clear() {
-    while (!is_empty()) {
-        pop();
+template<typename T, typename Alloc, typename Instrumentation>
+Alloc Stack<T, Alloc, Instrumentation>::get_allocator() const {
+    return Alloc(nodeAlloc);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+ContainerStats Stack<T, Alloc, Instrumentation>::stats() const {
+    static_assert(Instrumentation::enabled, "stats() needs an instrumented Stack, e.g. Stack<T, Alloc, Instrumented<>>");
+    return Instrumentation::snapshot();
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Stack<T, Alloc, Instrumentation>::reset_stats() {
+    static_assert(Instrumentation::enabled, "reset_stats() needs an instrumented Stack, e.g. Stack<T, Alloc, Instrumented<>>");
+    instrumentation().reset(stackSize);
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Stack<T, Alloc, Instrumentation>::clear() {
+    Node<T>* chain = topNode;
+    size_t count = stackSize;
+    topNode = nullptr;
+    stackSize = 0;
+
+    if constexpr (std::is_trivially_destructible_v<Node<T>>) {
+        if (chain != nullptr && release_all_nodes(nodeAlloc)) {
+            instrumentation().record_frees(count);
+            return;
+        }
     }
+    free_chain(chain, count);
 }
 
 // Protected methods for stream operations
-template<typename T>
-std::ostream& Stack<T>::print(std::ostream& os) const {
+template<typename T, typename Alloc, typename Instrumentation>
+std::ostream& Stack<T, Alloc, Instrumentation>::print(std::ostream& os) const {
     try {
         if (!os.good()) throw std::runtime_error("Output stream is in bad state");
         
@@ -244,6 +526,7 @@ std::ostream& Stack<T>::print(std::ostream& os) const {
             
             if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
             
+            prefetch_node(current->next);
             os << current->data;
             current = current->next;
             first = false;
@@ -259,14 +542,22 @@ std::ostream& Stack<T>::print(std::ostream& os) const {
     }
 }
 
-template<typename T>
-std::istream& Stack<T>::read(std::istream& is) {
+template<typename T, typename Alloc, typename Instrumentation>
+std::istream& Stack<T, Alloc, Instrumentation>::read(std::istream& is) {
     try {
         if (!is.good()) {
             throw std::runtime_error("Input stream is in bad state");
         }
+
+        if constexpr (is_fast_parsable_v<T>) {
+            if (fast_parse_applies(is)) {
+                push_parsed(is);
+                return is;
+            }
+        }
         
-        Stack<T> backup = *this;
+        // Everything read goes on top, so rolling back only pops it again
+        size_t oldSize = stackSize;
         
         try {
             T value;
@@ -298,7 +589,7 @@ std::istream& Stack<T>::read(std::istream& is) {
             
         } 
         catch (...) {
-            *this = std::move(backup);
+            while (stackSize > oldSize) drop_top();
             throw;
         }
         
@@ -308,4 +599,90 @@ std::istream& Stack<T>::read(std::istream& is) {
         is.setstate(std::ios::failbit);
         throw std::runtime_error(std::string("Stack input failed: ") + e.what());
     }
-}
\ No newline at end of file
+}
+
+// Binary serialization
+template<typename T, typename Alloc, typename Instrumentation>
+std::ostream& Stack<T, Alloc, Instrumentation>::save(std::ostream& os) const {
+    try {
+        if (!os.good()) throw std::runtime_error("Output stream is in bad state");
+        binary_write_header<T>(os, stackSize);
+        binary_write_elements<T>(os, begin(), end());
+        if (!os.good()) throw std::runtime_error("Output stream failed during serialization");
+        return os;
+    }
+    catch (const std::exception& e) {
+        os.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Stack save failed: ") + e.what());
+    }
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+std::istream& Stack<T, Alloc, Instrumentation>::load(std::istream& is) {
+    try {
+        if (!is.good()) throw std::runtime_error("Input stream is in bad state");
+        binary_header header = binary_read_header<T>(is);
+
+        Node<T>* chainTop = nullptr;
+        Node<T>* chainBottom = nullptr;
+        size_t count = 0;
+        try {
+            binary_read_elements<T>(is, header.count, [&](T&& value) {
+                Node<T>* newNode = new_node(std::move(value));
+                if (chainBottom == nullptr) {
+                    chainTop = newNode;
+                } else {
+                    chainBottom->next = newNode;
+                }
+                chainBottom = newNode;
+                ++count;
+            });
+        }
+        catch (...) {
+            free_chain(chainTop, count);
+            throw;
+        }
+
+        if (chainTop != nullptr) {
+            chainBottom->next = topNode;
+            topNode = chainTop;
+            stackSize += count;
+            instrumentation().record_push(count, stackSize);
+        }
+        return is;
+    }
+    catch (const std::exception& e) {
+        is.setstate(std::ios::failbit);
+        throw std::runtime_error(std::string("Stack load failed: ") + e.what());
+    }
+}
+
+template<typename T, typename Alloc, typename Instrumentation>
+void Stack<T, Alloc, Instrumentation>::push_parsed(std::istream& is) {
+    Node<T>* chainTop = nullptr;
+    Node<T>* chainBottom = nullptr;
+    size_t count = 0;
+
+    try {
+        parse_text_elements<T>(is, [&](T value) {
+            chainTop = new_node(value, chainTop);
+            if (chainBottom == nullptr) chainBottom = chainTop;
+            ++count;
+        });
+    }
+    catch (const std::bad_alloc& e) {
+        free_chain(chainTop, count);
+        throw std::runtime_error("Memory allocation failed during input: " + std::string(e.what()));
+    }
+    catch (...) {
+        free_chain(chainTop, count);
+        throw;
+    }
+
+    if (chainTop != nullptr) {
+        chainBottom->next = topNode;
+        topNode = chainTop;
+        stackSize += count;
+        instrumentation().record_push(count, stackSize);
+    }
+}
@@ -0,0 +1,469 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+
+#include "static_storage.h"
+
+/**
+ * @brief Fixed-capacity queue stored as a ring buffer inside the object
+ * @tparam T Type of elements stored in the queue
+ * @tparam N Maximum number of elements held at once
+ *
+ * The single-threaded counterpart of SpscQueue: never allocates and never throws by
+ * itself. push and emplace return static_status::full instead of growing, and the only
+ * exceptions that can escape are those of T's own constructors and assignments. The
+ * member names follow Queue<T> (push, pop, front, get_front, try_push, try_pop,
+ * try_front, size, begin/end), so code written against Queue<T> can switch to it through
+ * a type alias. Built as C++20 every member is constexpr, so a StaticQueue of a literal
+ * type can be filled and read in a constant expression.
+ *
+ * pop(), front() and get_front() require a non-empty queue (checked by assert); pop(T&),
+ * try_pop() and try_front() are the checked variants. This is where the switch from
+ * Queue<T> is not transparent: Queue<T> throws std::runtime_error on an empty queue, here the
+ * call is undefined behaviour once NDEBUG removes the assert.
+ */
+template<typename T, size_t N>
+class StaticQueue final {
+    static_assert(N > 0, "StaticQueue capacity must be positive");
+
+public:
+    /**
+     * @brief Iterator implementation for StaticQueue (non-const version)
+     */
+    class static_queue_iterator {
+    private:
+        StaticSlot<T>* slots; ///< Start of the ring
+        size_t head;          ///< Slot of the front element
+        size_t offset;        ///< Distance of the current element from the front (size at the end)
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = T*;
+        using reference         = T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        constexpr static_queue_iterator() noexcept : slots(nullptr), head(0), offset(0) {}
+
+        /**
+         * @brief Constructor
+         * @param s Start of the ring
+         * @param h Slot of the front element
+         * @param o Distance of the element to point at from the front
+         */
+        constexpr static_queue_iterator(StaticSlot<T>* s, size_t h, size_t o) noexcept : slots(s), head(h), offset(o) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Reference to the current element
+         */
+        constexpr T& operator*() const noexcept { return slots[(head + offset) % N].value; }
+
+        /**
+         * @brief Member access operator
+         * @return Pointer to the current element
+         */
+        constexpr T* operator->() const noexcept { return &slots[(head + offset) % N].value; }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        constexpr static_queue_iterator& operator++() noexcept {
+            ++offset;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        constexpr static_queue_iterator operator++(int) noexcept {
+            static_queue_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same element
+         */
+        friend constexpr bool operator==(const static_queue_iterator& lhs, const static_queue_iterator& rhs) noexcept {
+            return lhs.slots == rhs.slots && lhs.offset == rhs.offset;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different elements
+         */
+        friend constexpr bool operator!=(const static_queue_iterator& lhs, const static_queue_iterator& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the ring
+         * @return Pointer to the first slot
+         */
+        constexpr StaticSlot<T>* get_slots() const noexcept { return slots; }
+
+        /**
+         * @brief Get the slot of the front element
+         * @return Index of the front slot
+         */
+        constexpr size_t get_head() const noexcept { return head; }
+
+        /**
+         * @brief Get the current position
+         * @return Distance of the current element from the front
+         */
+        constexpr size_t get_offset() const noexcept { return offset; }
+    };
+
+    /**
+     * @brief Const iterator implementation for StaticQueue
+     */
+    class static_queue_const_iterator {
+    private:
+        const StaticSlot<T>* slots; ///< Start of the ring
+        size_t head;                ///< Slot of the front element
+        size_t offset;              ///< Distance of the current element from the front (size at the end)
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = const T*;
+        using reference         = const T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        constexpr static_queue_const_iterator() noexcept : slots(nullptr), head(0), offset(0) {}
+
+        /**
+         * @brief Constructor
+         * @param s Start of the ring
+         * @param h Slot of the front element
+         * @param o Distance of the element to point at from the front
+         */
+        constexpr static_queue_const_iterator(const StaticSlot<T>* s, size_t h, size_t o) noexcept : slots(s), head(h), offset(o) {}
+
+        /**
+         * @brief Constructor from non-const iterator
+         * @param other Iterator to convert from
+         */
+        constexpr static_queue_const_iterator(const static_queue_iterator& other) noexcept
+            : slots(other.get_slots()), head(other.get_head()), offset(other.get_offset()) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Const reference to the current element
+         */
+        constexpr const T& operator*() const noexcept { return slots[(head + offset) % N].value; }
+
+        /**
+         * @brief Member access operator
+         * @return Const pointer to the current element
+         */
+        constexpr const T* operator->() const noexcept { return &slots[(head + offset) % N].value; }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        constexpr static_queue_const_iterator& operator++() noexcept {
+            ++offset;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        constexpr static_queue_const_iterator operator++(int) noexcept {
+            static_queue_const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same element
+         */
+        friend constexpr bool operator==(const static_queue_const_iterator& lhs, const static_queue_const_iterator& rhs) noexcept {
+            return lhs.slots == rhs.slots && lhs.offset == rhs.offset;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different elements
+         */
+        friend constexpr bool operator!=(const static_queue_const_iterator& lhs, const static_queue_const_iterator& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+    };
+
+    using iterator = static_queue_iterator;
+    using const_iterator = static_queue_const_iterator;
+    using value_type = T;
+
+    /**
+     * @brief Default constructor - creates an empty queue
+     */
+    FWD_CONSTEXPR20 StaticQueue() noexcept;
+
+    /**
+     * @brief Copy constructor - copies the elements of another queue
+     * @param other Queue to copy from
+     */
+    FWD_CONSTEXPR20 StaticQueue(const StaticQueue& other) noexcept(std::is_nothrow_copy_constructible_v<T>);
+
+    /**
+     * @brief Move constructor - moves the elements of another queue one by one
+     * @param other Queue to move from (left empty)
+     */
+    FWD_CONSTEXPR20 StaticQueue(StaticQueue&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Copy assignment operator
+     * @param other Queue to copy from
+     * @return Reference to this queue
+     */
+    FWD_CONSTEXPR20 StaticQueue& operator=(const StaticQueue& other) noexcept(std::is_nothrow_copy_constructible_v<T>);
+
+    /**
+     * @brief Move assignment operator
+     * @param other Queue to move from (left empty)
+     * @return Reference to this queue
+     */
+    FWD_CONSTEXPR20 StaticQueue& operator=(StaticQueue&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Destructor - destroys the remaining elements
+     */
+    FWD_CONSTEXPR20 ~StaticQueue();
+
+    /**
+     * @brief Add element to the back of the queue (copy semantics)
+     * @param value The value to add
+     * @return static_status::ok, or static_status::full if the queue is at capacity
+     */
+    FWD_CONSTEXPR20 static_status push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>);
+
+    /**
+     * @brief Add element to the back of the queue (move semantics)
+     * @param value The value to add (left untouched if the queue is full)
+     * @return static_status::ok, or static_status::full if the queue is at capacity
+     */
+    FWD_CONSTEXPR20 static_status push(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Construct an element in place at the back of the queue
+     * @param args Arguments forwarded to the T constructor
+     * @return static_status::ok, or static_status::full if the queue is at capacity
+     */
+    template<typename... Args>
+    FWD_CONSTEXPR20 static_status emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>);
+
+    /**
+     * @brief Add element to the back of the queue if there is room
+     * @param value The value to add
+     * @return True if the element was added, false if the queue was full
+     */
+    FWD_CONSTEXPR20 bool try_push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>);
+
+    /**
+     * @brief Add element to the back of the queue if there is room
+     * @param value The value to add (left untouched if the queue is full)
+     * @return True if the element was added, false if the queue was full
+     */
+    FWD_CONSTEXPR20 bool try_push(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Construct an element in place at the back of the queue if there is room
+     * @param args Arguments forwarded to the T constructor
+     * @return True if the element was added, false if the queue was full
+     */
+    template<typename... Args>
+    FWD_CONSTEXPR20 bool try_emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>);
+
+    /**
+     * @brief Remove and return element from the front of the queue
+     * @return The removed element from front
+     * @pre The queue is not empty
+     */
+    FWD_CONSTEXPR20 T pop() noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Remove the front element if there is one
+     * @param out Receives the removed element
+     * @return static_status::ok, or static_status::empty if there was nothing to remove
+     */
+    FWD_CONSTEXPR20 static_status pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+    /**
+     * @brief Remove the front element if there is one
+     * @param out Receives the removed element
+     * @return True if an element was removed, false if the queue was empty
+     */
+    FWD_CONSTEXPR20 bool try_pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+    /**
+     * @brief Remove the front element if there is one
+     * @return The removed element, or std::nullopt if the queue was empty
+     */
+    FWD_CONSTEXPR20 std::optional<T> try_pop() noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Get reference to the front element
+     * @return Reference to the front element
+     * @pre The queue is not empty
+     */
+    FWD_CONSTEXPR20 T& get_front() noexcept;
+
+    /**
+     * @brief Get const reference to the front element
+     * @return Const reference to the front element
+     * @pre The queue is not empty
+     */
+    FWD_CONSTEXPR20 const T& get_front() const noexcept;
+
+    /**
+     * @brief Get reference to the front element (same as get_front)
+     * @return Reference to the front element
+     * @pre The queue is not empty
+     */
+    FWD_CONSTEXPR20 T& front() noexcept;
+
+    /**
+     * @brief Get const reference to the front element (same as get_front)
+     * @return Const reference to the front element
+     * @pre The queue is not empty
+     */
+    FWD_CONSTEXPR20 const T& front() const noexcept;
+
+    /**
+     * @brief Get pointer to the front element
+     * @return Pointer to the front element, or nullptr if the queue is empty
+     */
+    FWD_CONSTEXPR20 T* try_front() noexcept;
+
+    /**
+     * @brief Get const pointer to the front element
+     * @return Const pointer to the front element, or nullptr if the queue is empty
+     */
+    FWD_CONSTEXPR20 const T* try_front() const noexcept;
+
+    /**
+     * @brief Check if queue is empty
+     * @return True if queue is empty, false otherwise
+     */
+    FWD_CONSTEXPR20 bool is_empty() const noexcept;
+
+    /**
+     * @brief Checks if the queue is empty
+     * @return true if queue is empty, false otherwise
+     */
+    FWD_CONSTEXPR20 bool empty() const noexcept;
+
+    /**
+     * @brief Check if the queue is at capacity
+     * @return True if push would return static_status::full
+     */
+    FWD_CONSTEXPR20 bool is_full() const noexcept;
+
+    /**
+     * @brief Get the number of elements in queue
+     * @return Size of the queue
+     */
+    FWD_CONSTEXPR20 size_t size() const noexcept;
+
+    /**
+     * @brief Returns the number of elements in the queue
+     * @return Size of the queue
+     */
+    FWD_CONSTEXPR20 size_t getSize() const noexcept;
+
+    /**
+     * @brief Returns the maximum number of elements the queue can hold
+     * @return N
+     */
+    static constexpr size_t capacity() noexcept { return N; }
+
+    /**
+     * @brief Destroy all elements
+     */
+    FWD_CONSTEXPR20 void clear() noexcept;
+
+    /**
+     * @brief Get iterator to the front element
+     * @return Iterator to the front element
+     */
+    FWD_CONSTEXPR20 iterator begin() noexcept;
+
+    /**
+     * @brief Get iterator to the position after the back element
+     * @return Iterator to the end
+     */
+    FWD_CONSTEXPR20 iterator end() noexcept;
+
+    /**
+     * @brief Get const iterator to the front element
+     * @return Const iterator to the front element
+     */
+    FWD_CONSTEXPR20 const_iterator begin() const noexcept;
+
+    /**
+     * @brief Get const iterator to the position after the back element
+     * @return Const iterator to the end
+     */
+    FWD_CONSTEXPR20 const_iterator end() const noexcept;
+
+    /**
+     * @brief Get const iterator to the front element
+     * @return Const iterator to the front element
+     */
+    FWD_CONSTEXPR20 const_iterator cbegin() const noexcept;
+
+    /**
+     * @brief Get const iterator to the position after the back element
+     * @return Const iterator to the end
+     */
+    FWD_CONSTEXPR20 const_iterator cend() const noexcept;
+
+private:
+    /**
+     * @brief Destroy the front element
+     */
+    FWD_CONSTEXPR20 void drop_front() noexcept;
+
+    /**
+     * @brief Append copies (lvalue source) or moves (rvalue source) of another container's elements
+     * @param other Container to take the elements from
+     *
+     * If constructing an element throws, every element of this container is destroyed
+     * before the exception propagates.
+     */
+    template<typename Source>
+    FWD_CONSTEXPR20 void append_elements(Source&& other);
+
+    StaticSlot<T> slots[N]; ///< Element ring; queueSize slots starting at head are live
+    size_t head;            ///< Slot of the front element
+    size_t queueSize;       ///< Number of elements in the queue
+};
+
+#include "static_queue.ipp"
@@ -0,0 +1,249 @@
+#include "static_queue.h"
+#include <utility>
+
+// StaticQueue constructors and operators
+template<typename T, size_t N>
+FWD_CONSTEXPR20 StaticQueue<T, N>::StaticQueue() noexcept : head(0), queueSize(0) {}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 StaticQueue<T, N>::StaticQueue(const StaticQueue& other) noexcept(std::is_nothrow_copy_constructible_v<T>)
+    : head(0), queueSize(0) {
+    append_elements(other);
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 StaticQueue<T, N>::StaticQueue(StaticQueue&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    : head(0), queueSize(0) {
+    append_elements(std::move(other));
+    other.clear();
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 StaticQueue<T, N>& StaticQueue<T, N>::operator=(const StaticQueue& other) noexcept(std::is_nothrow_copy_constructible_v<T>) {
+    if (this != &other) {
+        clear();
+        append_elements(other);
+    }
+    return *this;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 StaticQueue<T, N>& StaticQueue<T, N>::operator=(StaticQueue&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+        clear();
+        append_elements(std::move(other));
+        other.clear();
+    }
+    return *this;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 StaticQueue<T, N>::~StaticQueue() {
+    clear();
+}
+
+template<typename T, size_t N>
+template<typename Source>
+FWD_CONSTEXPR20 void StaticQueue<T, N>::append_elements(Source&& other) {
+    constexpr bool moving = !std::is_lvalue_reference_v<Source>;
+    constexpr bool nothrow = moving ? std::is_nothrow_move_constructible_v<T> : std::is_nothrow_copy_constructible_v<T>;
+
+    auto append = [&] {
+        for (size_t i = 0; i < other.queueSize; ++i) {
+            if constexpr (moving) {
+                slots[(head + queueSize) % N].construct(std::move(other.slots[(other.head + i) % N].value));
+            }
+            else {
+                slots[(head + queueSize) % N].construct(other.slots[(other.head + i) % N].value);
+            }
+            ++queueSize;
+        }
+    };
+
+    if constexpr (nothrow) {
+        append();
+    }
+    else {
+        // StaticSlot does not destroy its element, so a constructor that throws halfway
+        // must destroy the elements it already built itself
+        try {
+            append();
+        }
+        catch (...) {
+            clear();
+            throw;
+        }
+    }
+}
+
+// Modifiers
+template<typename T, size_t N>
+template<typename... Args>
+FWD_CONSTEXPR20 static_status StaticQueue<T, N>::emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+    if (queueSize == N) return static_status::full;
+
+    slots[(head + queueSize) % N].construct(std::forward<Args>(args)...);
+    ++queueSize;
+    return static_status::ok;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 static_status StaticQueue<T, N>::push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>) {
+    return emplace(value);
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 static_status StaticQueue<T, N>::push(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    return emplace(std::move(value));
+}
+
+template<typename T, size_t N>
+template<typename... Args>
+FWD_CONSTEXPR20 bool StaticQueue<T, N>::try_emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+    return emplace(std::forward<Args>(args)...) == static_status::ok;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 bool StaticQueue<T, N>::try_push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>) {
+    return emplace(value) == static_status::ok;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 bool StaticQueue<T, N>::try_push(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    return emplace(std::move(value)) == static_status::ok;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 void StaticQueue<T, N>::drop_front() noexcept {
+    slots[head].destroy();
+    head = (head + 1) % N;
+    --queueSize;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 T StaticQueue<T, N>::pop() noexcept(std::is_nothrow_move_constructible_v<T>) {
+    assert(queueSize > 0 && "Cannot pop: StaticQueue is empty");
+
+    T value = std::move(slots[head].value);
+    drop_front();
+    return value;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 static_status StaticQueue<T, N>::pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if (queueSize == 0) return static_status::empty;
+
+    out = std::move(slots[head].value);
+    drop_front();
+    return static_status::ok;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 bool StaticQueue<T, N>::try_pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    return pop(out) == static_status::ok;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 std::optional<T> StaticQueue<T, N>::try_pop() noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if (queueSize == 0) return std::nullopt;
+
+    std::optional<T> value(std::move(slots[head].value));
+    drop_front();
+    return value;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 void StaticQueue<T, N>::clear() noexcept {
+    while (queueSize > 0) drop_front();
+    head = 0;
+}
+
+// Element access
+template<typename T, size_t N>
+FWD_CONSTEXPR20 T& StaticQueue<T, N>::get_front() noexcept {
+    assert(queueSize > 0 && "Cannot get front data: StaticQueue is empty");
+    return slots[head].value;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 const T& StaticQueue<T, N>::get_front() const noexcept {
+    assert(queueSize > 0 && "Cannot get front data: StaticQueue is empty");
+    return slots[head].value;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 T& StaticQueue<T, N>::front() noexcept {
+    return get_front();
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 const T& StaticQueue<T, N>::front() const noexcept {
+    return get_front();
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 T* StaticQueue<T, N>::try_front() noexcept {
+    return queueSize == 0 ? nullptr : &slots[head].value;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 const T* StaticQueue<T, N>::try_front() const noexcept {
+    return queueSize == 0 ? nullptr : &slots[head].value;
+}
+
+// Observers
+template<typename T, size_t N>
+FWD_CONSTEXPR20 bool StaticQueue<T, N>::is_empty() const noexcept {
+    return queueSize == 0;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 bool StaticQueue<T, N>::empty() const noexcept {
+    return queueSize == 0;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 bool StaticQueue<T, N>::is_full() const noexcept {
+    return queueSize == N;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 size_t StaticQueue<T, N>::size() const noexcept {
+    return queueSize;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 size_t StaticQueue<T, N>::getSize() const noexcept {
+    return queueSize;
+}
+
+// Iterators
+template<typename T, size_t N>
+FWD_CONSTEXPR20 auto StaticQueue<T, N>::begin() noexcept -> iterator {
+    return iterator(slots, head, 0);
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 auto StaticQueue<T, N>::end() noexcept -> iterator {
+    return iterator(slots, head, queueSize);
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 auto StaticQueue<T, N>::begin() const noexcept -> const_iterator {
+    return const_iterator(slots, head, 0);
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 auto StaticQueue<T, N>::end() const noexcept -> const_iterator {
+    return const_iterator(slots, head, queueSize);
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 auto StaticQueue<T, N>::cbegin() const noexcept -> const_iterator {
+    return begin();
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 auto StaticQueue<T, N>::cend() const noexcept -> const_iterator {
+    return end();
+}
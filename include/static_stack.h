@@ -0,0 +1,449 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+
+#include "static_storage.h"
+
+/**
+ * @brief Fixed-capacity stack stored entirely inside the object
+ * @tparam T Type of elements stored in the stack
+ * @tparam N Maximum number of elements held at once
+ *
+ * Never allocates and never throws by itself: push and emplace return static_status::full
+ * instead of growing, and the only exceptions that can escape are those of T's own
+ * constructors and assignments. The member names follow Stack<T> (push, pop, top,
+ * get_front, try_pop, try_front, size, begin/end), so code written against Stack<T> can
+ * switch to it through a type alias. Built as C++20 every member is constexpr, so a
+ * StaticStack of a literal type can be filled and read in a constant expression.
+ *
+ * pop(), top() and get_front() require a non-empty stack (checked by assert); pop(T&),
+ * try_pop() and try_front() are the checked variants. This is where the switch from
+ * Stack<T> is not transparent: Stack<T> throws std::runtime_error on an empty stack, here the
+ * call is undefined behaviour once NDEBUG removes the assert.
+ */
+template<typename T, size_t N>
+class StaticStack final {
+    static_assert(N > 0, "StaticStack capacity must be positive");
+
+public:
+    /**
+     * @brief Iterator implementation for StaticStack (non-const version)
+     */
+    class static_stack_iterator {
+    private:
+        StaticSlot<T>* slots; ///< Start of the slot array
+        size_t index;         ///< One past the slot of the current element (0 at the end)
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = T*;
+        using reference         = T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        constexpr static_stack_iterator() noexcept : slots(nullptr), index(0) {}
+
+        /**
+         * @brief Constructor
+         * @param s Start of the slot array
+         * @param i One past the slot of the element to point at
+         */
+        constexpr static_stack_iterator(StaticSlot<T>* s, size_t i) noexcept : slots(s), index(i) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Reference to the current element
+         */
+        constexpr T& operator*() const noexcept { return slots[index - 1].value; }
+
+        /**
+         * @brief Member access operator
+         * @return Pointer to the current element
+         */
+        constexpr T* operator->() const noexcept { return &slots[index - 1].value; }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        constexpr static_stack_iterator& operator++() noexcept {
+            --index;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        constexpr static_stack_iterator operator++(int) noexcept {
+            static_stack_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same slot
+         */
+        friend constexpr bool operator==(const static_stack_iterator& lhs, const static_stack_iterator& rhs) noexcept {
+            return lhs.slots == rhs.slots && lhs.index == rhs.index;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different slots
+         */
+        friend constexpr bool operator!=(const static_stack_iterator& lhs, const static_stack_iterator& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+        /**
+         * @brief Get the slot array
+         * @return Pointer to the bottom slot
+         */
+        constexpr StaticSlot<T>* get_slots() const noexcept { return slots; }
+
+        /**
+         * @brief Get the current position
+         * @return One past the slot of the current element
+         */
+        constexpr size_t get_index() const noexcept { return index; }
+    };
+
+    /**
+     * @brief Const iterator implementation for StaticStack
+     */
+    class static_stack_const_iterator {
+    private:
+        const StaticSlot<T>* slots; ///< Start of the slot array
+        size_t index;               ///< One past the slot of the current element (0 at the end)
+
+    public:
+        using difference_type   = ptrdiff_t;
+        using value_type        = T;
+        using pointer           = const T*;
+        using reference         = const T&;
+        using iterator_category = std::forward_iterator_tag;
+
+        /**
+         * @brief Default constructor - creates a singular iterator
+         */
+        constexpr static_stack_const_iterator() noexcept : slots(nullptr), index(0) {}
+
+        /**
+         * @brief Constructor
+         * @param s Start of the slot array
+         * @param i One past the slot of the element to point at
+         */
+        constexpr static_stack_const_iterator(const StaticSlot<T>* s, size_t i) noexcept : slots(s), index(i) {}
+
+        /**
+         * @brief Constructor from non-const iterator
+         * @param other Iterator to convert from
+         */
+        constexpr static_stack_const_iterator(const static_stack_iterator& other) noexcept
+            : slots(other.get_slots()), index(other.get_index()) {}
+
+        /**
+         * @brief Dereference operator
+         * @return Const reference to the current element
+         */
+        constexpr const T& operator*() const noexcept { return slots[index - 1].value; }
+
+        /**
+         * @brief Member access operator
+         * @return Const pointer to the current element
+         */
+        constexpr const T* operator->() const noexcept { return &slots[index - 1].value; }
+
+        /**
+         * @brief Prefix increment operator
+         * @return Reference to this iterator
+         */
+        constexpr static_stack_const_iterator& operator++() noexcept {
+            --index;
+            return *this;
+        }
+
+        /**
+         * @brief Postfix increment operator
+         * @return Copy of iterator before increment
+         */
+        constexpr static_stack_const_iterator operator++(int) noexcept {
+            static_stack_const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /**
+         * @brief Equality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if both iterators point to the same slot
+         */
+        friend constexpr bool operator==(const static_stack_const_iterator& lhs, const static_stack_const_iterator& rhs) noexcept {
+            return lhs.slots == rhs.slots && lhs.index == rhs.index;
+        }
+
+        /**
+         * @brief Inequality comparison
+         * @param lhs First iterator
+         * @param rhs Second iterator
+         * @return True if iterators point to different slots
+         */
+        friend constexpr bool operator!=(const static_stack_const_iterator& lhs, const static_stack_const_iterator& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+    };
+
+    using iterator = static_stack_iterator;
+    using const_iterator = static_stack_const_iterator;
+    using value_type = T;
+
+    /**
+     * @brief Default constructor - creates an empty stack
+     */
+    FWD_CONSTEXPR20 StaticStack() noexcept;
+
+    /**
+     * @brief Copy constructor - copies the elements of another stack
+     * @param other Stack to copy from
+     */
+    FWD_CONSTEXPR20 StaticStack(const StaticStack& other) noexcept(std::is_nothrow_copy_constructible_v<T>);
+
+    /**
+     * @brief Move constructor - moves the elements of another stack one by one
+     * @param other Stack to move from (left empty)
+     */
+    FWD_CONSTEXPR20 StaticStack(StaticStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Copy assignment operator
+     * @param other Stack to copy from
+     * @return Reference to this stack
+     */
+    FWD_CONSTEXPR20 StaticStack& operator=(const StaticStack& other) noexcept(std::is_nothrow_copy_constructible_v<T>);
+
+    /**
+     * @brief Move assignment operator
+     * @param other Stack to move from (left empty)
+     * @return Reference to this stack
+     */
+    FWD_CONSTEXPR20 StaticStack& operator=(StaticStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Destructor - destroys the remaining elements
+     */
+    FWD_CONSTEXPR20 ~StaticStack();
+
+    /**
+     * @brief Add element to the top of the stack (copy semantics)
+     * @param value The value to add
+     * @return static_status::ok, or static_status::full if the stack is at capacity
+     */
+    FWD_CONSTEXPR20 static_status push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>);
+
+    /**
+     * @brief Add element to the top of the stack (move semantics)
+     * @param value The value to add (left untouched if the stack is full)
+     * @return static_status::ok, or static_status::full if the stack is at capacity
+     */
+    FWD_CONSTEXPR20 static_status push(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Construct an element in place on the top of the stack
+     * @param args Arguments forwarded to the T constructor
+     * @return static_status::ok, or static_status::full if the stack is at capacity
+     */
+    template<typename... Args>
+    FWD_CONSTEXPR20 static_status emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>);
+
+    /**
+     * @brief Add element to the top of the stack if there is room
+     * @param value The value to add
+     * @return True if the element was added, false if the stack was full
+     */
+    FWD_CONSTEXPR20 bool try_push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>);
+
+    /**
+     * @brief Add element to the top of the stack if there is room
+     * @param value The value to add (left untouched if the stack is full)
+     * @return True if the element was added, false if the stack was full
+     */
+    FWD_CONSTEXPR20 bool try_push(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Remove and return element from the top of the stack
+     * @return The removed element from top
+     * @pre The stack is not empty
+     */
+    FWD_CONSTEXPR20 T pop() noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Remove the top element if there is one
+     * @param out Receives the removed element
+     * @return static_status::ok, or static_status::empty if there was nothing to remove
+     */
+    FWD_CONSTEXPR20 static_status pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+    /**
+     * @brief Remove the top element if there is one
+     * @param out Receives the removed element
+     * @return True if an element was removed, false if the stack was empty
+     */
+    FWD_CONSTEXPR20 bool try_pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>);
+
+    /**
+     * @brief Remove the top element if there is one
+     * @return The removed element, or std::nullopt if the stack was empty
+     */
+    FWD_CONSTEXPR20 std::optional<T> try_pop() noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /**
+     * @brief Get reference to the top element
+     * @return Reference to the top element
+     * @pre The stack is not empty
+     */
+    FWD_CONSTEXPR20 T& get_front() noexcept;
+
+    /**
+     * @brief Get const reference to the top element
+     * @return Const reference to the top element
+     * @pre The stack is not empty
+     */
+    FWD_CONSTEXPR20 const T& get_front() const noexcept;
+
+    /**
+     * @brief Get reference to the top element (same as get_front)
+     * @return Reference to the top element
+     * @pre The stack is not empty
+     */
+    FWD_CONSTEXPR20 T& top() noexcept;
+
+    /**
+     * @brief Get const reference to the top element (same as get_front)
+     * @return Const reference to the top element
+     * @pre The stack is not empty
+     */
+    FWD_CONSTEXPR20 const T& top() const noexcept;
+
+    /**
+     * @brief Get pointer to the top element
+     * @return Pointer to the top element, or nullptr if the stack is empty
+     */
+    FWD_CONSTEXPR20 T* try_front() noexcept;
+
+    /**
+     * @brief Get const pointer to the top element
+     * @return Const pointer to the top element, or nullptr if the stack is empty
+     */
+    FWD_CONSTEXPR20 const T* try_front() const noexcept;
+
+    /**
+     * @brief Check if stack is empty
+     * @return True if stack is empty, false otherwise
+     */
+    FWD_CONSTEXPR20 bool is_empty() const noexcept;
+
+    /**
+     * @brief Checks if the stack is empty
+     * @return true if stack is empty, false otherwise
+     */
+    FWD_CONSTEXPR20 bool empty() const noexcept;
+
+    /**
+     * @brief Check if the stack is at capacity
+     * @return True if push would return static_status::full
+     */
+    FWD_CONSTEXPR20 bool is_full() const noexcept;
+
+    /**
+     * @brief Get the number of elements in stack
+     * @return Size of the stack
+     */
+    FWD_CONSTEXPR20 size_t size() const noexcept;
+
+    /**
+     * @brief Returns the number of elements in the stack
+     * @return Size of the stack
+     */
+    FWD_CONSTEXPR20 size_t getSize() const noexcept;
+
+    /**
+     * @brief Returns the maximum number of elements the stack can hold
+     * @return N
+     */
+    static constexpr size_t capacity() noexcept { return N; }
+
+    /**
+     * @brief Destroy all elements
+     */
+    FWD_CONSTEXPR20 void clear() noexcept;
+
+    /**
+     * @brief Get iterator to the top element
+     * @return Iterator to the top element
+     */
+    FWD_CONSTEXPR20 iterator begin() noexcept;
+
+    /**
+     * @brief Get iterator to the position below the bottom element
+     * @return Iterator to the end
+     */
+    FWD_CONSTEXPR20 iterator end() noexcept;
+
+    /**
+     * @brief Get const iterator to the top element
+     * @return Const iterator to the top element
+     */
+    FWD_CONSTEXPR20 const_iterator begin() const noexcept;
+
+    /**
+     * @brief Get const iterator to the position below the bottom element
+     * @return Const iterator to the end
+     */
+    FWD_CONSTEXPR20 const_iterator end() const noexcept;
+
+    /**
+     * @brief Get const iterator to the top element
+     * @return Const iterator to the top element
+     */
+    FWD_CONSTEXPR20 const_iterator cbegin() const noexcept;
+
+    /**
+     * @brief Get const iterator to the position below the bottom element
+     * @return Const iterator to the end
+     */
+    FWD_CONSTEXPR20 const_iterator cend() const noexcept;
+
+private:
+    /**
+     * @brief Destroy the top element
+     */
+    FWD_CONSTEXPR20 void drop_top() noexcept;
+
+    /**
+     * @brief Append copies (lvalue source) or moves (rvalue source) of another container's elements
+     * @param other Container to take the elements from
+     *
+     * If constructing an element throws, every element of this container is destroyed
+     * before the exception propagates.
+     */
+    template<typename Source>
+    FWD_CONSTEXPR20 void append_elements(Source&& other);
+
+    StaticSlot<T> slots[N]; ///< Elements bottom-up; the first stackSize slots are live
+    size_t stackSize;       ///< Number of elements in the stack
+};
+
+#include "static_stack.ipp"
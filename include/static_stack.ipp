@@ -0,0 +1,241 @@
+#include "static_stack.h"
+#include <utility>
+
+// StaticStack constructors and operators
+template<typename T, size_t N>
+FWD_CONSTEXPR20 StaticStack<T, N>::StaticStack() noexcept : stackSize(0) {}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 StaticStack<T, N>::StaticStack(const StaticStack& other) noexcept(std::is_nothrow_copy_constructible_v<T>)
+    : stackSize(0) {
+    append_elements(other);
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 StaticStack<T, N>::StaticStack(StaticStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    : stackSize(0) {
+    append_elements(std::move(other));
+    other.clear();
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 StaticStack<T, N>& StaticStack<T, N>::operator=(const StaticStack& other) noexcept(std::is_nothrow_copy_constructible_v<T>) {
+    if (this != &other) {
+        clear();
+        append_elements(other);
+    }
+    return *this;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 StaticStack<T, N>& StaticStack<T, N>::operator=(StaticStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+        clear();
+        append_elements(std::move(other));
+        other.clear();
+    }
+    return *this;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 StaticStack<T, N>::~StaticStack() {
+    clear();
+}
+
+template<typename T, size_t N>
+template<typename Source>
+FWD_CONSTEXPR20 void StaticStack<T, N>::append_elements(Source&& other) {
+    constexpr bool moving = !std::is_lvalue_reference_v<Source>;
+    constexpr bool nothrow = moving ? std::is_nothrow_move_constructible_v<T> : std::is_nothrow_copy_constructible_v<T>;
+
+    auto append = [&] {
+        for (size_t i = 0; i < other.stackSize; ++i) {
+            if constexpr (moving) {
+                slots[stackSize].construct(std::move(other.slots[i].value));
+            }
+            else {
+                slots[stackSize].construct(other.slots[i].value);
+            }
+            ++stackSize;
+        }
+    };
+
+    if constexpr (nothrow) {
+        append();
+    }
+    else {
+        // StaticSlot does not destroy its element, so a constructor that throws halfway
+        // must destroy the elements it already built itself
+        try {
+            append();
+        }
+        catch (...) {
+            clear();
+            throw;
+        }
+    }
+}
+
+// Modifiers
+template<typename T, size_t N>
+template<typename... Args>
+FWD_CONSTEXPR20 static_status StaticStack<T, N>::emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+    if (stackSize == N) return static_status::full;
+
+    slots[stackSize].construct(std::forward<Args>(args)...);
+    ++stackSize;
+    return static_status::ok;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 static_status StaticStack<T, N>::push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>) {
+    return emplace(value);
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 static_status StaticStack<T, N>::push(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    return emplace(std::move(value));
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 bool StaticStack<T, N>::try_push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>) {
+    return emplace(value) == static_status::ok;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 bool StaticStack<T, N>::try_push(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    return emplace(std::move(value)) == static_status::ok;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 void StaticStack<T, N>::drop_top() noexcept {
+    --stackSize;
+    slots[stackSize].destroy();
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 T StaticStack<T, N>::pop() noexcept(std::is_nothrow_move_constructible_v<T>) {
+    assert(stackSize > 0 && "Cannot pop: StaticStack is empty");
+
+    T value = std::move(slots[stackSize - 1].value);
+    drop_top();
+    return value;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 static_status StaticStack<T, N>::pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    if (stackSize == 0) return static_status::empty;
+
+    out = std::move(slots[stackSize - 1].value);
+    drop_top();
+    return static_status::ok;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 bool StaticStack<T, N>::try_pop(T& out) noexcept(std::is_nothrow_move_assignable_v<T>) {
+    return pop(out) == static_status::ok;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 std::optional<T> StaticStack<T, N>::try_pop() noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if (stackSize == 0) return std::nullopt;
+
+    std::optional<T> value(std::move(slots[stackSize - 1].value));
+    drop_top();
+    return value;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 void StaticStack<T, N>::clear() noexcept {
+    while (stackSize > 0) drop_top();
+}
+
+// Element access
+template<typename T, size_t N>
+FWD_CONSTEXPR20 T& StaticStack<T, N>::get_front() noexcept {
+    assert(stackSize > 0 && "Cannot get top data: StaticStack is empty");
+    return slots[stackSize - 1].value;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 const T& StaticStack<T, N>::get_front() const noexcept {
+    assert(stackSize > 0 && "Cannot get top data: StaticStack is empty");
+    return slots[stackSize - 1].value;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 T& StaticStack<T, N>::top() noexcept {
+    return get_front();
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 const T& StaticStack<T, N>::top() const noexcept {
+    return get_front();
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 T* StaticStack<T, N>::try_front() noexcept {
+    return stackSize == 0 ? nullptr : &slots[stackSize - 1].value;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 const T* StaticStack<T, N>::try_front() const noexcept {
+    return stackSize == 0 ? nullptr : &slots[stackSize - 1].value;
+}
+
+// Observers
+template<typename T, size_t N>
+FWD_CONSTEXPR20 bool StaticStack<T, N>::is_empty() const noexcept {
+    return stackSize == 0;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 bool StaticStack<T, N>::empty() const noexcept {
+    return stackSize == 0;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 bool StaticStack<T, N>::is_full() const noexcept {
+    return stackSize == N;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 size_t StaticStack<T, N>::size() const noexcept {
+    return stackSize;
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 size_t StaticStack<T, N>::getSize() const noexcept {
+    return stackSize;
+}
+
+// Iterators
+template<typename T, size_t N>
+FWD_CONSTEXPR20 auto StaticStack<T, N>::begin() noexcept -> iterator {
+    return iterator(slots, stackSize);
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 auto StaticStack<T, N>::end() noexcept -> iterator {
+    return iterator(slots, 0);
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 auto StaticStack<T, N>::begin() const noexcept -> const_iterator {
+    return const_iterator(slots, stackSize);
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 auto StaticStack<T, N>::end() const noexcept -> const_iterator {
+    return const_iterator(slots, 0);
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 auto StaticStack<T, N>::cbegin() const noexcept -> const_iterator {
+    return begin();
+}
+
+template<typename T, size_t N>
+FWD_CONSTEXPR20 auto StaticStack<T, N>::cend() const noexcept -> const_iterator {
+    return end();
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * @brief Expands to constexpr where construct_at/destroy_at are usable in constant expressions (C++20)
+ *
+ * StaticStack and StaticQueue mark every member with it, so the same code builds as C++17
+ * (plain inline functions) and as C++20 (usable at compile time).
+ */
+#if defined(__cpp_lib_constexpr_dynamic_alloc) && __cpp_lib_constexpr_dynamic_alloc >= 201907L
+#define FWD_CONSTEXPR20 constexpr
+#define FWD_HAS_CONSTEXPR_CONTAINERS 1
+#else
+#define FWD_CONSTEXPR20 inline
+#define FWD_HAS_CONSTEXPR_CONTAINERS 0
+#endif
+
+/**
+ * @brief Result of an operation on a fixed-capacity container
+ *
+ * Returned instead of throwing by StaticStack and StaticQueue, which never allocate and
+ * never throw on their own.
+ */
+enum class static_status {
+    ok,    ///< The operation succeeded
+    full,  ///< Nothing was added: the container is at capacity
+    empty  ///< Nothing was removed: the container holds no elements
+};
+
+/**
+ * @brief One element slot of a fixed-capacity container
+ * @tparam T Type of the element
+ *
+ * A union, so that an array of slots reserves room for T without constructing it and
+ * without requiring T to be default constructible. The owner tracks which slots are live
+ * and constructs and destroys value itself.
+ */
+template<typename T>
+union StaticSlot {
+    T value; ///< The element, live only while the owner says so
+
+    FWD_CONSTEXPR20 StaticSlot() noexcept {}
+    FWD_CONSTEXPR20 ~StaticSlot() {}
+
+    StaticSlot(const StaticSlot&) = delete;
+    StaticSlot& operator=(const StaticSlot&) = delete;
+
+    /**
+     * @brief Construct the element of this slot
+     * @param args Arguments forwarded to the T constructor
+     * @return Reference to the new element
+     */
+    template<typename... Args>
+    FWD_CONSTEXPR20 T& construct(Args&&... args) {
+#if FWD_HAS_CONSTEXPR_CONTAINERS
+        return *std::construct_at(&value, std::forward<Args>(args)...);
+#else
+        return *::new (static_cast<void*>(&value)) T(std::forward<Args>(args)...);
+#endif
+    }
+
+    /**
+     * @brief Destroy the element of this slot
+     */
+    FWD_CONSTEXPR20 void destroy() noexcept {
+        std::destroy_at(&value);
+    }
+};
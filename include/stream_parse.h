@@ -0,0 +1,148 @@
+#pragma once
+#include <charconv>
+#include <cstddef>
+#include <iostream>
+#include <locale>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+/**
+ * @brief True for element types that read() parses with std::from_chars instead of operator>>
+ * @tparam T Element type
+ *
+ * Covers integers and floating-point types; bool and the character types keep going
+ * through operator>>, whose rules for them are not those of a number.
+ */
+template<typename T>
+inline constexpr bool is_fast_parsable_v =
+    std::is_floating_point_v<T> ||
+    (std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+     !std::is_same_v<T, signed char> && !std::is_same_v<T, unsigned char> &&
+     !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>);
+
+/**
+ * @brief Checks whether operator>> on the stream reads numbers the way parse_text_elements does
+ * @param is Input stream
+ * @return True if the stream skips whitespace, reads integers as decimal and uses the
+ *         classic locale (no digit grouping, '.' as decimal point)
+ *
+ * read() takes the fast path only when this holds and otherwise falls back to
+ * operator>>, so std::hex, std::noskipws or an imbued locale keep their meaning.
+ */
+inline bool fast_parse_applies(const std::istream& is) {
+    return (is.flags() & (std::ios::basefield | std::ios::skipws)) == (std::ios::dec | std::ios::skipws) &&
+           is.getloc() == std::locale::classic();
+}
+
+/**
+ * @brief Checks for the whitespace that separates tokens in the classic locale
+ * @param c Character to test
+ * @return True for space, tab, newline, vertical tab, form feed and carriage return
+ */
+inline bool is_token_space(char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+/**
+ * @brief Parses one whitespace-free token as a T
+ * @tparam T Arithmetic element type
+ * @param first Start of the token
+ * @param last End of the token
+ * @return The parsed value
+ * @throws std::runtime_error if the token is not a complete number or is out of range
+ *
+ * Follows num_get where from_chars differs: an explicit '+' is accepted, a '-' before an
+ * unsigned type wraps the value around ("-1" is the largest value), and "inf" and
+ * "nan" are rejected. One difference remains: a floating-point value too small to
+ * represent is an error here, where operator>> reads it as zero.
+ */
+template<typename T>
+T parse_token(const char* first, const char* last) {
+    // operator>> accepts an explicit plus sign, from_chars does not; it also takes a minus
+    // sign before an unsigned type, which from_chars does not either
+    bool negate = false;
+    if (last - first > 1 && (*first == '+' || (std::is_unsigned_v<T> && *first == '-'))) {
+        negate = *first == '-';
+        ++first;
+        if (*first == '+' || *first == '-') throw std::runtime_error("Failed to parse input data");
+    }
+
+    if constexpr (std::is_floating_point_v<T>) {
+        // from_chars reads inf and nan, num_get only digits
+        const char* digits = first != last && *first == '-' ? first + 1 : first;
+        if (digits == last || !((*digits >= '0' && *digits <= '9') || *digits == '.')) {
+            throw std::runtime_error("Failed to parse input data");
+        }
+    }
+
+    T value{};
+    std::from_chars_result result = std::from_chars(first, last, value);
+    if (result.ec != std::errc() || result.ptr != last) {
+        throw std::runtime_error("Failed to parse input data");
+    }
+    if constexpr (std::is_unsigned_v<T>) {
+        if (negate) value = static_cast<T>(0 - value);
+    }
+    return value;
+}
+
+/**
+ * @brief Parses whitespace-separated numbers until the end of the stream
+ * @tparam T Arithmetic element type (see is_fast_parsable_v)
+ * @tparam Sink Callable taking a T
+ * @param is Input stream; its buffer is read directly in large blocks
+ * @param sink Receives the values in stream order
+ * @throws std::runtime_error if a token is not a number or the sink throws
+ *
+ * Equivalent to looping over operator>> until end of input, minus the sentry and
+ * locale work per element, as long as fast_parse_applies(is) holds; callers check it.
+ * A token split across two blocks is carried over in a small side buffer.
+ *
+ * Input is consumed a block at a time, so after a parse error up to 64 KB past the bad
+ * token may already have been taken from the stream (operator>> stops at the bad token).
+ */
+template<typename T, typename Sink>
+void parse_text_elements(std::istream& is, Sink&& sink) {
+    std::streambuf* buffer = is.rdbuf();
+    if (buffer == nullptr) throw std::runtime_error("Input stream has no buffer");
+
+    constexpr size_t block_size = 64 * 1024;
+    std::unique_ptr<char[]> block(new char[block_size]);
+    std::string pending; // Start of a token cut off by the end of the previous block
+
+    while (true) {
+        std::streamsize got = buffer->sgetn(block.get(), static_cast<std::streamsize>(block_size));
+        if (got <= 0) break;
+
+        const char* p = block.get();
+        const char* end = p + got;
+
+        if (!pending.empty()) {
+            const char* stop = p;
+            while (stop != end && !is_token_space(*stop)) ++stop;
+            pending.append(p, stop);
+            if (stop == end) continue;
+            sink(parse_token<T>(pending.data(), pending.data() + pending.size()));
+            pending.clear();
+            p = stop;
+        }
+
+        while (true) {
+            while (p != end && is_token_space(*p)) ++p;
+            if (p == end) break;
+
+            const char* token = p;
+            while (p != end && !is_token_space(*p)) ++p;
+            if (p == end) {
+                pending.assign(token, end);
+                break;
+            }
+            sink(parse_token<T>(token, p));
+        }
+    }
+
+    if (!pending.empty()) sink(parse_token<T>(pending.data(), pending.data() + pending.size()));
+}
@@ -0,0 +1,138 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "concurrent_queue.h"
+#include "work_stealing_deque.h"
+
+/**
+ * @brief Fixed-size pool of worker threads scheduling tasks through work-stealing deques
+ *
+ * Every worker owns a WorkStealingDeque. A task submitted from inside a running task is
+ * pushed onto the submitting worker's own deque and, unless another worker steals it,
+ * runs on the same thread next, while the submitting task's data is still in its cache. Tasks
+ * submitted from outside the pool go through a shared lock-free ConcurrentQueue. An
+ * idle worker first drains its own deque, then the shared queue, then steals the
+ * oldest task of the other workers; only when all of that comes up empty does it sleep.
+ * No single lock or queue head is shared by all tasks, which is what keeps the pool
+ * scaling with the number of cores. steal_count() tells how often load balancing kicked in.
+ */
+class ThreadPool {
+public:
+    using task_type = std::function<void()>;
+
+    /**
+     * @brief Starts the worker threads
+     * @param threads Number of workers, or 0 for one per hardware thread
+     * @throws std::system_error if a thread cannot be started
+     */
+    explicit ThreadPool(size_t threads = 0);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Runs every submitted task to completion, then stops and joins the workers
+     *
+     * Exceptions thrown by tasks that were never collected through wait_idle() are dropped.
+     */
+    ~ThreadPool();
+
+    /**
+     * @brief Schedule a task
+     * @tparam F Callable with signature void(); must be copy-constructible (it is stored in a std::function)
+     * @param task Callable to run on one of the workers
+     * @throws std::runtime_error if memory allocation fails
+     */
+    template<typename F>
+    void submit(F&& task);
+
+    /**
+     * @brief Block until every submitted task, including tasks submitted by tasks, has finished
+     * @throws The first exception thrown by a task since the previous wait_idle()
+     * @throws std::runtime_error if called from one of the pool's own workers (it would never return)
+     */
+    void wait_idle();
+
+    /**
+     * @brief Get the number of worker threads
+     * @return Number of workers
+     */
+    size_t thread_count() const noexcept;
+
+    /**
+     * @brief Check whether the calling thread is one of this pool's workers
+     * @return True when called from inside a task run by this pool
+     */
+    bool is_worker() const noexcept;
+
+    /**
+     * @brief Get the number of tasks that ran on another worker than the one they were pushed to
+     * @return Total number of successful steals
+     */
+    size_t steal_count() const noexcept;
+
+private:
+    /**
+     * @brief Per-thread state of a worker
+     */
+    struct worker {
+        WorkStealingDeque<task_type> tasks; ///< Tasks submitted by this worker (owner end used by it only)
+        std::thread thread;                 ///< Thread running the worker loop
+    };
+
+    /**
+     * @brief Worker loop: find a task, run it, sleep when there is nothing to do
+     * @param index Position of the worker in workers
+     */
+    void run(size_t index);
+
+    /**
+     * @brief Look for a task in the worker's own deque, the shared queue and the other workers' deques
+     * @param index Position of the searching worker
+     * @param out Receives the task
+     * @return True if a task was found
+     */
+    bool find_task(size_t index, task_type& out);
+
+    /**
+     * @brief Run a task, record its exception and account for its completion
+     * @param task Task to run (reset afterwards)
+     */
+    void execute(task_type& task) noexcept;
+
+    /**
+     * @brief Wake one sleeping worker, if any
+     */
+    void wake_one();
+
+    /**
+     * @brief Stop the workers and join them; called once everything has finished
+     */
+    void shutdown() noexcept;
+
+    std::vector<std::unique_ptr<worker>> workers; ///< Worker state, fixed after construction
+    ConcurrentQueue<task_type> injected;          ///< Tasks submitted from outside the pool
+    std::atomic<size_t> queuedTasks;              ///< Tasks submitted and not yet taken by a worker
+    std::atomic<size_t> unfinishedTasks;          ///< Tasks submitted and not yet finished
+    std::atomic<size_t> sleepingWorkers;          ///< Workers waiting on wakeWorkers
+    std::atomic<size_t> stolenTasks;              ///< Successful steals, for steal_count()
+    bool stopping;                                ///< Set under sleepMutex once the pool shuts down
+    std::mutex sleepMutex;                        ///< Guards sleeping, idle waits and firstFailure
+    std::condition_variable wakeWorkers;          ///< Signalled when a task is queued or the pool stops
+    std::condition_variable allDone;              ///< Signalled when unfinishedTasks drops to zero
+    std::exception_ptr firstFailure;              ///< First exception thrown by a task
+
+    inline static thread_local ThreadPool* currentPool = nullptr; ///< Pool of the calling worker thread
+    inline static thread_local size_t currentWorker = 0;          ///< Index of the calling worker thread
+};
+
+#include "thread_pool.ipp"
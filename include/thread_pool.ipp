@@ -0,0 +1,158 @@
+#include "thread_pool.h"
+
+#include <utility>
+
+// Construction and shutdown
+inline ThreadPool::ThreadPool(size_t threads)
+    : queuedTasks(0), unfinishedTasks(0), sleepingWorkers(0), stolenTasks(0), stopping(false) {
+    size_t count = threads != 0 ? threads : std::thread::hardware_concurrency();
+    if (count == 0) count = 1;
+
+    // Every deque exists before the first thread starts looking for work to steal
+    workers.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        workers.push_back(std::make_unique<worker>());
+    }
+
+    try {
+        for (size_t i = 0; i < count; ++i) {
+            workers[i]->thread = std::thread([this, i] { run(i); });
+        }
+    }
+    catch (...) {
+        shutdown();
+        throw;
+    }
+}
+
+inline ThreadPool::~ThreadPool() {
+    {
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        allDone.wait(lock, [this] { return unfinishedTasks.load() == 0; });
+    }
+    shutdown();
+}
+
+inline void ThreadPool::shutdown() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wakeWorkers.notify_all();
+    for (std::unique_ptr<worker>& w : workers) {
+        if (w->thread.joinable()) w->thread.join();
+    }
+}
+
+// Scheduling
+template<typename F>
+void ThreadPool::submit(F&& task) {
+    task_type wrapped(std::forward<F>(task));
+    unfinishedTasks.fetch_add(1);
+    // Counted before it becomes visible, so a worker taking it never sees the count at zero
+    queuedTasks.fetch_add(1);
+    try {
+        if (currentPool == this) {
+            workers[currentWorker]->tasks.push(std::move(wrapped));
+        } else {
+            injected.push(std::move(wrapped));
+        }
+    }
+    catch (...) {
+        queuedTasks.fetch_sub(1);
+        if (unfinishedTasks.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            allDone.notify_all();
+        }
+        throw;
+    }
+    wake_one();
+}
+
+inline void ThreadPool::wake_one() {
+    // Pairs with the increment of sleepingWorkers in run(): either the sleeper sees the
+    // queued task before waiting, or this sees the sleeper and notifies it
+    if (sleepingWorkers.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wakeWorkers.notify_one();
+    }
+}
+
+inline void ThreadPool::wait_idle() {
+    if (is_worker()) throw std::runtime_error("Cannot wait for ThreadPool from one of its own tasks");
+
+    std::unique_lock<std::mutex> lock(sleepMutex);
+    allDone.wait(lock, [this] { return unfinishedTasks.load() == 0; });
+    if (firstFailure) {
+        std::exception_ptr failure = std::exchange(firstFailure, nullptr);
+        std::rethrow_exception(failure);
+    }
+}
+
+inline size_t ThreadPool::thread_count() const noexcept {
+    return workers.size();
+}
+
+inline bool ThreadPool::is_worker() const noexcept {
+    return currentPool == this;
+}
+
+inline size_t ThreadPool::steal_count() const noexcept {
+    return stolenTasks.load(std::memory_order_relaxed);
+}
+
+// Workers
+inline void ThreadPool::run(size_t index) {
+    currentPool = this;
+    currentWorker = index;
+
+    task_type task;
+    while (true) {
+        if (find_task(index, task)) {
+            queuedTasks.fetch_sub(1);
+            execute(task);
+            continue;
+        }
+        if (queuedTasks.load() > 0) {
+            // A task is still being pushed, or another worker beat this one to it
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepingWorkers.fetch_add(1);
+        wakeWorkers.wait(lock, [this] { return stopping || queuedTasks.load() > 0; });
+        sleepingWorkers.fetch_sub(1);
+        if (stopping && queuedTasks.load() == 0) return;
+    }
+}
+
+inline bool ThreadPool::find_task(size_t index, task_type& out) {
+    if (workers[index]->tasks.try_pop(out)) return true;
+    if (injected.try_pop(out)) return true;
+
+    const size_t count = workers.size();
+    for (size_t offset = 1; offset < count; ++offset) {
+        if (workers[(index + offset) % count]->tasks.try_steal(out)) {
+            stolenTasks.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void ThreadPool::execute(task_type& task) noexcept {
+    try {
+        task();
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        if (!firstFailure) firstFailure = std::current_exception();
+    }
+    task = nullptr;
+
+    if (unfinishedTasks.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        allDone.notify_all();
+    }
+}
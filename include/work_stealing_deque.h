@@ -0,0 +1,250 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * @brief True if T can sit directly in a lock-free std::atomic slot of a WorkStealingDeque
+ * @tparam T Element type
+ */
+template<typename T, bool = std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>>
+struct fits_atomic_slot : std::false_type {};
+
+template<typename T>
+struct fits_atomic_slot<T, true> : std::bool_constant<std::atomic<T>::is_always_lock_free> {};
+
+template<typename T>
+inline constexpr bool fits_atomic_slot_v = fits_atomic_slot<T>::value;
+
+/**
+ * @brief Chase–Lev work-stealing deque: one owner thread works at the bottom, any thread steals from the top
+ * @tparam T The type of elements stored in the deque
+ * @tparam Alloc Allocator for the elements and the ring, rebound internally (default: std::allocator<T>).
+ *               Elements are freed by whichever thread takes them, so the allocator must be thread-safe.
+ *
+ * The owner pushes and pops LIFO at the bottom like Stack<T>::push/pop, and only touches
+ * shared state when the deque is down to its last element. Thieves take the oldest
+ * element from the top like Queue<T>::pop with a single compare-and-swap on the top
+ * index. The indices live on separate cache lines, so an owner working through its own
+ * elements does not disturb the thieves. Small trivially copyable elements (integers,
+ * pointers) are stored in the ring itself; anything else is allocated once per push and
+ * the ring holds its address. The ring doubles when full; outgrown rings are kept until
+ * the deque is destroyed, because a slow thief may still be reading one.
+ *
+ * push(), pop() and try_pop() may only be called by the owner thread; steal(),
+ * try_steal(), is_empty() and size() may be called by any thread.
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+class WorkStealingDeque {
+public:
+    using allocator_type = Alloc;
+
+    static constexpr bool stores_inline = fits_atomic_slot_v<T>; ///< Elements live in the ring slots
+    static constexpr size_t default_capacity = 64;               ///< Initial ring size of a default-constructed deque
+
+    /**
+     * @brief Default constructor - creates an empty deque
+     * @throws std::runtime_error if the ring cannot be allocated
+     */
+    WorkStealingDeque();
+
+    /**
+     * @brief Creates an empty deque with room for capacity elements before the ring grows
+     * @param capacity Initial ring size (rounded up to a power of two, at least 2)
+     * @param alloc Allocator to use for the ring and the elements
+     * @throws std::runtime_error if the ring cannot be allocated
+     */
+    explicit WorkStealingDeque(size_t capacity, const Alloc& alloc = Alloc());
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Destructor - destroys remaining elements; no other thread may use the deque
+     */
+    ~WorkStealingDeque();
+
+    /**
+     * @brief Add element at the bottom of the deque (owner only, copy semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     */
+    void push(const T& value);
+
+    /**
+     * @brief Add element at the bottom of the deque (owner only, move semantics)
+     * @param value The value to add
+     * @throws std::runtime_error if memory allocation fails
+     */
+    void push(T&& value);
+
+    /**
+     * @brief Construct an element in place at the bottom of the deque (owner only)
+     * @param args Arguments forwarded to the T constructor
+     * @throws std::runtime_error if memory allocation fails
+     */
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    /**
+     * @brief Remove and return the newest element (owner only)
+     * @return The removed element
+     * @throws std::runtime_error if the deque is empty or a thief took the last element
+     */
+    T pop();
+
+    /**
+     * @brief Remove the newest element if there is one (owner only)
+     * @param out Receives the removed element
+     * @return True if an element was removed, false if the deque was empty
+     */
+    bool try_pop(T& out);
+
+    /**
+     * @brief Remove the newest element if there is one (owner only)
+     * @return The removed element, or std::nullopt if the deque was empty
+     */
+    std::optional<T> try_pop();
+
+    /**
+     * @brief Take the oldest element (any thread)
+     * @return The stolen element, or std::nullopt if the deque was empty or another thread got it first
+     */
+    std::optional<T> steal();
+
+    /**
+     * @brief Take the oldest element (any thread)
+     * @param out Receives the stolen element
+     * @return True if an element was stolen, false if the deque was empty or another thread got it first
+     */
+    bool try_steal(T& out);
+
+    /**
+     * @brief Check if deque is empty at the moment of the call
+     * @return True if no element was present
+     */
+    bool is_empty() const;
+
+    /**
+     * @brief Checks if the deque is empty at the moment of the call
+     * @return true if no element was present, false otherwise
+     */
+    bool empty() const;
+
+    /**
+     * @brief Get the approximate number of elements in deque
+     * @return Number of elements at the moment of the call; exact only while no other thread is active
+     */
+    size_t size() const;
+
+    /**
+     * @brief Get the current ring size (owner only)
+     * @return Number of elements the deque holds before its ring grows again
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Returns a copy of the allocator associated with the deque
+     * @return Allocator rebound back to the element type
+     */
+    Alloc get_allocator() const;
+
+private:
+    using Stored = std::conditional_t<stores_inline, T, T*>; ///< What a ring slot holds
+    using Slot = std::atomic<Stored>;
+
+    /**
+     * @brief Circular array of slots indexed by the unbounded top/bottom counters
+     */
+    struct ring {
+        size_t mask;    ///< Ring size minus one (the size is a power of two)
+        Slot* slots;    ///< Slot storage
+        ring* previous; ///< Outgrown ring kept alive for late thieves (nullptr for the first ring)
+
+        /**
+         * @brief Get the slot for a counter value
+         * @param index Top or bottom counter value
+         * @return Slot the index maps to
+         */
+        Slot& at(int64_t index) const noexcept { return slots[static_cast<size_t>(index) & mask]; }
+    };
+
+    using ElementAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+    using ElementTraits = std::allocator_traits<ElementAllocator>;
+    using RingAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<ring>;
+    using RingTraits = std::allocator_traits<RingAllocator>;
+    using SlotAllocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Slot>;
+    using SlotTraits = std::allocator_traits<SlotAllocator>;
+
+    static constexpr size_t cache_line = 64;
+
+    /**
+     * @brief Allocate a ring with every slot constructed
+     * @param capacity Ring size (a power of two)
+     * @param previous Ring it replaces, or nullptr
+     * @return The new ring
+     * @throws std::bad_alloc if allocation fails
+     */
+    ring* make_ring(size_t capacity, ring* previous);
+
+    /**
+     * @brief Free a ring and every ring it replaced
+     * @param r Newest ring of the chain
+     */
+    void free_rings(ring* r) noexcept;
+
+    /**
+     * @brief Replace a full ring by one twice its size holding the same elements (owner only)
+     * @param old Current ring
+     * @param t Top counter seen by the owner
+     * @param b Bottom counter
+     * @return The new ring, already published
+     * @throws std::bad_alloc if allocation fails; the deque is unchanged
+     */
+    ring* grow(ring* old, int64_t t, int64_t b);
+
+    /**
+     * @brief Turn constructor arguments into what a slot holds
+     * @param args Arguments forwarded to the T constructor
+     * @return The value itself, or the address of a newly allocated element
+     */
+    template<typename... Args>
+    Stored make_stored(Args&&... args);
+
+    /**
+     * @brief Extract the element from what a slot held, freeing its allocation
+     * @param stored Value or address taken out of the deque
+     * @return The element
+     */
+    T take_stored(Stored stored);
+
+    /**
+     * @brief Destroy an element that never leaves the deque
+     * @param stored Value or address held by a slot
+     */
+    void discard_stored(Stored stored) noexcept;
+
+    /**
+     * @brief Owner side of Chase–Lev: claim the bottom slot
+     * @return What the slot held, or std::nullopt if the deque was empty
+     */
+    std::optional<Stored> take_bottom() noexcept;
+
+    /**
+     * @brief Thief side of Chase–Lev: claim the top slot
+     * @return What the slot held, or std::nullopt if empty or lost to another thread
+     */
+    std::optional<Stored> steal_top() noexcept;
+
+    alignas(cache_line) std::atomic<int64_t> top;   ///< Next slot to steal (advanced by thieves and the last pop)
+    alignas(cache_line) std::atomic<int64_t> bottom; ///< Next slot to push (written by the owner)
+    std::atomic<ring*> array;                        ///< Current ring (replaced by the owner when it grows)
+    alignas(cache_line) ElementAllocator elementAlloc; ///< Allocator providing storage for out-of-slot elements
+};
+
+#include "work_stealing_deque.ipp"
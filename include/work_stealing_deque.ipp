@@ -0,0 +1,267 @@
+#include "work_stealing_deque.h"
+
+// Constructors and destructor
+template<typename T, typename Alloc>
+WorkStealingDeque<T, Alloc>::WorkStealingDeque() : WorkStealingDeque(default_capacity) {}
+
+template<typename T, typename Alloc>
+WorkStealingDeque<T, Alloc>::WorkStealingDeque(size_t capacity, const Alloc& alloc)
+    : top(0), bottom(0), array(nullptr), elementAlloc(alloc) {
+    size_t size = 2;
+    while (size < capacity) size *= 2;
+    try {
+        array.store(make_ring(size, nullptr), std::memory_order_relaxed);
+    }
+    catch (std::bad_alloc& e) {
+        throw std::runtime_error("Failed to allocate memory for deque ring: " + std::string(e.what()));
+    }
+}
+
+template<typename T, typename Alloc>
+WorkStealingDeque<T, Alloc>::~WorkStealingDeque() {
+    ring* a = array.load(std::memory_order_relaxed);
+    const int64_t b = bottom.load(std::memory_order_relaxed);
+    for (int64_t i = top.load(std::memory_order_relaxed); i < b; ++i) {
+        discard_stored(a->at(i).load(std::memory_order_relaxed));
+    }
+    free_rings(a);
+}
+
+// Ring management
+template<typename T, typename Alloc>
+auto WorkStealingDeque<T, Alloc>::make_ring(size_t capacity, ring* previous) -> ring* {
+    RingAllocator ringAlloc(elementAlloc);
+    SlotAllocator slotAlloc(elementAlloc);
+
+    Slot* slots = SlotTraits::allocate(slotAlloc, capacity);
+    ring* r = nullptr;
+    try {
+        r = RingTraits::allocate(ringAlloc, 1);
+    }
+    catch (...) {
+        SlotTraits::deallocate(slotAlloc, slots, capacity);
+        throw;
+    }
+
+    for (size_t i = 0; i < capacity; ++i) {
+        ::new (static_cast<void*>(slots + i)) Slot();
+    }
+    return ::new (static_cast<void*>(r)) ring{capacity - 1, slots, previous};
+}
+
+template<typename T, typename Alloc>
+void WorkStealingDeque<T, Alloc>::free_rings(ring* r) noexcept {
+    RingAllocator ringAlloc(elementAlloc);
+    SlotAllocator slotAlloc(elementAlloc);
+
+    while (r != nullptr) {
+        ring* previous = r->previous;
+        // Slots hold a trivially copyable value or a raw pointer, so they need no destructor call
+        SlotTraits::deallocate(slotAlloc, r->slots, r->mask + 1);
+        RingTraits::deallocate(ringAlloc, r, 1);
+        r = previous;
+    }
+}
+
+template<typename T, typename Alloc>
+auto WorkStealingDeque<T, Alloc>::grow(ring* old, int64_t t, int64_t b) -> ring* {
+    ring* bigger = make_ring(2 * (old->mask + 1), old);
+    for (int64_t i = t; i < b; ++i) {
+        bigger->at(i).store(old->at(i).load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    array.store(bigger, std::memory_order_release);
+    return bigger;
+}
+
+// Element storage
+template<typename T, typename Alloc>
+template<typename... Args>
+auto WorkStealingDeque<T, Alloc>::make_stored(Args&&... args) -> Stored {
+    if constexpr (stores_inline) {
+        return T(std::forward<Args>(args)...);
+    } else {
+        T* element = ElementTraits::allocate(elementAlloc, 1);
+        try {
+            ElementTraits::construct(elementAlloc, element, std::forward<Args>(args)...);
+        }
+        catch (...) {
+            ElementTraits::deallocate(elementAlloc, element, 1);
+            throw;
+        }
+        return element;
+    }
+}
+
+template<typename T, typename Alloc>
+T WorkStealingDeque<T, Alloc>::take_stored(Stored stored) {
+    if constexpr (stores_inline) {
+        return stored;
+    } else {
+        // The slot is already claimed, so the element must be freed even if moving it out throws
+        try {
+            T value(std::move(*stored));
+            discard_stored(stored);
+            return value;
+        }
+        catch (...) {
+            discard_stored(stored);
+            throw;
+        }
+    }
+}
+
+template<typename T, typename Alloc>
+void WorkStealingDeque<T, Alloc>::discard_stored(Stored stored) noexcept {
+    if constexpr (!stores_inline) {
+        ElementTraits::destroy(elementAlloc, stored);
+        ElementTraits::deallocate(elementAlloc, stored, 1);
+    }
+}
+
+// Chase–Lev operations (ordering as in Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models")
+template<typename T, typename Alloc>
+auto WorkStealingDeque<T, Alloc>::take_bottom() noexcept -> std::optional<Stored> {
+    const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    ring* a = array.load(std::memory_order_relaxed);
+    bottom.store(b, std::memory_order_relaxed);
+    // Publishing the smaller bottom must be ordered before reading top, or a thief and
+    // the owner could both take the last element
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+    Stored stored = a->at(b).load(std::memory_order_relaxed);
+    if (t == b) {
+        // Last element: race the thieves for it through top
+        const bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        if (!won) return std::nullopt;
+    }
+    return stored;
+}
+
+template<typename T, typename Alloc>
+auto WorkStealingDeque<T, Alloc>::steal_top() noexcept -> std::optional<Stored> {
+    int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t b = bottom.load(std::memory_order_acquire);
+    if (t >= b) return std::nullopt;
+
+    // The slot is read before claiming it; if the claim fails the value is simply dropped
+    ring* a = array.load(std::memory_order_acquire);
+    Stored stored = a->at(t).load(std::memory_order_relaxed);
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return std::nullopt;
+    }
+    return stored;
+}
+
+// Owner interface
+template<typename T, typename Alloc>
+void WorkStealingDeque<T, Alloc>::push(const T& value) {
+    emplace(value);
+}
+
+template<typename T, typename Alloc>
+void WorkStealingDeque<T, Alloc>::push(T&& value) {
+    emplace(std::move(value));
+}
+
+template<typename T, typename Alloc>
+template<typename... Args>
+void WorkStealingDeque<T, Alloc>::emplace(Args&&... args) {
+    Stored stored;
+    try {
+        stored = make_stored(std::forward<Args>(args)...);
+    }
+    catch (std::bad_alloc& e) {
+        throw std::runtime_error("Failed to allocate memory for new deque element: " + std::string(e.what()));
+    }
+
+    const int64_t b = bottom.load(std::memory_order_relaxed);
+    const int64_t t = top.load(std::memory_order_acquire);
+    ring* a = array.load(std::memory_order_relaxed);
+    if (static_cast<size_t>(b - t) > a->mask) {
+        try {
+            a = grow(a, t, b);
+        }
+        catch (std::bad_alloc& e) {
+            discard_stored(stored);
+            throw std::runtime_error("Failed to allocate memory for deque ring: " + std::string(e.what()));
+        }
+    }
+
+    a->at(b).store(stored, std::memory_order_relaxed);
+    // Release so a thief that sees the new bottom also sees the slot and the element behind it
+    bottom.store(b + 1, std::memory_order_release);
+}
+
+template<typename T, typename Alloc>
+T WorkStealingDeque<T, Alloc>::pop() {
+    std::optional<Stored> stored = take_bottom();
+    if (!stored) throw std::runtime_error("Cannot pop: WorkStealingDeque is empty");
+    return take_stored(*stored);
+}
+
+template<typename T, typename Alloc>
+bool WorkStealingDeque<T, Alloc>::try_pop(T& out) {
+    std::optional<Stored> stored = take_bottom();
+    if (!stored) return false;
+    out = take_stored(*stored);
+    return true;
+}
+
+template<typename T, typename Alloc>
+std::optional<T> WorkStealingDeque<T, Alloc>::try_pop() {
+    std::optional<Stored> stored = take_bottom();
+    if (!stored) return std::nullopt;
+    return take_stored(*stored);
+}
+
+// Thief interface
+template<typename T, typename Alloc>
+std::optional<T> WorkStealingDeque<T, Alloc>::steal() {
+    std::optional<Stored> stored = steal_top();
+    if (!stored) return std::nullopt;
+    return take_stored(*stored);
+}
+
+template<typename T, typename Alloc>
+bool WorkStealingDeque<T, Alloc>::try_steal(T& out) {
+    std::optional<Stored> stored = steal_top();
+    if (!stored) return false;
+    out = take_stored(*stored);
+    return true;
+}
+
+// Observers
+template<typename T, typename Alloc>
+bool WorkStealingDeque<T, Alloc>::is_empty() const {
+    return size() == 0;
+}
+
+template<typename T, typename Alloc>
+bool WorkStealingDeque<T, Alloc>::empty() const {
+    return is_empty();
+}
+
+template<typename T, typename Alloc>
+size_t WorkStealingDeque<T, Alloc>::size() const {
+    const int64_t b = bottom.load(std::memory_order_acquire);
+    const int64_t t = top.load(std::memory_order_acquire);
+    return b > t ? static_cast<size_t>(b - t) : 0;
+}
+
+template<typename T, typename Alloc>
+size_t WorkStealingDeque<T, Alloc>::capacity() const {
+    return array.load(std::memory_order_relaxed)->mask + 1;
+}
+
+template<typename T, typename Alloc>
+Alloc WorkStealingDeque<T, Alloc>::get_allocator() const {
+    return Alloc(elementAlloc);
+}
@@ -1,7 +1,38 @@
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+#include <array>
+#include <iterator>
+#include <thread>
+#include <atomic>
+#include <cstdio>
+#include <set>
+#include <sstream>
 #include "stack.h"
 #include "queue.h"
+#include "node_pool.h"
+#include "chunked_stack.h"
+#include "chunked_queue.h"
+#include "contiguous_stack.h"
+#include "intrusive_stack.h"
+#include "intrusive_queue.h"
+#include "forward_container.h"
+#include "priority_queue.h"
+#include "deque.h"
+#include "cache_aligned_allocator.h"
+#include "concurrent_queue.h"
+#include "concurrent_stack.h"
+#include "spsc_queue.h"
+#include "work_stealing_deque.h"
+#include "thread_pool.h"
+#include "fwd_parallel.h"
+#include "fwd_simd.h"
+#include "mapped_queue.h"
+#include "static_stack.h"
+#include "static_queue.h"
+#include "async_queue.h"
 
 TEST(StackTest, Stack_Iterator)
 {
@@ -264,6 +295,82 @@ TEST(ContainerTest, BaseContainer)
 
 }
 
+TEST(ContainerTest, Concrete_Iterators)
+{
+    static_assert(sizeof(Stack<int>::iterator) == sizeof(void*), "Stack iterator must be pointer-sized");
+    static_assert(sizeof(Queue<int>::const_iterator) == sizeof(void*), "Queue iterator must be pointer-sized");
+    static_assert(std::is_same<decltype(std::declval<Queue<int>&>().begin()), Queue<int>::iterator>::value,
+                  "Queue::begin() must return the concrete iterator");
+    static_assert(std::is_same<decltype(std::declval<fwd_container<int>&>().begin()), fwd_container<int>::iterator>::value,
+                  "fwd_container::begin() must return the polymorphic iterator");
+
+    Queue<int> q;
+    for (int i = 1; i <= 6; ++i) q.push(i);
+
+    Queue<int>::iterator it = q.begin();
+    Queue<int>::const_iterator cit = it;
+    EXPECT_EQ(cit, q.cbegin());
+    EXPECT_EQ(*it++, 1);
+    EXPECT_EQ(*it, 2);
+    EXPECT_NE(cit, it);
+
+    EXPECT_EQ(std::count_if(q.begin(), q.end(), [](int v){ return v % 2 == 0; }), 3);
+
+    fwd_container<int>& bq = q;
+    fwd_container<int>::iterator bit = std::find_if(bq.begin(), bq.end(), [](int v){ return v > 4; });
+    EXPECT_EQ(*bit, 5);
+    fwd_container<int>::const_iterator bcit = bit;
+    EXPECT_EQ(bcit, bit);
+    ++bcit;
+    EXPECT_EQ(*bcit, 6);
+    ++bcit;
+    EXPECT_EQ(bcit, bq.cend());
+
+    Stack<int, Chunked<2>> s;
+    for (int i = 1; i <= 5; ++i) s.push(i);
+    const fwd_container<int>& cs = s;
+    int expected[] = {5, 4, 3, 2, 1};
+    int idx = 0;
+    for (auto v : cs) EXPECT_EQ(v, expected[idx++]);
+    EXPECT_EQ(idx, 5);
+}
+
+TEST(ContainerTest, Inline_Polymorphic_Iterators)
+{
+    using Base = fwd_container<int>;
+    static_assert(sizeof(Base::iterator_adapter<Queue<int>::iterator, Queue<int>::const_iterator>) <= Base::inline_iterator_size,
+                  "Queue adapter must fit the inline buffer");
+    static_assert(sizeof(Base::iterator_adapter<Stack<int, Chunked<4>>::iterator, Stack<int, Chunked<4>>::const_iterator>)
+                      <= Base::inline_iterator_size,
+                  "Chunked stack adapter must fit the inline buffer");
+
+    Queue<int> q;
+    for (int i = 1; i <= 4; ++i) q.push(i);
+    Base& bq = q;
+
+    Base::iterator a = bq.begin();
+    Base::iterator b = a;
+    Base::iterator c = std::move(b);
+    EXPECT_EQ(*c, 1);
+    Base::iterator d;
+    d = c++;
+    EXPECT_EQ(*d, 1);
+    EXPECT_EQ(*c, 2);
+    d = d;
+    EXPECT_EQ(*d, 1);
+    d = std::move(c);
+    EXPECT_EQ(*d, 2);
+
+    Base::const_iterator ci = d;
+    Base::const_iterator cj = std::move(ci);
+    cj = cj;
+    EXPECT_EQ(*cj++, 2);
+    EXPECT_EQ(*cj, 3);
+    ci = bq.end();
+    EXPECT_EQ(ci, bq.cend());
+    EXPECT_EQ(std::distance(bq.cbegin(), bq.cend()), 4);
+}
+
 TEST(QueueTest, Queue_Iterator)
 {
     Queue<int> q;
@@ -475,6 +582,2379 @@ TEST(QueueTest, Queue_Algs)
 }
 
 
+TEST(PoolTest, Pooled_Stack)
+{
+    Stack<int, PoolAllocator<int>> s;
+    for (int i = 1; i <= 5; ++i) s.push(i);
+
+    int expected[] = {5, 4, 3, 2, 1};
+    int idx = 0;
+    for (auto v : s) EXPECT_EQ(v, expected[idx++]);
+
+    Stack<int, PoolAllocator<int>> copy_s(s);
+    EXPECT_NE(copy_s.get_allocator(), s.get_allocator());
+    idx = 0;
+    for (auto v : copy_s) EXPECT_EQ(v, expected[idx++]);
+
+    Stack<int, PoolAllocator<int>> moved_s(std::move(copy_s));
+    EXPECT_TRUE(copy_s.empty());
+    EXPECT_EQ(moved_s.pop(), 5);
+    EXPECT_EQ(moved_s.size(), 4u);
+
+    copy_s.push(7);
+    EXPECT_EQ(copy_s.top(), 7);
+}
+
+TEST(PoolTest, Pooled_Queue_SteadyState)
+{
+    Queue<std::string, PoolAllocator<std::string>> q;
+    for (int i = 0; i < 100; ++i) q.push(std::to_string(i));
+
+    const NodePool& pool = q.get_allocator().pool();
+    size_t slabs = pool.slab_count();
+    EXPECT_GT(slabs, 0u);
+
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 100; ++i) EXPECT_EQ(q.pop(), std::to_string(i));
+        for (int i = 0; i < 100; ++i) q.push(std::to_string(i));
+    }
+    EXPECT_EQ(pool.slab_count(), slabs);
+    EXPECT_EQ(q.size(), 100u);
+
+    Queue<std::string, PoolAllocator<std::string>> q2;
+    q2 = q;
+    EXPECT_EQ(q2.size(), 100u);
+    EXPECT_EQ(q2.front(), "0");
+}
+
+TEST(PoolTest, Shared_Pool)
+{
+    PoolAllocator<int> alloc;
+    Queue<int, PoolAllocator<int>> q1(alloc);
+    Queue<int, PoolAllocator<int>> q2(alloc);
+    EXPECT_EQ(q1.get_allocator(), q2.get_allocator());
+
+    q1.push(1);
+    q1.push(2);
+    q2 = std::move(q1);
+    EXPECT_EQ(q2.pop(), 1);
+    EXPECT_EQ(q2.pop(), 2);
+    EXPECT_TRUE(q2.empty());
+}
+
+
+TEST(ChunkedTest, Chunked_Queue)
+{
+    Queue<int, Chunked<4>> q;
+    for (int i = 1; i <= 10; ++i) q.push(i);
+
+    EXPECT_EQ(q.size(), 10u);
+    EXPECT_EQ(q.chunk_count(), 3u);
+
+    int idx = 1;
+    for (auto v : q) EXPECT_EQ(v, idx++);
+    EXPECT_EQ(idx, 11);
+
+    for (int i = 1; i <= 5; ++i) EXPECT_EQ(q.pop(), i);
+    EXPECT_EQ(q.front(), 6);
+    EXPECT_EQ(q.chunk_count(), 2u);
+
+    Queue<int, Chunked<4>> copy_q(q);
+    copy_q.push(11);
+    std::stringstream sout;
+    sout << copy_q;
+    EXPECT_EQ(sout.str(), "6 7 8 9 10 11");
+
+    auto it = std::find_if(copy_q.begin(), copy_q.end(), [](int v){ return v % 4 == 0; });
+    EXPECT_EQ(*it, 8);
+    EXPECT_EQ(std::count_if(copy_q.begin(), copy_q.end(), [](int v){ return v % 2 == 0; }), 3);
+
+    while (!q.empty()) q.pop();
+    EXPECT_EQ(q.chunk_count(), 1u);
+    EXPECT_EQ(q.begin(), q.end());
+
+    std::stringstream sin("1 2 3");
+    sin >> q;
+    EXPECT_EQ(q.size(), 3u);
+    EXPECT_EQ(q.front(), 1);
+}
+
+TEST(ChunkedTest, Chunked_Stack)
+{
+    Stack<std::string, Chunked<3>> s;
+    for (int i = 1; i <= 7; ++i) s.push(std::to_string(i));
+
+    const char* expected[] = {"7", "6", "5", "4", "3", "2", "1"};
+    int idx = 0;
+    for (const auto& v : s) EXPECT_EQ(v, expected[idx++]);
+    EXPECT_EQ(idx, 7);
+
+    Stack<std::string, Chunked<3>> copy_s;
+    copy_s = s;
+    EXPECT_EQ(copy_s.pop(), "7");
+    EXPECT_EQ(copy_s.pop(), "6");
+    copy_s.push("x");
+    EXPECT_EQ(copy_s.top(), "x");
+    EXPECT_EQ(s.top(), "7");
+
+    fwd_container<std::string>& bs = s;
+    idx = 0;
+    for (auto& v : bs) EXPECT_EQ(v, expected[idx++]);
+
+    // Crossing a chunk boundary back and forth reuses the spare chunk
+    s.pop();
+    size_t chunks = s.chunk_count();
+    for (int i = 0; i < 10; ++i) {
+        s.push("y");
+        s.pop();
+    }
+    EXPECT_EQ(s.chunk_count(), chunks);
+
+    std::stringstream sout;
+    sout << s;
+    EXPECT_EQ(sout.str(), "6 5 4 3 2 1");
+
+    Stack<std::string, Chunked<3>> moved_s(std::move(s));
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(moved_s.size(), 6u);
+}
+
+namespace {
+// Copying throws once the global budget runs out; used to check the strong guarantee
+struct Fragile {
+    static int copiesLeft;
+    int value;
+    Fragile(int v = 0) : value(v) {}
+    Fragile(const Fragile& other) : value(other.value) {
+        if (copiesLeft-- <= 0) throw std::logic_error("copy budget exhausted");
+    }
+    Fragile& operator=(const Fragile& other) {
+        if (copiesLeft-- <= 0) throw std::logic_error("copy budget exhausted");
+        value = other.value;
+        return *this;
+    }
+};
+int Fragile::copiesLeft = 0;
+
+std::ostream& operator<<(std::ostream& os, const Fragile& f) { return os << f.value; }
+std::istream& operator>>(std::istream& is, Fragile& f) { return is >> f.value; }
+}
+
+TEST(BulkTest, Queue_Bulk)
+{
+    std::vector<int> src(1000);
+    for (int i = 0; i < 1000; ++i) src[i] = i;
+
+    Queue<int> q;
+    q.push(-1);
+    q.push_range(src.begin(), src.end());
+    EXPECT_EQ(q.size(), 1001u);
+    EXPECT_EQ(q.pop(), -1);
+
+    std::vector<int> out;
+    q.pop_n(3, std::back_inserter(out));
+    EXPECT_EQ(out, (std::vector<int>{0, 1, 2}));
+    EXPECT_EQ(q.front(), 3);
+    EXPECT_THROW(q.pop_n(998, out.begin()), std::runtime_error);
+    EXPECT_EQ(q.size(), 997u);
+
+    fwd_container<int>& bq = q;
+    int buffer[997];
+    EXPECT_EQ(bq.drain_into(buffer), buffer + 997);
+    EXPECT_EQ(buffer[0], 3);
+    EXPECT_EQ(buffer[996], 999);
+    EXPECT_TRUE(q.empty());
+
+    bq.push_range(src.data(), src.data() + 2);
+    q.push(7);
+    EXPECT_EQ(q.size(), 3u);
+    EXPECT_EQ(q.getRearNode()->data, 7);
+
+    // A throwing element copy leaves the queue as it was
+    Fragile::copiesLeft = 100;
+    Queue<Fragile> fq;
+    fq.push(Fragile(1));
+    std::vector<Fragile> fs = {Fragile(2), Fragile(3), Fragile(4)};
+    Fragile::copiesLeft = 2;
+    EXPECT_THROW(fq.push_range(fs.begin(), fs.end()), std::logic_error);
+    Fragile::copiesLeft = 100;
+    EXPECT_EQ(fq.size(), 1u);
+    EXPECT_EQ(fq.getRearNode()->next, nullptr);
+    EXPECT_EQ(fq.front().value, 1);
+}
+
+TEST(BulkTest, Stack_Bulk)
+{
+    std::vector<std::string> src = {"a", "b", "c", "d"};
+
+    Stack<std::string> s;
+    s.push("z");
+    s.push_range(src.begin(), src.end());
+    EXPECT_EQ(s.size(), 5u);
+    EXPECT_EQ(s.top(), "d");
+
+    std::vector<std::string> out;
+    s.pop_n(2, std::back_inserter(out));
+    EXPECT_EQ(out, (std::vector<std::string>{"d", "c"}));
+    s.drain_into(std::back_inserter(out));
+    EXPECT_EQ(out, (std::vector<std::string>{"d", "c", "b", "a", "z"}));
+    EXPECT_TRUE(s.empty());
+
+    Fragile::copiesLeft = 100;
+    Stack<Fragile> fs;
+    fs.push(Fragile(1));
+    std::vector<Fragile> items = {Fragile(2), Fragile(3), Fragile(4)};
+    Fragile::copiesLeft = 1;
+    EXPECT_THROW(fs.push_range(items.begin(), items.end()), std::logic_error);
+    Fragile::copiesLeft = 100;
+    EXPECT_EQ(fs.size(), 1u);
+    EXPECT_EQ(fs.top().value, 1);
+
+    // pop_n writes everything before touching the stack
+    fs.push_range(items.begin(), items.end());
+    std::vector<Fragile> dest(4, Fragile(0));
+    Fragile::copiesLeft = 2;
+    EXPECT_THROW(fs.pop_n(4, dest.begin()), std::logic_error);
+    Fragile::copiesLeft = 100;
+    EXPECT_EQ(fs.size(), 4u);
+    EXPECT_EQ(fs.top().value, 4);
+
+    // Chunked storage falls back to the element-wise defaults
+    Stack<int, Chunked<4>> cs;
+    fwd_container<int>& bcs = cs;
+    int values[] = {1, 2, 3, 4, 5, 6};
+    bcs.push_range(values, values + 6);
+    int drained[6];
+    bcs.drain_into(drained);
+    EXPECT_EQ(drained[0], 6);
+    EXPECT_EQ(drained[5], 1);
+}
+
+// Output iterator whose assignment throws once `left` writes have succeeded
+struct FailingWriter {
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    std::vector<std::string>* sink;
+    int left;
+
+    FailingWriter& operator*() { return *this; }
+    FailingWriter& operator++() { return *this; }
+    FailingWriter& operator=(const std::string& value) {
+        if (left-- == 0) throw std::runtime_error("write failed");
+        sink->push_back(value);
+        return *this;
+    }
+};
+
+TEST(BulkTest, Pop_N_Throwing_Output)
+{
+    std::vector<std::string> sink;
+    Queue<std::string> q;
+    for (const char* word : {"alpha", "beta", "gamma", "delta"}) q.push(word);
+    EXPECT_THROW(q.pop_n(3, FailingWriter{&sink, 2}), std::runtime_error);
+    EXPECT_EQ(std::vector<std::string>(q.begin(), q.end()), (std::vector<std::string>{"alpha", "beta", "gamma", "delta"}));
+
+    Stack<std::string> s;
+    for (const char* word : {"alpha", "beta", "gamma", "delta"}) s.push(word);
+    EXPECT_THROW(s.pop_n(3, FailingWriter{&sink, 2}), std::runtime_error);
+    EXPECT_EQ(std::vector<std::string>(s.begin(), s.end()), (std::vector<std::string>{"delta", "gamma", "beta", "alpha"}));
+
+    // A write that cannot throw still moves the elements out
+    std::vector<std::string> out(2);
+    q.pop_n(2, out.begin());
+    EXPECT_EQ(out, (std::vector<std::string>{"alpha", "beta"}));
+    EXPECT_EQ(q.size(), 2u);
+}
+
+TEST(SpliceTest, Queue_Splice)
+{
+    Queue<int> global;
+    Queue<int> worker;
+    for (int i = 0; i < 3; ++i) global.push(i);
+    for (int i = 3; i < 6; ++i) worker.push(i);
+
+    Node<int>* workerFront = worker.getFrontNode();
+    global.splice_back(std::move(worker));
+    EXPECT_TRUE(worker.empty());
+    EXPECT_EQ(global.size(), 6u);
+    EXPECT_EQ(global.getRearNode()->data, 5);
+    EXPECT_EQ(global.getFrontNode()->next->next->next, workerFront);
+
+    worker.push(42);
+    Queue<int> empty;
+    empty.splice_back(std::move(worker));
+    EXPECT_EQ(empty.front(), 42);
+    EXPECT_EQ(empty.getRearNode(), empty.getFrontNode());
+
+    auto pos = std::find(global.begin(), global.end(), 3);
+    Queue<int> tail = global.split_after(pos);
+    EXPECT_EQ(global.size(), 4u);
+    EXPECT_EQ(global.getRearNode()->data, 3);
+    EXPECT_EQ(tail.size(), 2u);
+    EXPECT_EQ(tail.pop(), 4);
+    EXPECT_EQ(tail.pop(), 5);
+    global.push(9);
+    EXPECT_EQ(global.getRearNode()->data, 9);
+    EXPECT_TRUE(global.split_after(std::find(global.begin(), global.end(), 9)).empty());
+    EXPECT_THROW(global.split_after(global.end()), std::runtime_error);
+
+    // Nodes from a different pool are moved element by element
+    Queue<int, PoolAllocator<int>> pa{PoolAllocator<int>()};
+    Queue<int, PoolAllocator<int>> pb{PoolAllocator<int>()};
+    pa.push(1);
+    pb.push(2);
+    pb.push(3);
+    pa.splice_back(std::move(pb));
+    EXPECT_TRUE(pb.empty());
+    EXPECT_EQ(pa.size(), 3u);
+    EXPECT_EQ(pa.getRearNode()->data, 3);
+}
+
+TEST(SpliceTest, Stack_Splice)
+{
+    Stack<int> base;
+    Stack<int> other;
+    base.push(1);
+    base.push(2);
+    other.push(3);
+    other.push(4);
+
+    base.splice_top(std::move(other));
+    EXPECT_TRUE(other.empty());
+    std::stringstream sout;
+    sout << base;
+    EXPECT_EQ(sout.str(), "4 3 2 1");
+
+    Stack<int> rest = base.split_after(std::find(base.begin(), base.end(), 3));
+    EXPECT_EQ(base.size(), 2u);
+    EXPECT_EQ(rest.size(), 2u);
+    EXPECT_EQ(base.pop(), 4);
+    EXPECT_EQ(base.pop(), 3);
+    EXPECT_TRUE(base.empty());
+    EXPECT_EQ(rest.pop(), 2);
+    EXPECT_EQ(rest.pop(), 1);
+
+    Stack<int, PoolAllocator<int>> pa{PoolAllocator<int>()};
+    Stack<int, PoolAllocator<int>> pb{PoolAllocator<int>()};
+    pa.push(1);
+    pb.push(2);
+    pb.push(3);
+    pa.splice_top(std::move(pb));
+    EXPECT_TRUE(pb.empty());
+    EXPECT_EQ(pa.pop(), 3);
+    EXPECT_EQ(pa.pop(), 2);
+    EXPECT_EQ(pa.pop(), 1);
+}
+
+namespace {
+// Counts copies and moves so in-place construction can be checked
+struct Tracked {
+    static int copies;
+    static int moves;
+    std::string name;
+    std::vector<int> values;
+    Tracked() = default;
+    Tracked(std::string n, size_t count) : name(std::move(n)), values(count, 1) {}
+    Tracked(const Tracked& other) : name(other.name), values(other.values) { ++copies; }
+    Tracked(Tracked&& other) noexcept : name(std::move(other.name)), values(std::move(other.values)) { ++moves; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+};
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+
+std::ostream& operator<<(std::ostream& os, const Tracked& t) { return os << t.name; }
+std::istream& operator>>(std::istream& is, Tracked& t) { return is >> t.name; }
+}
+
+TEST(EmplaceTest, Emplace_In_Place)
+{
+    Tracked::copies = Tracked::moves = 0;
+
+    Queue<Tracked> q;
+    Tracked& back = q.emplace("first", 3);
+    EXPECT_EQ(&back, &q.getRearNode()->data);
+    q.emplace("second", 2);
+    Tracked& head = q.emplace_front("urgent", 1);
+    EXPECT_EQ(&head, &q.front());
+    EXPECT_EQ(q.size(), 3u);
+    EXPECT_EQ(q.front().name, "urgent");
+    EXPECT_EQ(q.getRearNode()->data.name, "second");
+
+    Stack<Tracked> s;
+    s.emplace("bottom", 4);
+    Tracked& top = s.emplace("top", 5);
+    EXPECT_EQ(&top, &s.top());
+    EXPECT_EQ(s.top().values.size(), 5u);
+
+    Stack<Tracked, Chunked<2>> cs;
+    for (int i = 0; i < 5; ++i) cs.emplace(std::to_string(i), i);
+    EXPECT_EQ(cs.top().name, "4");
+    Queue<Tracked, Chunked<2>> cq;
+    for (int i = 0; i < 5; ++i) cq.emplace(std::to_string(i), i);
+    EXPECT_EQ(cq.front().name, "0");
+
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 0);
+
+    Queue<Tracked> fresh;
+    fresh.emplace_front("only", 1);
+    EXPECT_EQ(fresh.getFrontNode(), fresh.getRearNode());
+    fresh.push(Tracked("pushed", 1));
+    EXPECT_EQ(Tracked::moves, 1);
+    EXPECT_EQ(fresh.getRearNode()->data.name, "pushed");
+}
+
+TEST(ConcurrentTest, Concurrent_Queue_Basic)
+{
+    ConcurrentQueue<std::string> q;
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.try_pop().has_value());
+    EXPECT_THROW(q.pop(), std::runtime_error);
+
+    q.push("a");
+    std::string b = "b";
+    q.push(b);
+    q.emplace(3, 'c');
+    EXPECT_EQ(q.size(), 3u);
+    EXPECT_FALSE(q.is_empty());
+
+    std::string out;
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, "a");
+    EXPECT_EQ(q.pop(), "b");
+    EXPECT_EQ(*q.try_pop(), "ccc");
+    EXPECT_TRUE(q.empty());
+
+    // Remaining elements are destroyed with the queue
+    ConcurrentQueue<std::string> leftover;
+    for (int i = 0; i < 200; ++i) leftover.push(std::string(32, 'x'));
+    for (int i = 0; i < 150; ++i) leftover.pop();
+}
+
+TEST(ConcurrentTest, Concurrent_Queue_MPMC)
+{
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int per_producer = 20000;
+
+    ConcurrentQueue<int> q;
+    std::atomic<int> consumed{0};
+    std::vector<std::vector<int>> seen(consumers);
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&q, p] {
+            for (int i = 0; i < per_producer; ++i) q.push(p * per_producer + i);
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c] {
+            int last[producers];
+            std::fill(last, last + producers, -1);
+            int value;
+            while (consumed.load() < producers * per_producer) {
+                if (q.try_pop(value)) {
+                    // Elements of one producer come out in the order they went in
+                    int producer = value / per_producer;
+                    EXPECT_GT(value, last[producer]);
+                    last[producer] = value;
+                    seen[c].push_back(value);
+                    consumed.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    std::vector<int> all;
+    for (auto& v : seen) all.insert(all.end(), v.begin(), v.end());
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), static_cast<size_t>(producers * per_producer));
+    for (int i = 0; i < producers * per_producer; ++i) ASSERT_EQ(all[i], i);
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(q.size(), 0u);
+}
+
+TEST(ConcurrentTest, Concurrent_Stack_Basic)
+{
+    ConcurrentStack<std::string> s;
+    EXPECT_TRUE(s.empty());
+    EXPECT_FALSE(s.try_pop().has_value());
+    EXPECT_THROW(s.pop(), std::runtime_error);
+
+    s.push("a");
+    s.emplace(2, 'b');
+    s.push("c");
+    EXPECT_EQ(s.size(), 3u);
+
+    std::string out;
+    EXPECT_TRUE(s.try_pop(out));
+    EXPECT_EQ(out, "c");
+
+    s.push("d");
+    Stack<std::string> batch = s.pop_all();
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(s.size(), 0u);
+    EXPECT_EQ(batch.size(), 3u);
+    EXPECT_EQ(batch.pop(), "d");
+    EXPECT_EQ(batch.pop(), "bb");
+    batch.push("e");
+    EXPECT_EQ(batch.pop(), "e");
+    EXPECT_EQ(batch.pop(), "a");
+    EXPECT_TRUE(batch.empty());
+
+    EXPECT_TRUE(s.pop_all().empty());
+    for (int i = 0; i < 100; ++i) s.push(std::string(40, 'x'));
+}
+
+TEST(ConcurrentTest, Concurrent_Stack_MPMC)
+{
+    constexpr int threads_count = 4;
+    constexpr int per_thread = 20000;
+
+    ConcurrentStack<int> s;
+    std::vector<std::vector<int>> seen(threads_count + 1);
+    std::vector<std::thread> threads;
+
+    // Every thread pushes its own range and pops about half as much meanwhile
+    for (int t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&, t] {
+            int value;
+            for (int i = 0; i < per_thread; ++i) {
+                s.push(t * per_thread + i);
+                if (i % 2 == 0 && s.try_pop(value)) seen[t].push_back(value);
+            }
+        });
+    }
+    // A batch consumer repeatedly detaches whatever is there
+    std::atomic<bool> done{false};
+    std::thread batcher([&] {
+        while (!done.load()) {
+            Stack<int> batch = s.pop_all();
+            while (!batch.empty()) seen[threads_count].push_back(batch.pop());
+        }
+    });
+    for (auto& t : threads) t.join();
+    done.store(true);
+    batcher.join();
+
+    Stack<int> rest = s.pop_all();
+    std::vector<int> all;
+    rest.drain_into(std::back_inserter(all));
+    for (auto& v : seen) all.insert(all.end(), v.begin(), v.end());
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), static_cast<size_t>(threads_count * per_thread));
+    for (int i = 0; i < threads_count * per_thread; ++i) ASSERT_EQ(all[i], i);
+    EXPECT_TRUE(s.empty());
+}
+
+TEST(ConcurrentTest, Spsc_Queue_Basic)
+{
+    SpscQueue<std::string, 3> q;
+    static_assert(SpscQueue<std::string, 3>::capacity() == 3, "capacity is the template argument");
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.try_pop().has_value());
+    EXPECT_THROW(q.get_front(), std::runtime_error);
+
+    EXPECT_TRUE(q.try_push("a"));
+    std::string b = "b";
+    EXPECT_TRUE(q.try_push(b));
+    EXPECT_TRUE(q.try_emplace(2, 'c'));
+    std::string d = "d";
+    EXPECT_FALSE(q.try_push(std::move(d)));
+    EXPECT_EQ(d, "d");
+    EXPECT_EQ(q.size(), 3u);
+
+    EXPECT_EQ(q.get_front(), "a");
+    EXPECT_EQ(q.pop(), "a");
+    q.push(std::move(d));
+    std::string out;
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, "b");
+    EXPECT_EQ(*q.try_pop(), "cc");
+    EXPECT_EQ(q.pop(), "d");
+    EXPECT_TRUE(q.is_empty());
+
+    // Wrap around several times and leave elements for the destructor
+    for (int i = 0; i < 10; ++i) {
+        q.push(std::to_string(i));
+        EXPECT_EQ(q.pop(), std::to_string(i));
+    }
+    q.push(std::string(40, 'x'));
+    q.push(std::string(40, 'y'));
+}
+
+TEST(ConcurrentTest, Spsc_Queue_Stream)
+{
+    constexpr int count = 200000;
+    SpscQueue<int, 1024> q;
+
+    std::thread producer([&q] {
+        for (int i = 0; i < count; ++i) {
+            if (i % 3 == 0) {
+                while (!q.try_push(i)) std::this_thread::yield();
+            } else {
+                q.push(i);
+            }
+        }
+    });
+
+    bool ordered = true;
+    for (int i = 0; i < count; ++i) {
+        int value;
+        if (i % 2 == 0) {
+            value = q.pop();
+        } else {
+            while (!q.try_pop(value)) std::this_thread::yield();
+        }
+        if (value != i) ordered = false;
+    }
+    producer.join();
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(ContainerTest, Try_Pop_Try_Front)
+{
+    Queue<std::string> q;
+    Stack<std::string> s;
+    Queue<std::string, Chunked<2>> cq;
+    Stack<std::string, Chunked<2>> cs;
+    fwd_container<std::string>* all[] = {&q, &s, &cq, &cs};
+
+    for (auto* c : all) {
+        std::string out = "untouched";
+        EXPECT_FALSE(c->try_pop(out));
+        EXPECT_EQ(out, "untouched");
+        EXPECT_FALSE(c->try_pop().has_value());
+        EXPECT_EQ(c->try_front(), nullptr);
+        EXPECT_EQ(static_cast<const fwd_container<std::string>*>(c)->try_front(), nullptr);
+
+        c->push("a");
+        c->push("b");
+        c->push("c");
+        ASSERT_NE(c->try_front(), nullptr);
+        EXPECT_EQ(c->try_front(), &c->get_front());
+    }
+
+    std::string out;
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, "a");
+    EXPECT_EQ(*q.try_pop(), "b");
+    EXPECT_EQ(*q.try_front(), "c");
+    EXPECT_EQ(q.size(), 1u);
+
+    EXPECT_TRUE(s.try_pop(out));
+    EXPECT_EQ(out, "c");
+    EXPECT_EQ(*s.try_pop(), "b");
+    EXPECT_EQ(*s.try_front(), "a");
+
+    EXPECT_TRUE(cq.try_pop(out));
+    EXPECT_EQ(out, "a");
+    EXPECT_EQ(*cq.try_pop(), "b");
+    EXPECT_EQ(*cq.try_pop(), "c");
+    EXPECT_FALSE(cq.try_pop().has_value());
+
+    EXPECT_EQ(*cs.try_pop(), "c");
+    EXPECT_EQ(*cs.try_pop(), "b");
+    EXPECT_TRUE(cs.try_pop(out));
+    EXPECT_EQ(out, "a");
+    EXPECT_EQ(cs.try_front(), nullptr);
+
+    // pop() hands the element out by move
+    Tracked::copies = Tracked::moves = 0;
+    Queue<Tracked> tq;
+    tq.emplace("moved", 2);
+    Tracked t = tq.pop();
+    EXPECT_EQ(t.name, "moved");
+    EXPECT_EQ(Tracked::copies, 0);
+    EXPECT_EQ(Tracked::moves, 1);
+}
+
+TEST(BoundedTest, Queue_Capacity)
+{
+    Queue<std::string> q;
+    EXPECT_EQ(q.capacity(), 0u);
+    EXPECT_FALSE(q.is_full());
+
+    q.set_capacity(3);
+    EXPECT_EQ(q.capacity(), 3u);
+    EXPECT_TRUE(q.try_push("a"));
+    EXPECT_TRUE(q.try_emplace(1, 'b'));
+    q.push("c");
+    EXPECT_TRUE(q.is_full());
+
+    std::string rejected = "d";
+    EXPECT_FALSE(q.try_push(std::move(rejected)));
+    EXPECT_EQ(rejected, "d");
+    EXPECT_THROW(q.push("d"), std::runtime_error);
+    EXPECT_THROW(q.emplace_front("d"), std::runtime_error);
+    const std::string more[] = {"x"};
+    EXPECT_THROW(q.push_range(std::begin(more), std::end(more)), std::runtime_error);
+    EXPECT_EQ(q.size(), 3u);
+    EXPECT_THROW(q.set_capacity(2), std::runtime_error);
+
+    // Popped nodes go back to the spare list and are handed out again
+    std::set<const std::string*> slots;
+    for (const std::string& value : q) slots.insert(&value);
+    q.clear();
+    EXPECT_FALSE(q.is_full());
+    q.push("e");
+    q.push("f");
+    q.push("g");
+    for (const std::string& value : q) EXPECT_TRUE(slots.count(&value));
+
+    Queue<std::string> copy(q);
+    EXPECT_EQ(copy.capacity(), 3u);
+    EXPECT_TRUE(copy.is_full());
+    Queue<std::string> moved(std::move(copy));
+    EXPECT_EQ(moved.capacity(), 3u);
+    EXPECT_EQ(moved.pop(), "e");
+
+    Queue<std::string> small;
+    small.set_capacity(1);
+    EXPECT_THROW(small = q, std::runtime_error);
+    EXPECT_TRUE(small.is_empty());
+    Queue<std::string> extra;
+    extra.push("h");
+    extra.push("i");
+    EXPECT_THROW(moved.splice_back(std::move(extra)), std::runtime_error);
+    EXPECT_EQ(extra.size(), 2u);
+
+    q.set_capacity(0);
+    q.push("h");
+    EXPECT_EQ(q.size(), 4u);
+}
+
+TEST(ConcurrentTest, Concurrent_Queue_Bounded)
+{
+    constexpr int producers = 3;
+    constexpr int per_producer = 10000;
+    constexpr size_t bound = 8;
+
+    ConcurrentQueue<int> q(bound);
+    EXPECT_EQ(q.capacity(), bound);
+    for (size_t i = 0; i < bound; ++i) EXPECT_TRUE(q.try_push(static_cast<int>(i)));
+    EXPECT_FALSE(q.try_push(-1));
+    for (size_t i = 0; i < bound; ++i) EXPECT_EQ(q.pop(), static_cast<int>(i));
+
+    std::atomic<bool> overflow{false};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&q, p] {
+            for (int i = 0; i < per_producer; ++i) q.push(p * per_producer + i);
+        });
+    }
+    long long sum = 0;
+    for (int received = 0; received < producers * per_producer;) {
+        if (q.size() > bound) overflow = true;
+        int value;
+        if (q.try_pop(value)) {
+            sum += value;
+            ++received;
+        }
+    }
+    for (auto& t : threads) t.join();
+
+    const long long n = producers * per_producer;
+    EXPECT_FALSE(overflow.load());
+    EXPECT_EQ(sum, n * (n - 1) / 2);
+    EXPECT_TRUE(q.is_empty());
+}
+
+TEST(BinaryTest, Save_Load_Round_Trip)
+{
+    Queue<int> q;
+    for (int i = 0; i < 5000; ++i) q.push(i * 3);
+    std::stringstream qs(std::ios::in | std::ios::out | std::ios::binary);
+    q.save(qs);
+
+    Queue<int> q2;
+    q2.push(-1);
+    q2.load(qs);
+    ASSERT_EQ(q2.size(), 5001u);
+    EXPECT_EQ(q2.pop(), -1);
+    for (int i = 0; i < 5000; ++i) ASSERT_EQ(q2.pop(), i * 3);
+
+    Stack<std::string> s;
+    s.push("bottom");
+    s.push("with space");
+    s.push("");
+    s.push("top");
+    std::stringstream ss(std::ios::in | std::ios::out | std::ios::binary);
+    static_cast<const fwd_container<std::string>&>(s).save(ss);
+    Stack<std::string> s2;
+    static_cast<fwd_container<std::string>&>(s2).load(ss);
+    EXPECT_TRUE(std::equal(s.begin(), s.end(), s2.begin(), s2.end()));
+
+    Stack<std::string, Chunked<2>> cs;
+    Queue<std::string, Chunked<2>> cq;
+    for (const char* word : {"a", "b c", "d", "e"}) {
+        cs.push(word);
+        cq.push(word);
+    }
+    std::stringstream cb(std::ios::in | std::ios::out | std::ios::binary);
+    cs.save(cb);
+    cq.save(cb);
+    Stack<std::string, Chunked<2>> cs2;
+    Queue<std::string, Chunked<2>> cq2;
+    cs2.load(cb);
+    cq2.load(cb);
+    EXPECT_TRUE(std::equal(cs.begin(), cs.end(), cs2.begin(), cs2.end()));
+    EXPECT_TRUE(std::equal(cq.begin(), cq.end(), cq2.begin(), cq2.end()));
+
+    // Types without a dedicated codec go through operator<< / operator>>
+    Fragile::copiesLeft = 100;
+    Queue<Fragile> fq;
+    fq.push(Fragile(7));
+    fq.push(Fragile(8));
+    std::stringstream fs(std::ios::in | std::ios::out | std::ios::binary);
+    fq.save(fs);
+    Queue<Fragile> fq2;
+    fq2.load(fs);
+    ASSERT_EQ(fq2.size(), 2u);
+    EXPECT_EQ(fq2.front().value, 7);
+}
+
+TEST(BinaryTest, Load_Failure_Keeps_Contents)
+{
+    Queue<int> source;
+    for (int i = 0; i < 100; ++i) source.push(i);
+    std::stringstream full(std::ios::in | std::ios::out | std::ios::binary);
+    source.save(full);
+    const std::string bytes = full.str();
+
+    Queue<int> q;
+    q.push(1);
+    q.push(2);
+    std::stringstream cut(bytes.substr(0, bytes.size() - 10), std::ios::in | std::ios::binary);
+    EXPECT_THROW(q.load(cut), std::runtime_error);
+    EXPECT_TRUE(cut.fail());
+    ASSERT_EQ(q.size(), 2u);
+    q.push(3);
+    EXPECT_EQ(q.getRearNode()->data, 3);
+
+    Stack<int> s;
+    s.push(9);
+    std::stringstream cut2(bytes.substr(0, bytes.size() - 10), std::ios::in | std::ios::binary);
+    EXPECT_THROW(s.load(cut2), std::runtime_error);
+    EXPECT_EQ(s.size(), 1u);
+
+    // A stream saved for another element type or format is rejected before any element is read
+    Queue<long long> wide;
+    std::stringstream typed(bytes, std::ios::in | std::ios::binary);
+    EXPECT_THROW(wide.load(typed), std::runtime_error);
+    std::string bumped = bytes;
+    bumped[4] = 9;
+    std::stringstream versioned(bumped, std::ios::in | std::ios::binary);
+    EXPECT_THROW(q.load(versioned), std::runtime_error);
+    std::stringstream text("1 2 3");
+    EXPECT_THROW(q.load(text), std::runtime_error);
+    EXPECT_EQ(q.size(), 3u);
+
+    // The text reader rolls back to the old rear as well
+    Queue<int> tq;
+    tq.push(5);
+    std::stringstream bad("6 7 x");
+    EXPECT_THROW(bad >> tq, std::runtime_error);
+    ASSERT_EQ(tq.size(), 1u);
+    tq.push(8);
+    EXPECT_EQ(tq.getRearNode()->data, 8);
+}
+
+#ifndef _WIN32
+TEST(MappedTest, Mapped_Queue_Persists)
+{
+    std::string path = ::testing::TempDir() + "fwd_mapped_queue_test.bin";
+    std::remove(path.c_str());
+
+    {
+        MappedQueue<int> q(path, 4);
+        EXPECT_TRUE(q.is_empty());
+        EXPECT_THROW(q.pop(), std::runtime_error);
+        for (int i = 0; i < 100; ++i) q.push(i);
+        EXPECT_EQ(q.pop(), 0);
+        EXPECT_EQ(q.pop(), 1);
+        EXPECT_GE(q.capacity(), 100u);
+        q.sync();
+    }
+
+    MappedQueue<int> q(path);
+    ASSERT_EQ(q.size(), 98u);
+    EXPECT_EQ(q.get_front(), 2);
+
+    // Iteration reads straight out of the mapping
+    fwd_container<int>& c = q;
+    EXPECT_EQ(std::count_if(c.begin(), c.end(), [](int v) { return v % 2 == 0; }), 49);
+    auto it = std::find_if(q.begin(), q.end(), [](int v) { return v == 50; });
+    ASSERT_NE(it, q.end());
+    EXPECT_EQ(&*it, &q.get_front() + 48);
+
+    // Draining and refilling compacts instead of growing
+    size_t cap = q.capacity();
+    while (q.size() > 1) q.pop();
+    for (int round = 0; round < 10; ++round) {
+        for (size_t i = 0; i < cap / 2; ++i) q.push(static_cast<int>(i));
+        for (size_t i = 0; i < cap / 2; ++i) q.pop();
+    }
+    EXPECT_EQ(q.capacity(), cap);
+    EXPECT_EQ(q.size(), 1u);
+    q.pop();
+
+    std::stringstream text("7 8 9");
+    text >> q;
+    std::stringstream out;
+    out << q;
+    EXPECT_EQ(out.str(), "7 8 9");
+
+    std::stringstream bin(std::ios::in | std::ios::out | std::ios::binary);
+    q.save(bin);
+    Queue<int> copy;
+    copy.load(bin);
+    EXPECT_EQ(copy.size(), 3u);
+    EXPECT_EQ(copy.front(), 7);
+
+    EXPECT_THROW(MappedQueue<double> wrong(path), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(MappedTest, Mapped_Queue_Self_Push_And_Assign)
+{
+    std::string path = ::testing::TempDir() + "fwd_mapped_queue_self.bin";
+    std::string other_path = ::testing::TempDir() + "fwd_mapped_queue_other.bin";
+    std::remove(path.c_str());
+    std::remove(other_path.c_str());
+
+    {
+        // Pushing an element of the queue itself while the push grows or compacts the file
+        MappedQueue<long> m(path, 1);
+        m.push(7);
+        for (int i = 0; i < 20; ++i) m.push(m.get_front());
+        EXPECT_EQ(m.size(), 21u);
+        EXPECT_TRUE(std::all_of(m.begin(), m.end(), [](long v) { return v == 7; }));
+        size_t cap = m.capacity();
+        while (m.size() > 1) m.pop();
+        m.get_front() = 9;
+        for (size_t i = 1; i < cap; ++i) m.push(m.get_front());
+        for (size_t i = 0; i < cap / 2; ++i) m.pop();
+        m.push(m.get_front());
+        EXPECT_EQ(m.capacity(), cap);
+        EXPECT_TRUE(std::all_of(m.begin(), m.end(), [](long v) { return v == 9; }));
+
+        MappedQueue<long> other(other_path, 4);
+        fwd_container<long>& erased = other;
+        erased = static_cast<const fwd_container<long>&>(m);
+        EXPECT_EQ(other.size(), m.size());
+        EXPECT_EQ(other.get_front(), 9);
+
+        Queue<long> q;
+        q.push(1);
+        EXPECT_THROW(erased = q, std::bad_cast);
+        EXPECT_EQ(other.size(), m.size());
+    }
+
+    std::remove(path.c_str());
+    std::remove(other_path.c_str());
+}
+#endif
+
+TEST(StreamParseTest, Fast_Numeric_Read)
+{
+    // Large enough to cut tokens at block boundaries
+    std::string text;
+    for (int i = 0; i < 40000; ++i) text += std::to_string(i * 7) + (i % 10 == 9 ? "\n" : "  ");
+    std::stringstream in(text);
+
+    Queue<int> q;
+    q.push(-1);
+    in >> q;
+    ASSERT_EQ(q.size(), 40001u);
+    EXPECT_EQ(q.pop(), -1);
+    for (int i = 0; i < 40000; ++i) ASSERT_EQ(q.pop(), i * 7);
+
+    std::stringstream signs("+4 -2\t\r\n 0");
+    Stack<long> s;
+    signs >> s;
+    ASSERT_EQ(s.size(), 3u);
+    EXPECT_EQ(s.pop(), 0);
+    EXPECT_EQ(s.pop(), -2);
+    EXPECT_EQ(s.pop(), 4);
+
+    std::stringstream reals("1.5 -2e3 .25");
+    Queue<double, Chunked<2>> cq;
+    reals >> cq;
+    ASSERT_EQ(cq.size(), 3u);
+    EXPECT_DOUBLE_EQ(cq.pop(), 1.5);
+    EXPECT_DOUBLE_EQ(cq.pop(), -2000.0);
+    EXPECT_DOUBLE_EQ(cq.pop(), 0.25);
+}
+
+TEST(StreamParseTest, Fast_Read_Rollback)
+{
+    Queue<int> q;
+    q.push(1);
+    std::stringstream bad("2 3 4x 5");
+    EXPECT_THROW(bad >> q, std::runtime_error);
+    ASSERT_EQ(q.size(), 1u);
+    q.push(6);
+    EXPECT_EQ(q.getRearNode()->data, 6);
+
+    Stack<int> s;
+    s.push(1);
+    std::stringstream overflow("2 99999999999");
+    EXPECT_THROW(overflow >> s, std::runtime_error);
+    EXPECT_EQ(s.size(), 1u);
+    EXPECT_EQ(s.top(), 1);
+
+    Stack<int, Chunked<2>> cs;
+    cs.push(1);
+    std::stringstream tail("2 3 4 -");
+    EXPECT_THROW(tail >> cs, std::runtime_error);
+    EXPECT_EQ(cs.size(), 1u);
+
+    Queue<int> bounded;
+    bounded.set_capacity(2);
+    std::stringstream many("1 2 3");
+    EXPECT_THROW(many >> bounded, std::runtime_error);
+    EXPECT_TRUE(bounded.is_empty());
+}
+
+TEST(StreamParseTest, Fast_Read_Matches_Extraction)
+{
+    // Stream flags the fast path does not handle fall back to operator>>
+    std::stringstream hex("ff 10 -a");
+    hex >> std::hex;
+    Queue<int> hq;
+    hex >> hq;
+    ASSERT_EQ(hq.size(), 3u);
+    EXPECT_EQ(hq.pop(), 255);
+    EXPECT_EQ(hq.pop(), 16);
+    EXPECT_EQ(hq.pop(), -10);
+
+    std::stringstream hexHeap("1f 20");
+    hexHeap >> std::hex;
+    PriorityQueue<long> pq;
+    hexHeap >> pq;
+    EXPECT_EQ(pq.top(), 32);
+
+    // A minus sign before an unsigned type wraps around, as it does for operator>>
+    unsigned expected = 0;
+    unsigned short expectedShort = 0;
+    std::istringstream("-1") >> expected;
+    std::istringstream("-2") >> expectedShort;
+    std::stringstream negative("-1");
+    Queue<unsigned> uq;
+    negative >> uq;
+    ASSERT_EQ(uq.size(), 1u);
+    EXPECT_EQ(uq.pop(), expected);
+    EXPECT_EQ(expected, std::numeric_limits<unsigned>::max());
+    std::stringstream negativeShort("-2");
+    Stack<unsigned short, Chunked<4>> us;
+    negativeShort >> us;
+    EXPECT_EQ(us.pop(), expectedShort);
+    std::stringstream tooNegative("-4294967296");
+    EXPECT_THROW(tooNegative >> uq, std::runtime_error);
+
+    // operator>> reads no inf, nan or doubled sign
+    Queue<double> dq;
+    std::stringstream inf("1 inf");
+    EXPECT_THROW(inf >> dq, std::runtime_error);
+    std::stringstream nan("nan");
+    EXPECT_THROW(nan >> dq, std::runtime_error);
+    std::stringstream doubled("+-1");
+    EXPECT_THROW(doubled >> uq, std::runtime_error);
+    EXPECT_TRUE(dq.empty());
+}
+
+TEST(CopyTest, Assignment_Reuses_Nodes)
+{
+    Queue<std::string> src;
+    for (int i = 0; i < 6; ++i) src.push("s" + std::to_string(i));
+
+    Queue<std::string> dst;
+    for (int i = 0; i < 4; ++i) dst.push("d");
+    std::vector<const std::string*> before;
+    for (const std::string& value : dst) before.push_back(&value);
+
+    // Growing keeps the existing nodes in front of the new ones
+    dst = src;
+    ASSERT_EQ(dst.size(), 6u);
+    EXPECT_TRUE(std::equal(dst.begin(), dst.end(), src.begin(), src.end()));
+    auto it = dst.begin();
+    for (const std::string* slot : before) EXPECT_EQ(&*it++, slot);
+    dst.push("tail");
+    EXPECT_EQ(dst.getRearNode()->data, "tail");
+
+    // Shrinking frees only the surplus
+    Queue<std::string> small;
+    small.push("x");
+    small.push("y");
+    dst = small;
+    ASSERT_EQ(dst.size(), 2u);
+    EXPECT_EQ(&dst.front(), before[0]);
+    EXPECT_EQ(dst.getRearNode()->data, "y");
+    dst.push("z");
+    EXPECT_EQ(dst.size(), 3u);
+    dst = Queue<std::string>();
+    EXPECT_TRUE(dst.is_empty());
+    dst.push("again");
+    EXPECT_EQ(dst.front(), "again");
+
+    Stack<int> s1;
+    Stack<int> s2;
+    for (int i = 0; i < 5; ++i) s1.push(i);
+    s2.push(100);
+    s2.push(200);
+    const int* top = &s2.top();
+    s2 = s1;
+    EXPECT_EQ(&s2.top(), top);
+    EXPECT_TRUE(std::equal(s1.begin(), s1.end(), s2.begin(), s2.end()));
+    Stack<int> s3;
+    s3.push(7);
+    s2 = s3;
+    EXPECT_EQ(s2.size(), 1u);
+    EXPECT_EQ(s2.pop(), 7);
+    EXPECT_TRUE(s2.is_empty());
+}
+
+TEST(CopyTest, Copy_Construction_Batches_Pool)
+{
+    PoolAllocator<int> alloc(std::make_shared<NodePool>(8));
+    Queue<int, PoolAllocator<int>> q(alloc);
+    Stack<int, PoolAllocator<int>> s(alloc);
+    for (int i = 0; i < 500; ++i) {
+        q.push(i);
+        s.push(i);
+    }
+
+    // The copies get fresh pools; the whole chain comes from one slab
+    Queue<int, PoolAllocator<int>> qc(q);
+    Stack<int, PoolAllocator<int>> sc(s);
+    EXPECT_EQ(qc.get_allocator().pool().slab_count(), 1u);
+    EXPECT_EQ(sc.get_allocator().pool().slab_count(), 1u);
+    EXPECT_TRUE(std::equal(q.begin(), q.end(), qc.begin(), qc.end()));
+    EXPECT_TRUE(std::equal(s.begin(), s.end(), sc.begin(), sc.end()));
+
+    Queue<int> bounded;
+    bounded.set_capacity(10);
+    bounded.push(1);
+    Queue<int> bc(bounded);
+    EXPECT_EQ(bc.capacity(), 10u);
+    EXPECT_EQ(bc.front(), 1);
+}
+
+TEST(PoolTest, Clear_Releases_Exclusive_Pool)
+{
+    Queue<int, PoolAllocator<int>> q{PoolAllocator<int>()};
+    for (int i = 0; i < 1000; ++i) q.push(i);
+    EXPECT_GT(q.get_allocator().pool().slab_count(), 1u);
+    q.clear();
+    EXPECT_TRUE(q.is_empty());
+    q.push(5);
+    EXPECT_EQ(q.front(), 5);
+
+    Queue<int, PoolAllocator<int>> copy(q);
+    NodePool& pool = copy.get_allocator().pool();
+    copy.clear();
+    EXPECT_EQ(pool.slab_count(), 0u);
+
+    // A pool shared with another container is left alone
+    PoolAllocator<int> shared;
+    Stack<int, PoolAllocator<int>> s1(shared);
+    Stack<int, PoolAllocator<int>> s2(shared);
+    s1.push(1);
+    s2.push(2);
+    s1.clear();
+    EXPECT_EQ(s2.top(), 2);
+    EXPECT_EQ(shared.pool().slab_count(), 1u);
+
+    Stack<int, Chunked<4, PoolAllocator<void>>> cs;
+    Queue<int, Chunked<4, PoolAllocator<void>>> cq;
+    for (int i = 0; i < 100; ++i) {
+        cs.push(i);
+        cq.push(i);
+    }
+    cs.clear();
+    cq.clear();
+    EXPECT_TRUE(cs.is_empty());
+    EXPECT_TRUE(cq.is_empty());
+    cs.push(1);
+    cq.push(2);
+    EXPECT_EQ(cs.top(), 1);
+    EXPECT_EQ(cq.front(), 2);
+
+    // Non-trivial elements are still destroyed one by one
+    Queue<std::string, PoolAllocator<std::string>> strings{PoolAllocator<std::string>()};
+    strings.push(std::string(100, 'x'));
+    strings.clear();
+    EXPECT_TRUE(strings.is_empty());
+}
+
+TEST(ContiguousTest, Contiguous_Stack)
+{
+    Stack<int, ContiguousStorage<4>> s;
+    s.push(10);
+    s.push(20);
+    s.push(30);
+    EXPECT_TRUE(s.is_inline());
+
+    Stack<int, ContiguousStorage<4>>::const_iterator cit = s.cbegin(), ocit;
+    EXPECT_EQ(*cit, 30);
+    ocit = ++cit;
+    EXPECT_EQ(*cit, 20);
+    EXPECT_EQ(*ocit, 20);
+    ocit = cit++;
+    EXPECT_EQ(*cit, 10);
+    EXPECT_EQ(*ocit, 20);
+    ++cit;
+    EXPECT_EQ(cit, s.cend());
+
+    // Growing past the inline slots moves everything onto the heap in order
+    for (int i = 4; i <= 10; ++i) s.push(i * 10);
+    EXPECT_FALSE(s.is_inline());
+    EXPECT_GE(s.capacity(), 10u);
+    const fwd_container<int>& bs = s;
+    int expected = 100;
+    for (int v : bs) {
+        EXPECT_EQ(v, expected);
+        expected -= 10;
+    }
+    EXPECT_EQ(expected, 0);
+
+    size_t capacity = s.capacity();
+    for (int i = 0; i < 10; ++i) s.pop();
+    EXPECT_THROW(s.pop(), std::runtime_error);
+    EXPECT_THROW(s.top(), std::runtime_error);
+    EXPECT_EQ(s.capacity(), capacity);
+
+    // Pushing a reference to the top while the buffer grows
+    Stack<std::string, ContiguousStorage<2>> strs;
+    strs.push("a");
+    strs.push("b");
+    strs.push(strs.top());
+    EXPECT_EQ(strs.pop(), "b");
+    EXPECT_EQ(strs.pop(), "b");
+    EXPECT_EQ(strs.pop(), "a");
+
+    std::stringstream sin("1 2 3");
+    Stack<int, ContiguousStorage<>> zero;
+    sin >> zero;
+    std::stringstream sout;
+    sout << zero;
+    EXPECT_EQ(sout.str(), "3 2 1");
+}
+
+TEST(ContiguousTest, Contiguous_Stack_Copy_Move)
+{
+    Stack<std::string, ContiguousStorage<3>> small;
+    small.push("x");
+    small.push("y");
+
+    Stack<std::string, ContiguousStorage<3>> large;
+    for (int i = 1; i <= 7; ++i) large.push(std::to_string(i));
+
+    Stack<std::string, ContiguousStorage<3>> copy_s(large);
+    EXPECT_TRUE(std::equal(copy_s.begin(), copy_s.end(), large.begin(), large.end()));
+    copy_s = small;
+    EXPECT_EQ(copy_s.size(), 2u);
+    EXPECT_EQ(copy_s.top(), "y");
+
+    // An inline stack moves element by element, a heap one hands over its buffer
+    Stack<std::string, ContiguousStorage<3>> moved_small(std::move(small));
+    EXPECT_TRUE(small.empty());
+    EXPECT_EQ(moved_small.top(), "y");
+
+    const std::string* top = &large.top();
+    Stack<std::string, ContiguousStorage<3>> moved_large;
+    moved_large = std::move(large);
+    EXPECT_TRUE(large.empty());
+    EXPECT_EQ(&moved_large.top(), top);
+    EXPECT_EQ(moved_large.size(), 7u);
+
+    std::stringstream bin(std::ios::in | std::ios::out | std::ios::binary);
+    moved_large.save(bin);
+    Stack<std::string, ContiguousStorage<3>> loaded;
+    loaded.load(bin);
+    EXPECT_TRUE(std::equal(loaded.begin(), loaded.end(), moved_large.begin(), moved_large.end()));
+
+    fwd_container<std::string>& base = loaded;
+    base = moved_small;
+    EXPECT_EQ(loaded.size(), 2u);
+    EXPECT_THROW(base = Stack<std::string>(), std::bad_cast);
+}
+
+namespace {
+// Pool-resident object that can sit in one intrusive stack and one intrusive queue at once
+struct Job {
+    int id;
+    IntrusiveHook<Job> stackHook;
+    IntrusiveHook<Job> queueHook;
+    Job(int i = 0) : id(i) {}
+};
+
+std::ostream& operator<<(std::ostream& os, const Job& j) { return os << j.id; }
+std::istream& operator>>(std::istream& is, Job& j) { return is >> j.id; }
+
+template<typename C, typename Arg, typename = void>
+struct can_link : std::false_type {};
+
+template<typename C, typename Arg>
+struct can_link<C, Arg, std::void_t<decltype(std::declval<C&>().link(std::declval<Arg>()))>> : std::true_type {};
+
+template<typename C, typename Arg>
+inline constexpr bool can_link_v = can_link<C, Arg>::value;
+}
+
+TEST(IntrusiveTest, Intrusive_Stack_And_Queue)
+{
+    std::vector<Job> pool;
+    for (int i = 1; i <= 4; ++i) pool.emplace_back(i);
+
+    IntrusiveStack<Job, &Job::stackHook> s;
+    IntrusiveQueue<Job, &Job::queueHook> q;
+    for (Job& job : pool) {
+        s.link(job);
+        q.link(job);
+    }
+    EXPECT_EQ(&s.top(), &pool[3]);
+    EXPECT_EQ(&q.front(), &pool[0]);
+    EXPECT_EQ(&q.back(), &pool[3]);
+
+    // Both containers work through the fwd_container interface and iterators
+    const fwd_container<Job>& bs = s;
+    const fwd_container<Job>& bq = q;
+    std::stringstream sout, qout;
+    sout << bs;
+    qout << bq;
+    EXPECT_EQ(sout.str(), "4 3 2 1");
+    EXPECT_EQ(qout.str(), "1 2 3 4");
+    EXPECT_EQ(std::count_if(bq.begin(), bq.end(), [](const Job& j) { return j.id % 2 == 0; }), 2);
+
+    // Unlinking hands back the pooled object itself; pop() returns an unlinked copy
+    EXPECT_EQ(&s.unlink(), &pool[3]);
+    Job copy = q.pop();
+    EXPECT_EQ(copy.id, 1);
+    EXPECT_EQ(copy.queueHook.next, nullptr);
+    EXPECT_EQ(q.size(), 3u);
+    EXPECT_EQ(s.size(), 3u);
+    pool[1].id = 20;
+    EXPECT_EQ(q.front().id, 20);
+
+    IntrusiveQueue<Job, &Job::queueHook> other;
+    other.link(pool[0]);
+    q.splice_back(std::move(other));
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(&q.back(), &pool[0]);
+    EXPECT_EQ(q.size(), 4u);
+
+    q.clear();
+    EXPECT_EQ(q.try_unlink(), nullptr);
+    EXPECT_THROW(q.unlink(), std::runtime_error);
+    std::stringstream sin("5");
+    EXPECT_THROW(sin >> q, std::runtime_error);
+
+    IntrusiveStack<Job, &Job::stackHook> moved(std::move(s));
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(moved.size(), 3u);
+    Job out;
+    EXPECT_TRUE(moved.try_pop(out));
+    EXPECT_EQ(out.id, 3);
+
+    // Only a live lvalue can be linked; the value-taking pushes of fwd_container refuse
+    static_assert(can_link_v<IntrusiveQueue<Job, &Job::queueHook>, Job&> &&
+                  !can_link_v<IntrusiveQueue<Job, &Job::queueHook>, Job> &&
+                  !can_link_v<IntrusiveStack<Job, &Job::stackHook>, Job> &&
+                  !can_link_v<IntrusiveStack<Job, &Job::stackHook>, const Job&>,
+                  "A temporary or const object cannot be linked");
+    static_assert(!is_forward_container_v<IntrusiveQueue<Job, &Job::queueHook>> &&
+                  !is_forward_container_v<IntrusiveStack<Job, &Job::stackHook>>,
+                  "Intrusive containers are not forward containers");
+    fwd_container<Job>& base = moved;
+    EXPECT_THROW(base.push(Job(7)), std::runtime_error);
+    EXPECT_THROW(base.push(pool[0]), std::runtime_error);
+    EXPECT_THROW(moved.push(Job(7)), std::runtime_error);
+    EXPECT_EQ(moved.size(), 2u);
+}
+
+namespace {
+// Generic pipeline stage: compiled against the concrete container types
+template<typename In, typename Out>
+std::enable_if_t<is_forward_container_v<In> && is_forward_container_v<Out>> double_all(In& in, Out& out) {
+    for (auto it = in.begin(); it != in.end(); ++it) out.push(*it * 2);
+}
+}
+
+TEST(ContainerTest, Iterator_Identity)
+{
+    // Instantiations of one container template wrap different iterator types
+    Queue<int> plain;
+    Queue<int, PoolAllocator<int>> pooled;
+    fwd_container<int>& a = plain;
+    fwd_container<int>& b = pooled;
+    EXPECT_FALSE(a.end() == b.end());
+    EXPECT_TRUE(a.end() != b.end());
+    EXPECT_FALSE(static_cast<const fwd_container<int>&>(a).cend() == b.end());
+
+    PriorityQueue<int> max_first;
+    PriorityQueue<int, std::greater<int>> min_first;
+    fwd_container<int>& c = max_first;
+    fwd_container<int>& d = min_first;
+    EXPECT_FALSE(c.begin() == d.begin());
+
+    // The iterator and const iterator of one container still compare
+    plain.push(1);
+    const fwd_container<int>& ca = a;
+    EXPECT_TRUE(a.begin() == ca.begin());
+    EXPECT_TRUE(++a.begin() == ca.end());
+}
+
+TEST(ContainerTest, Static_Dispatch)
+{
+    static_assert(is_forward_container_v<Queue<int>>, "Queue is a forward container");
+    static_assert(is_forward_container_v<Stack<int, ContiguousStorage<4>>>, "Contiguous stack is a forward container");
+    static_assert(is_forward_container_v<fwd_container<int>>, "The virtual base is a forward container");
+    static_assert(!is_forward_container_v<std::vector<int>>, "vector has no pop");
+    static_assert(std::is_same_v<forward_container_value_t<Stack<std::string>>, std::string>, "Value type comes from get_front");
+    static_assert(std::is_final_v<Queue<int>> && std::is_final_v<Stack<int, Chunked<4>>>, "Containers are final");
+
+    Queue<int> q;
+    for (int i = 1; i <= 3; ++i) q.push(i);
+    Stack<int, ContiguousStorage<4>> s;
+    double_all(q, s);
+    EXPECT_EQ(s.top(), 6);
+
+    Queue<int> drained;
+    EXPECT_EQ(forward_all(s, drained), 3u);
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(drained.front(), 6);
+
+    // The virtual interface stays available through the adapter
+    fwd_container_adapter<Queue<int>> adapter(drained);
+    fwd_container<int>& erased = adapter;
+    erased.push(8);
+    EXPECT_EQ(erased.size(), 4u);
+    EXPECT_EQ(*erased.begin(), 6);
+    std::stringstream sout;
+    sout << erased;
+    EXPECT_EQ(sout.str(), "6 4 2 8");
+    std::stringstream sin("10");
+    sin >> erased;
+    EXPECT_EQ(drained.size(), 5u);
+    EXPECT_EQ(erased.pop(), 6);
+
+    Queue<int> other_q;
+    fwd_container_adapter<Queue<int>> other(other_q);
+    other = erased;
+    EXPECT_EQ(other_q.size(), 4u);
+    EXPECT_THROW(other = q, std::bad_cast);
+}
+
+TEST(PriorityTest, Priority_Queue_Order)
+{
+    std::vector<int> values;
+    for (int i = 0; i < 200; ++i) values.push_back((i * 37) % 101);
+
+    PriorityQueue<int> pq;
+    for (int v : values) pq.push(v);
+    EXPECT_EQ(pq.size(), 200u);
+    EXPECT_EQ(pq.top(), 100);
+
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+    std::vector<int> popped;
+    while (!pq.empty()) popped.push_back(pq.pop());
+    EXPECT_EQ(popped, sorted);
+    EXPECT_THROW(pq.pop(), std::runtime_error);
+    EXPECT_THROW(pq.get_front(), std::runtime_error);
+
+    // Heapify from a range, then merge a small and a large range
+    PriorityQueue<int, std::greater<int>> min_pq(values.begin(), values.end());
+    EXPECT_EQ(min_pq.top(), 0);
+    int small[] = {-5, 300};
+    min_pq.push_range(std::begin(small), std::end(small));
+    EXPECT_EQ(min_pq.top(), -5);
+    std::vector<int> large(500, 7);
+    large.push_back(-9);
+    min_pq.push_range(large.begin(), large.end());
+    EXPECT_EQ(min_pq.size(), 703u);
+    int previous = min_pq.pop();
+    EXPECT_EQ(previous, -9);
+    while (!min_pq.empty()) {
+        int next = min_pq.pop();
+        EXPECT_LE(previous, next);
+        previous = next;
+    }
+    EXPECT_EQ(previous, 300);
+}
+
+TEST(PriorityTest, Priority_Queue_Interface)
+{
+    PriorityQueue<std::string> pq;
+    fwd_container<std::string>& base = pq;
+    base.push("b");
+    base.push("d");
+    base.push("a");
+    EXPECT_EQ(base.get_front(), "d");
+    EXPECT_EQ(std::count(base.begin(), base.end(), "a"), 1);
+
+    // Any container can be assigned; its elements are heapified
+    Queue<std::string> q;
+    q.push("x");
+    q.push("z");
+    q.push("y");
+    base = q;
+    EXPECT_EQ(pq.size(), 3u);
+    EXPECT_EQ(pq.pop(), "z");
+
+    PriorityQueue<int> ints;
+    std::stringstream sin("4 9 1 7");
+    sin >> ints;
+    EXPECT_EQ(ints.top(), 9);
+    std::stringstream bad("3 x");
+    EXPECT_THROW(bad >> ints, std::runtime_error);
+    EXPECT_EQ(ints.size(), 4u);
+
+    std::stringstream bin(std::ios::in | std::ios::out | std::ios::binary);
+    ints.save(bin);
+    PriorityQueue<int> loaded;
+    loaded.push(100);
+    loaded.load(bin);
+    EXPECT_EQ(loaded.size(), 5u);
+    EXPECT_EQ(loaded.pop(), 100);
+    EXPECT_EQ(loaded.pop(), 9);
+
+    PriorityQueue<int> moved(std::move(loaded));
+    EXPECT_TRUE(loaded.empty());
+    EXPECT_EQ(moved.top(), 7);
+}
+
+namespace {
+// std::less that throws once the shared budget of comparisons is used up
+struct BudgetedLess {
+    int* budget;
+    bool operator()(const std::string& a, const std::string& b) const {
+        if ((*budget)-- == 0) throw std::logic_error("comparison budget exhausted");
+        return a < b;
+    }
+};
+}
+
+TEST(PriorityTest, Priority_Queue_Throwing_Compare)
+{
+    int budget = -1;
+    PriorityQueue<std::string, BudgetedLess> pq(BudgetedLess{&budget});
+    for (int i = 0; i < 20; ++i) pq.push(std::string(1, static_cast<char>('a' + i)));
+
+    // A sift interrupted halfway puts the lifted element back instead of leaving a hole
+    budget = 1;
+    EXPECT_THROW(pq.push("zz"), std::logic_error);
+    const std::string popped = pq.top();
+    budget = 2;
+    EXPECT_THROW(pq.pop(), std::logic_error);
+    EXPECT_EQ(pq.size(), 20u);
+
+    std::vector<std::string> held(pq.begin(), pq.end());
+    std::sort(held.begin(), held.end());
+    // Only the element pop() was removing is gone
+    std::vector<std::string> expected{"zz"};
+    for (int i = 0; i < 20; ++i) expected.push_back(std::string(1, static_cast<char>('a' + i)));
+    expected.erase(std::find(expected.begin(), expected.end(), popped));
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(held, expected);
+}
+
+TEST(DequeTest, Deque_Both_Ends)
+{
+    Deque<int> d;
+    const int count = static_cast<int>(Deque<int>::block_capacity) * 3;
+    for (int i = 0; i < count; ++i) {
+        d.push_back(i);
+        d.push_front(-i - 1);
+    }
+    EXPECT_EQ(d.size(), static_cast<size_t>(count) * 2);
+    EXPECT_EQ(d.front(), -count);
+    EXPECT_EQ(d.back(), count - 1);
+
+    // Bidirectional iteration walks across the blocks in both directions
+    int expected = -count;
+    for (int value : d) EXPECT_EQ(value, expected++);
+    Deque<int>::iterator it = d.end();
+    --it;
+    EXPECT_EQ(*it, count - 1);
+    EXPECT_EQ(std::distance(d.begin(), d.end()), count * 2);
+
+    for (int i = count - 1; i >= 0; --i) EXPECT_EQ(d.pop_back(), i);
+    for (int i = count; i > 0; --i) EXPECT_EQ(d.pop_front(), -i);
+    EXPECT_TRUE(d.empty());
+    EXPECT_THROW(d.pop_front(), std::runtime_error);
+    EXPECT_THROW(d.pop_back(), std::runtime_error);
+    EXPECT_THROW(d.back(), std::runtime_error);
+
+    // Used as a queue it drifts towards the back without growing
+    for (int i = 0; i < 10000; ++i) {
+        d.push(i);
+        if (i % 2 == 1) {
+            EXPECT_EQ(d.pop(), i / 2);
+        }
+    }
+    EXPECT_EQ(d.size(), 5000u);
+    EXPECT_EQ(d.front(), 5000);
+}
+
+TEST(DequeTest, Deque_Matches_Queue)
+{
+    Deque<std::string> d;
+    Queue<std::string> q;
+    fwd_container<std::string>& base = d;
+    for (const char* s : {"a", "b", "c"}) {
+        base.push(s);
+        q.push(s);
+    }
+    EXPECT_EQ(base.get_front(), q.get_front());
+    std::ostringstream dout, qout;
+    dout << base;
+    qout << q;
+    EXPECT_EQ(dout.str(), qout.str());
+    EXPECT_EQ(std::count(base.begin(), base.end(), "b"), 1);
+
+    // A failed item goes back to the front for a retry
+    std::string failed = base.pop();
+    d.push_front(failed);
+    EXPECT_EQ(d.pop(), "a");
+    EXPECT_EQ(base.pop(), "b");
+
+    Deque<int> ints;
+    std::stringstream sin("1 2 3");
+    sin >> ints;
+    EXPECT_EQ(ints.back(), 3);
+    std::stringstream bad("4 x");
+    EXPECT_THROW(bad >> ints, std::runtime_error);
+    EXPECT_EQ(ints.size(), 3u);
+
+    std::stringstream bin(std::ios::in | std::ios::out | std::ios::binary);
+    ints.save(bin);
+    Deque<int> loaded;
+    loaded.push(0);
+    loaded.load(bin);
+    EXPECT_EQ(loaded.size(), 4u);
+    EXPECT_EQ(loaded.back(), 3);
+
+    Deque<int> copy(loaded);
+    copy.push_front(-1);
+    EXPECT_EQ(loaded.front(), 0);
+    Deque<int> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), 5u);
+    copy = moved;
+    EXPECT_EQ(copy.back(), 3);
+    fwd_container<int>& other = ints;
+    loaded = other;
+    EXPECT_EQ(loaded.size(), 3u);
+    Queue<int> queue;
+    fwd_container<int>& foreign = queue;
+    EXPECT_THROW(loaded = foreign, std::bad_cast);
+}
+
+TEST(ConcurrentTest, Work_Stealing_Deque)
+{
+    // The owner works LIFO, thieves take the oldest element
+    WorkStealingDeque<int> ints(2);
+    EXPECT_TRUE(WorkStealingDeque<int>::stores_inline);
+    EXPECT_FALSE(ints.steal().has_value());
+    EXPECT_THROW(ints.pop(), std::runtime_error);
+    for (int i = 0; i < 100; ++i) ints.push(i);
+    EXPECT_EQ(ints.size(), 100u);
+    EXPECT_GE(ints.capacity(), 100u);
+    EXPECT_EQ(ints.pop(), 99);
+    EXPECT_EQ(*ints.steal(), 0);
+    int out = 0;
+    EXPECT_TRUE(ints.try_steal(out));
+    EXPECT_EQ(out, 1);
+    EXPECT_TRUE(ints.try_pop(out));
+    EXPECT_EQ(out, 98);
+
+    WorkStealingDeque<std::string> strings;
+    EXPECT_FALSE(WorkStealingDeque<std::string>::stores_inline);
+    strings.push("a");
+    strings.emplace(3, 'b');
+    EXPECT_EQ(*strings.steal(), "a");
+    EXPECT_EQ(*strings.try_pop(), "bbb");
+    EXPECT_TRUE(strings.empty());
+    for (int i = 0; i < 100; ++i) strings.push(std::string(32, 'x'));
+
+    // Every element is taken exactly once, by the owner or by one of the thieves
+    constexpr int thieves = 3;
+    constexpr int total = 100000;
+    WorkStealingDeque<int> shared(8);
+    std::vector<std::atomic<int>> taken(total);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thieves; ++t) {
+        threads.emplace_back([&] {
+            while (!done.load() || !shared.empty()) {
+                std::optional<int> value = shared.steal();
+                if (value) taken[*value].fetch_add(1);
+            }
+        });
+    }
+    for (int i = 0; i < total; ++i) {
+        shared.push(i);
+        if (i % 3 == 0) {
+            std::optional<int> value = shared.try_pop();
+            if (value) taken[*value].fetch_add(1);
+        }
+    }
+    done.store(true);
+    for (std::thread& t : threads) t.join();
+    while (std::optional<int> value = shared.try_pop()) taken[*value].fetch_add(1);
+    for (int i = 0; i < total; ++i) ASSERT_EQ(taken[i].load(), 1) << i;
+}
+
+namespace {
+// Counts live instances; copying throws while failCopies is set
+struct CountedThrowing {
+    static int live;
+    static bool failCopies;
+    std::string payload;
+    explicit CountedThrowing(std::string p) : payload(std::move(p)) { ++live; }
+    CountedThrowing(const CountedThrowing& other) : payload(other.payload) {
+        if (failCopies) throw std::logic_error("copy failed");
+        ++live;
+    }
+    ~CountedThrowing() { --live; }
+};
+int CountedThrowing::live = 0;
+bool CountedThrowing::failCopies = false;
+}
+
+TEST(ConcurrentTest, Work_Stealing_Deque_Throwing_Take)
+{
+    {
+        WorkStealingDeque<CountedThrowing> deque;
+        deque.emplace("owner");
+        deque.emplace("thief");
+        EXPECT_EQ(CountedThrowing::live, 2);
+
+        // A claimed element whose move-out throws is destroyed rather than leaked
+        CountedThrowing::failCopies = true;
+        EXPECT_THROW(deque.pop(), std::logic_error);
+        EXPECT_EQ(CountedThrowing::live, 1);
+        EXPECT_THROW(deque.steal(), std::logic_error);
+        EXPECT_EQ(CountedThrowing::live, 0);
+        CountedThrowing::failCopies = false;
+
+        deque.emplace("again");
+        EXPECT_EQ(deque.pop().payload, "again");
+    }
+    EXPECT_EQ(CountedThrowing::live, 0);
+}
+
+TEST(ConcurrentTest, Thread_Pool)
+{
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.thread_count(), 4u);
+
+    // Tasks spawning tasks land on the spawning worker's deque and get stolen by the others
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 200; ++i) {
+        pool.submit([&pool, &counter] {
+            for (int j = 0; j < 50; ++j) {
+                pool.submit([&counter] { counter.fetch_add(1); });
+            }
+            counter.fetch_add(1);
+        });
+    }
+    pool.wait_idle();
+    EXPECT_EQ(counter.load(), 200 * 51);
+
+    pool.submit([] { throw std::logic_error("task failed"); });
+    pool.submit([&counter] { counter.fetch_add(1); });
+    EXPECT_THROW(pool.wait_idle(), std::logic_error);
+    EXPECT_EQ(counter.load(), 200 * 51 + 1);
+    EXPECT_NO_THROW(pool.wait_idle());
+
+    // Tasks still queued when the pool goes away are run first
+    std::atomic<int> late{0};
+    {
+        ThreadPool shortLived(2);
+        for (int i = 0; i < 100; ++i) shortLived.submit([&late] { late.fetch_add(1); });
+    }
+    EXPECT_EQ(late.load(), 100);
+}
+
+TEST(ParallelTest, Parallel_Algorithms)
+{
+    ThreadPool pool(4);
+    constexpr int count = 100000;
+
+    Queue<int> q;
+    Queue<int, Chunked<64>> chunked;
+    Deque<int> d;
+    for (int i = 0; i < count; ++i) {
+        q.push(i);
+        chunked.push(i);
+        d.push_back(i);
+    }
+
+    const long long expected = static_cast<long long>(count) * (count - 1) / 2;
+    EXPECT_EQ(fwd_parallel::reduce(q, 0LL, std::plus<>(), pool), expected);
+    EXPECT_EQ(fwd_parallel::reduce(chunked, 0LL, std::plus<>(), pool), expected);
+    EXPECT_EQ(fwd_parallel::reduce(d, 0LL, std::plus<>(), pool), expected);
+    EXPECT_EQ(fwd_parallel::reduce(q, 5LL), expected + 5);
+
+    const Queue<int>& view = q;
+    EXPECT_EQ(fwd_parallel::count_if(view, [](int v) { return v % 3 == 0; }, pool), static_cast<size_t>((count + 2) / 3));
+    EXPECT_EQ(fwd_parallel::count_if(chunked, [](int v) { return v < 10; }, pool), 10u);
+
+    fwd_parallel::transform_inplace(chunked, [](int v) { return v * 2; }, pool);
+    int next = 0;
+    for (int v : chunked) {
+        ASSERT_EQ(v, next);
+        next += 2;
+    }
+
+    std::atomic<long long> visited{0};
+    fwd_parallel::for_each(d, [&visited](int& v) { visited.fetch_add(v, std::memory_order_relaxed); }, pool);
+    EXPECT_EQ(visited.load(), expected);
+
+    // Small containers stay on the calling thread
+    Stack<int> small;
+    small.push(1);
+    small.push(2);
+    EXPECT_EQ(fwd_parallel::reduce(small, 0, std::plus<>(), pool), 3);
+    Stack<int> empty;
+    EXPECT_EQ(fwd_parallel::count_if(empty, [](int) { return true; }, pool), 0u);
+}
+
+TEST(ParallelTest, Parallel_Failures_And_Nesting)
+{
+    ThreadPool pool(3);
+    Queue<int> q;
+    for (int i = 0; i < 50000; ++i) q.push(i);
+
+    // The first exception comes back once every segment has finished
+    std::atomic<int> visited{0};
+    EXPECT_THROW(fwd_parallel::for_each(q, [&visited](int v) {
+        visited.fetch_add(1);
+        if (v == 30000) throw std::runtime_error("bad element");
+    }, pool), std::runtime_error);
+    EXPECT_GE(visited.load(), 1);
+
+    // Called from inside one of the pool's tasks, the work runs on that worker
+    std::atomic<long long> nested{0};
+    pool.submit([&] { nested = fwd_parallel::reduce(q, 0LL, std::plus<>(), pool); });
+    pool.wait_idle();
+    EXPECT_EQ(nested.load(), 50000LL * 49999 / 2);
+}
+
+TEST(SimdTest, Range_Kernels_Match_Scalar)
+{
+    std::vector<simd_level> levels = {simd_level::scalar};
+    if (fwd_simd::detected_level() >= simd_level::sse2) levels.push_back(simd_level::sse2);
+    if (fwd_simd::detected_level() >= simd_level::avx2) levels.push_back(simd_level::avx2);
+
+    // Every length up to a few vectors, so all tail sizes are covered
+    for (size_t n = 1; n < 40; ++n) {
+        std::vector<int> ints(n);
+        std::vector<double> doubles(n);
+        for (size_t i = 0; i < n; ++i) {
+            ints[i] = static_cast<int>((i * 7919) % 13) - 6;
+            doubles[i] = static_cast<double>(ints[i]) * 0.5;
+        }
+        ints[n / 2] = 2000000000;
+        const int* first = ints.data();
+        const int* last = first + n;
+
+        for (simd_level level : levels) {
+            SCOPED_TRACE(static_cast<int>(level));
+            EXPECT_EQ(fwd_simd::find(first, last, 3, level), std::find(first, last, 3));
+            EXPECT_EQ(fwd_simd::count(first, last, -2, level), static_cast<size_t>(std::count(first, last, -2)));
+            EXPECT_EQ(fwd_simd::sum(first, last, level), std::accumulate(first, last, 0LL));
+            EXPECT_EQ(fwd_simd::min(first, last, level), *std::min_element(first, last));
+            EXPECT_EQ(fwd_simd::max(first, last, level), 2000000000);
+
+            const int* lastMatch = last;
+            for (const int* p = first; p != last; ++p) {
+                if (*p == 1) lastMatch = p;
+            }
+            EXPECT_EQ(fwd_simd::find_last(first, last, 1, level), lastMatch);
+
+            std::vector<double> copy = doubles;
+            const size_t expected = static_cast<size_t>(std::count(copy.begin(), copy.end(), 1.5));
+            EXPECT_EQ(fwd_simd::replace(copy.data(), copy.data() + n, 1.5, -9.0, level), expected);
+            EXPECT_EQ(std::count(copy.begin(), copy.end(), 1.5), 0);
+            EXPECT_EQ(fwd_simd::count(copy.data(), copy.data() + n, -9.0, level), expected);
+            EXPECT_DOUBLE_EQ(fwd_simd::sum(doubles.data(), doubles.data() + n, level), std::accumulate(doubles.begin(), doubles.end(), 0.0));
+        }
+    }
+
+    std::vector<float> floats = {1.5f, -2.0f, 8.25f, 0.0f, 3.0f, -7.5f, 4.0f, 2.0f, 9.0f, -1.0f};
+    EXPECT_EQ(fwd_simd::max(floats.data(), floats.data() + floats.size()), 9.0f);
+    EXPECT_EQ(fwd_simd::min(floats.data(), floats.data() + floats.size()), -7.5f);
+    EXPECT_EQ(*fwd_simd::find(floats.data(), floats.data() + floats.size(), 8.25), 8.25f);
+    EXPECT_THROW(fwd_simd::min(floats.data(), floats.data()), std::runtime_error);
+}
+
+TEST(SimdTest, Container_Kernels)
+{
+    Queue<int, Chunked<16>> chunked;
+    Stack<int, Chunked<16>> chunkedStack;
+    Stack<int, ContiguousStorage<8>> contiguous;
+    Deque<double> d;
+    Queue<int> linked;
+    for (int i = 0; i < 1000; ++i) {
+        chunked.push(i % 100);
+        chunkedStack.push(i % 100);
+        contiguous.push(i % 100);
+        d.push_back(i % 100);
+        linked.push(i % 100);
+    }
+
+    EXPECT_EQ(fwd_simd::count(chunked, 42), 10u);
+    EXPECT_EQ(fwd_simd::count(linked, 42), 10u);
+    EXPECT_EQ(fwd_simd::count(d, 42), 10u);
+    EXPECT_EQ(fwd_simd::sum(chunked), 49500LL);
+    EXPECT_EQ(fwd_simd::sum(contiguous), 49500LL);
+    EXPECT_DOUBLE_EQ(fwd_simd::sum(d), 49500.0);
+    EXPECT_EQ(fwd_simd::min(chunkedStack), 0);
+    EXPECT_EQ(fwd_simd::max(contiguous), 99);
+    EXPECT_EQ(fwd_simd::max(linked), 99);
+    EXPECT_EQ(fwd_simd::max(d), 99.0);
+
+    // find() returns the first match in iteration order, also for stacks
+    chunkedStack.push(7);
+    int* top = fwd_simd::find(chunkedStack, 7);
+    ASSERT_NE(top, nullptr);
+    EXPECT_EQ(top, &chunkedStack.top());
+    contiguous.push(7);
+    EXPECT_EQ(fwd_simd::find(contiguous, 7), &contiguous.top());
+    EXPECT_EQ(fwd_simd::find(chunked, 7), &chunked.front() + 7);
+    const Deque<double>& view = d;
+    EXPECT_EQ(fwd_simd::find(view, 1000.0), nullptr);
+
+    EXPECT_EQ(fwd_simd::replace(chunked, 42, -1), 10u);
+    EXPECT_EQ(fwd_simd::replace(linked, 42, -1), 10u);
+    EXPECT_EQ(std::count(chunked.begin(), chunked.end(), -1), 10);
+    EXPECT_EQ(fwd_simd::min(chunked), -1);
+
+    Deque<int> empty;
+    EXPECT_THROW(fwd_simd::min(empty), std::runtime_error);
+    EXPECT_EQ(fwd_simd::sum(empty), 0LL);
+}
+
+TEST(SimdTest, Mixed_Type_Needle)
+{
+    // The needle is converted to the element type on node and span storage alike
+    Queue<int> linked;
+    Queue<int, Chunked<8>> chunked;
+    for (int v : {1, 2, 3, 2}) {
+        linked.push(v);
+        chunked.push(v);
+    }
+
+    EXPECT_EQ(fwd_simd::count(linked, 2.5), fwd_simd::count(chunked, 2.5));
+    EXPECT_EQ(fwd_simd::count(linked, 2.5), 2u);
+    ASSERT_NE(fwd_simd::find(linked, 3.9), nullptr);
+    ASSERT_NE(fwd_simd::find(chunked, 3.9), nullptr);
+    EXPECT_EQ(*fwd_simd::find(linked, 3.9), *fwd_simd::find(chunked, 3.9));
+    EXPECT_EQ(fwd_simd::replace(linked, 2.7, 9.9), fwd_simd::replace(chunked, 2.7, 9.9));
+    EXPECT_TRUE(std::equal(linked.begin(), linked.end(), chunked.begin()));
+    EXPECT_EQ(fwd_simd::count(linked, 9), 2u);
+}
+
+TEST(InstrumentationTest, Stack_Counters)
+{
+    Stack<int, std::allocator<int>, Instrumented<>> s;
+    for (int i = 0; i < 10; ++i) s.push(i);
+    int values[] = {20, 21, 22};
+    s.push_range(values, values + 3);
+    EXPECT_EQ(s.pop(), 22);
+    int out[4];
+    s.pop_n(4, out);
+
+    ContainerStats stats = s.stats();
+    EXPECT_EQ(stats.pushes, 13u);
+    EXPECT_EQ(stats.pops, 5u);
+    EXPECT_EQ(stats.node_allocations, 13u);
+    EXPECT_EQ(stats.node_frees, 5u);
+    EXPECT_EQ(stats.peak_size, 13u);
+    EXPECT_EQ(stats.push_latency.samples(), 0u);
+
+    // Copies start from zero; clear() frees without counting pops
+    Stack<int, std::allocator<int>, Instrumented<>> copy(s);
+    EXPECT_EQ(copy.stats().node_allocations, 8u);
+    EXPECT_EQ(copy.stats().pushes, 0u);
+    EXPECT_EQ(copy.stats().peak_size, 8u);
+    s.clear();
+    EXPECT_EQ(s.stats().node_frees, 13u);
+    EXPECT_EQ(s.stats().pops, 5u);
+
+    s.reset_stats();
+    EXPECT_EQ(s.stats().pushes, 0u);
+    EXPECT_EQ(s.stats().peak_size, 0u);
+
+    // Text input is counted as pushes
+    std::stringstream sin("1 2 3");
+    sin >> s;
+    EXPECT_EQ(s.stats().pushes, 3u);
+    EXPECT_EQ(s.stats().peak_size, 3u);
+
+    static_assert(sizeof(Stack<int>) == sizeof(Stack<int, std::allocator<int>, Uninstrumented>));
+    static_assert(std::is_empty_v<Uninstrumented>);
+}
+
+TEST(InstrumentationTest, Queue_Counters_And_Latency)
+{
+    EXPECT_EQ(LatencyHistogram::bucket_of(0), 0u);
+    EXPECT_EQ(LatencyHistogram::bucket_of(1), 0u);
+    EXPECT_EQ(LatencyHistogram::bucket_of(2), 1u);
+    EXPECT_EQ(LatencyHistogram::bucket_of(1000), 9u);
+    EXPECT_EQ(LatencyHistogram::bucket_of(~0ull), LatencyHistogram::bucket_count - 1);
+
+    Queue<std::string, std::allocator<std::string>, Instrumented<4>> q;
+    for (int i = 0; i < 16; ++i) q.push(std::to_string(i));
+    for (int i = 0; i < 8; ++i) EXPECT_EQ(q.pop(), std::to_string(i));
+    q.emplace_front("front");
+
+    ContainerStats stats = q.stats();
+    EXPECT_EQ(stats.pushes, 17u);
+    EXPECT_EQ(stats.pops, 8u);
+    EXPECT_EQ(stats.peak_size, 16u);
+    EXPECT_EQ(stats.node_allocations - stats.node_frees, q.size());
+    EXPECT_EQ(stats.push_latency.samples(), 4u);
+    EXPECT_EQ(stats.pop_latency.samples(), 2u);
+
+    // Spare nodes of a bounded queue are reused without new allocations
+    Queue<int, std::allocator<int>, Instrumented<>> bounded;
+    bounded.set_capacity(4);
+    EXPECT_EQ(bounded.stats().node_allocations, 4u);
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 4; ++i) bounded.push(i);
+        EXPECT_TRUE(bounded.is_full());
+        while (!bounded.is_empty()) bounded.pop();
+    }
+    EXPECT_EQ(bounded.stats().node_allocations, 4u);
+    EXPECT_EQ(bounded.stats().node_frees, 0u);
+    EXPECT_EQ(bounded.stats().pushes, 12u);
+    EXPECT_EQ(bounded.stats().peak_size, 4u);
+
+    // A snapshot may be taken from another thread while the owner keeps pushing
+    std::atomic<bool> done{false};
+    std::thread reader([&] {
+        uint64_t last = 0;
+        while (!done.load()) {
+            uint64_t pushes = q.stats().pushes;
+            EXPECT_GE(pushes, last);
+            last = pushes;
+        }
+    });
+    for (int i = 0; i < 10000; ++i) q.push("x");
+    done.store(true);
+    reader.join();
+    EXPECT_EQ(q.stats().pushes, 10017u);
+}
+
+TEST(NodeLayoutTest, Cache_Aligned_Nodes)
+{
+    static_assert(offsetof(Node<int>, next) == 0);
+    static_assert(std::allocator_traits<CacheAlignedAllocator<int>>::is_always_equal::value);
+    static_assert(std::is_same_v<std::allocator_traits<CacheAlignedAllocator<int>>::rebind_alloc<Node<int>>,
+                                 CacheAlignedAllocator<Node<int>>>);
+
+    Stack<int, CacheAlignedAllocator<int>> s;
+    Queue<std::string, CacheAlignedAllocator<std::string>> q;
+    for (int i = 0; i < 100; ++i) {
+        s.push(i);
+        q.push(std::to_string(i));
+    }
+
+    auto on_line_start = [](const void* p) { return reinterpret_cast<uintptr_t>(p) % 64 == 0; };
+    std::set<uintptr_t> lines;
+    for (auto it = s.begin(); it != s.end(); ++it) {
+        EXPECT_TRUE(on_line_start(it.get_current()));
+        lines.insert(reinterpret_cast<uintptr_t>(it.get_current()) / 64);
+    }
+    EXPECT_EQ(lines.size(), 100u);
+    for (auto it = q.begin(); it != q.end(); ++it) EXPECT_TRUE(on_line_start(it.get_current()));
+
+    // Copies, bulk pops and clear walk the chains with prefetching
+    Stack<int, CacheAlignedAllocator<int>> copy_s(s);
+    Queue<std::string, CacheAlignedAllocator<std::string>> copy_q(q);
+    EXPECT_TRUE(std::equal(s.begin(), s.end(), copy_s.begin()));
+    EXPECT_TRUE(std::equal(q.begin(), q.end(), copy_q.begin()));
+    std::vector<int> out(50);
+    copy_s.pop_n(50, out.data());
+    EXPECT_EQ(out.front(), 99);
+    EXPECT_EQ(copy_s.top(), 49);
+    copy_q.clear();
+    EXPECT_TRUE(copy_q.empty());
+
+    std::stringstream sout;
+    sout << q;
+    EXPECT_EQ(sout.str().substr(0, 6), "0 1 2 ");
+
+    // A type with stricter alignment than the line keeps its own
+    struct alignas(128) Wide { char bytes[128]; };
+    CacheAlignedAllocator<Wide> wide;
+    EXPECT_EQ(CacheAlignedAllocator<Wide>::alignment, 128u);
+    Wide* w = wide.allocate(3);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(w) % 128, 0u);
+    wide.deallocate(w, 3);
+}
+
+#if FWD_HAS_CONSTEXPR_CONTAINERS
+// Squares of 1..N in pop order, built at compile time through StaticQueue
+template<size_t N>
+constexpr std::array<int, N> squares_table() {
+    StaticQueue<int, N> q;
+    for (int i = 1; i <= static_cast<int>(N); ++i) q.push(i * i);
+    std::array<int, N> table{};
+    for (size_t i = 0; i < N; ++i) table[i] = q.pop();
+    return table;
+}
+
+constexpr int static_stack_digits() {
+    StaticStack<int, 3> s;
+    s.push(1);
+    s.emplace(2);
+    s.push(3);
+    if (s.push(4) != static_status::full) return -1;
+    StaticStack<int, 3> copy(s);
+    copy.pop();
+    int digits = 0;
+    for (int v : copy) digits = digits * 10 + v;
+    return digits;
+}
+#endif
+
+TEST(StaticTest, Static_Stack_And_Queue)
+{
+#if FWD_HAS_CONSTEXPR_CONTAINERS
+    constexpr auto table = squares_table<5>();
+    static_assert(table[0] == 1 && table[4] == 25, "StaticQueue runs in constant expressions");
+    static_assert(static_stack_digits() == 21, "StaticStack runs in constant expressions");
+#endif
+    static_assert(is_forward_container_v<StaticStack<int, 4>> && is_forward_container_v<StaticQueue<int, 4>>,
+                  "Static containers are forward containers");
+    static_assert(noexcept(std::declval<StaticQueue<int, 4>&>().push(1)) && noexcept(std::declval<StaticStack<int, 4>&>().pop()),
+                  "Static containers do not throw for nothrow element types");
+
+    StaticStack<std::string, 3> s;
+    EXPECT_EQ(s.push("a"), static_status::ok);
+    EXPECT_EQ(s.emplace(2, 'b'), static_status::ok);
+    EXPECT_TRUE(s.try_push("c"));
+    EXPECT_TRUE(s.is_full());
+    EXPECT_EQ(s.push("d"), static_status::full);
+    EXPECT_EQ(s.top(), "c");
+    EXPECT_EQ(std::vector<std::string>(s.begin(), s.end()), (std::vector<std::string>{"c", "bb", "a"}));
+
+    StaticStack<std::string, 3> moved(std::move(s));
+    EXPECT_TRUE(s.empty());
+    std::string out;
+    EXPECT_EQ(moved.pop(out), static_status::ok);
+    EXPECT_EQ(out, "c");
+    EXPECT_EQ(moved.pop(), "bb");
+    EXPECT_EQ(*moved.try_pop(), "a");
+    EXPECT_EQ(moved.pop(out), static_status::empty);
+    EXPECT_FALSE(moved.try_pop().has_value());
+    EXPECT_EQ(moved.try_front(), nullptr);
+
+    // The ring wraps around without moving elements
+    StaticQueue<std::string, 3> q;
+    for (int i = 0; i < 3; ++i) EXPECT_EQ(q.push(std::to_string(i)), static_status::ok);
+    EXPECT_FALSE(q.try_emplace("3"));
+    EXPECT_EQ(q.pop(), "0");
+    EXPECT_EQ(q.pop(), "1");
+    EXPECT_TRUE(q.try_push("3"));
+    EXPECT_EQ(q.emplace("4"), static_status::ok);
+    EXPECT_EQ(q.push("5"), static_status::full);
+    EXPECT_EQ(q.front(), "2");
+    EXPECT_EQ(std::vector<std::string>(q.cbegin(), q.cend()), (std::vector<std::string>{"2", "3", "4"}));
+
+    StaticQueue<std::string, 3> copy;
+    copy = q;
+    EXPECT_TRUE(std::equal(q.begin(), q.end(), copy.begin(), copy.end()));
+    EXPECT_EQ(copy.get_front(), "2");
+
+    // Same names as Queue<T>: generic code and the adapter take either
+    Queue<std::string> drained;
+    EXPECT_EQ(forward_all(copy, drained), 3u);
+    EXPECT_EQ(drained.front(), "2");
+    fwd_container_adapter<StaticQueue<std::string, 3>> adapter(q);
+    fwd_container<std::string>& erased = adapter;
+    EXPECT_EQ(erased.size(), 3u);
+    EXPECT_EQ(*erased.begin(), "2");
+    q.clear();
+    EXPECT_TRUE(erased.is_empty());
+}
+
+namespace {
+// Copies succeed until copyBudget runs out, then throw
+struct BudgetedCopy {
+    static int live;
+    static int copyBudget;
+    int value;
+    explicit BudgetedCopy(int v) noexcept : value(v) { ++live; }
+    BudgetedCopy(const BudgetedCopy& other) : value(other.value) {
+        if (copyBudget-- == 0) throw std::logic_error("copy budget exhausted");
+        ++live;
+    }
+    BudgetedCopy(BudgetedCopy&& other) noexcept : value(other.value) { ++live; }
+    ~BudgetedCopy() { --live; }
+};
+int BudgetedCopy::live = 0;
+int BudgetedCopy::copyBudget = 0;
+}
+
+TEST(StaticTest, Static_Copy_Throws_Partway)
+{
+    {
+        StaticStack<BudgetedCopy, 4> s;
+        StaticQueue<BudgetedCopy, 4> q;
+        for (int i = 0; i < 4; ++i) {
+            s.emplace(i);
+            q.emplace(i);
+        }
+        q.pop();
+        q.emplace(4);   // wrapped around
+        EXPECT_EQ(BudgetedCopy::live, 8);
+
+        // The elements copied before the failure are destroyed, not leaked
+        BudgetedCopy::copyBudget = 2;
+        EXPECT_THROW((StaticStack<BudgetedCopy, 4>{s}), std::logic_error);
+        EXPECT_EQ(BudgetedCopy::live, 8);
+        BudgetedCopy::copyBudget = 2;
+        EXPECT_THROW((StaticQueue<BudgetedCopy, 4>{q}), std::logic_error);
+        EXPECT_EQ(BudgetedCopy::live, 8);
+
+        // A throwing assignment leaves the target empty
+        StaticQueue<BudgetedCopy, 4> target;
+        target.emplace(9);
+        BudgetedCopy::copyBudget = 1;
+        EXPECT_THROW(target = q, std::logic_error);
+        EXPECT_TRUE(target.empty());
+        EXPECT_EQ(BudgetedCopy::live, 8);
+    }
+    EXPECT_EQ(BudgetedCopy::live, 0);
+}
+
+#if __cplusplus >= 202002L
+static_assert(FWD_HAS_CONSTEXPR_CONTAINERS && FWD_HAS_COROUTINES,
+              "A C++20 build must compile the constexpr and coroutine containers");
+#endif
+
+#if FWD_HAS_COROUTINES
+// Fire-and-forget coroutine: runs until its first suspension, frees itself when done
+struct DetachedStage {
+    struct promise_type {
+        DetachedStage get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+DetachedStage collect(AsyncQueue<int>& in, std::vector<int>& out, int count) {
+    for (int i = 0; i < count; ++i) out.push_back(co_await in.pop());
+}
+
+DetachedStage collect_batches(AsyncQueue<int>& in, std::vector<size_t>& sizes, size_t batches) {
+    for (size_t i = 0; i < batches; ++i) sizes.push_back((co_await in.pop_batch(3)).size());
+}
+
+DetachedStage forward_incremented(AsyncQueue<int>& in, AsyncQueue<int>& out) {
+    int value = co_await in.pop();
+    out.push(value + 1);
+}
+
+DetachedStage accumulate_one(AsyncQueue<int>& in, std::atomic<long>& sum, std::atomic<int>& done) {
+    sum.fetch_add(co_await in.pop());
+    done.fetch_add(1);
+}
+#endif
+
+TEST(AsyncTest, Async_Queue_Suspends_And_Resumes)
+{
+#if FWD_HAS_COROUTINES
+    static_assert(noexcept(std::declval<AsyncQueue<int>::pop_awaiter&>().await_suspend(std::coroutine_handle<>())) &&
+                  noexcept(std::declval<AsyncQueue<int>::batch_awaiter&>().await_suspend(std::coroutine_handle<>())),
+                  "Suspending links the awaiter itself and cannot fail");
+    AsyncQueue<int> q;
+    std::vector<int> seen;
+    q.push(1);
+    collect(q, seen, 3);
+    EXPECT_EQ(seen, std::vector<int>{1});
+    EXPECT_EQ(q.waiting(), 1u);
+
+    // push resumes the waiting consumer on this thread before returning
+    q.push(2);
+    EXPECT_EQ(seen, (std::vector<int>{1, 2}));
+    q.push(3);
+    EXPECT_EQ(seen, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(q.waiting(), 0u);
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.try_pop().has_value());
+
+    // A batch takes what is there, up to n, and waits only for the first element
+    for (int i = 0; i < 5; ++i) q.push(i);
+    std::vector<size_t> sizes;
+    collect_batches(q, sizes, 3);
+    EXPECT_EQ(sizes, (std::vector<size_t>{3, 2}));
+    q.push(7);
+    EXPECT_EQ(sizes, (std::vector<size_t>{3, 2, 1}));
+    EXPECT_THROW(q.pop_batch(0), std::invalid_argument);
+
+    // A chain of stages, each suspended on its own queue
+    std::vector<std::unique_ptr<AsyncQueue<int>>> chain;
+    for (int i = 0; i <= 100; ++i) chain.push_back(std::make_unique<AsyncQueue<int>>());
+    for (int i = 0; i < 100; ++i) forward_incremented(*chain[i], *chain[i + 1]);
+    chain[0]->push(0);
+    EXPECT_EQ(chain[100]->try_pop(), std::optional<int>(100));
+#else
+    GTEST_SKIP() << "AsyncQueue needs C++20 coroutines";
+#endif
+}
+
+TEST(AsyncTest, Async_Queue_Many_Consumers)
+{
+#if FWD_HAS_COROUTINES
+    constexpr int consumers = 2000;
+    constexpr int producers = 4;
+    AsyncQueue<int> q;
+    std::atomic<long> sum{0};
+    std::atomic<int> done{0};
+
+    // Half of the consumers find an element, the other half suspend until producers arrive
+    for (int i = 0; i < consumers / 2; ++i) q.push(i);
+    for (int i = 0; i < consumers; ++i) accumulate_one(q, sum, done);
+    EXPECT_EQ(done.load(), consumers / 2);
+    EXPECT_EQ(q.waiting(), static_cast<size_t>(consumers / 2));
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = p; i < consumers / 2; i += producers) q.push(consumers / 2 + i);
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    EXPECT_EQ(done.load(), consumers);
+    EXPECT_EQ(sum.load(), static_cast<long>(consumers) * (consumers - 1) / 2);
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(q.waiting(), 0u);
+#else
+    GTEST_SKIP() << "AsyncQueue needs C++20 coroutines";
+#endif
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);